@@ -0,0 +1,413 @@
+/*
+ * Benchmark.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Koala {
+
+namespace Benchmark {
+
+enum class Format { TEXT, CSV, JSON };
+
+/**
+ * Options shared by all benchmark executables. They are given as --name=value arguments anywhere
+ * on the command line, all the remaining arguments are left as positional ones.
+ */
+struct Options {
+    int warmup = 0;
+    int repetitions = 1;
+    std::vector<int> threads;
+    double timeout = 0.0;
+    Format format = Format::TEXT;
+    std::vector<std::string> positional;
+};
+
+inline const char *USAGE =
+    "[--warmup=N] [--repetitions=N] [--threads=T1,T2,...] [--timeout=SECONDS] "
+    "[--format=text|csv|json]";
+
+/**
+ * Parse the benchmark options. Throws std::invalid_argument on an unrecognized or malformed
+ * option.
+ */
+inline Options parse(int argc, const char * const *argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        std::string argument(argv[i]);
+        if (argument.rfind("--", 0) != 0) {
+            options.positional.push_back(argument);
+            continue;
+        }
+        auto position = argument.find('=');
+        if (position == std::string::npos) {
+            throw std::invalid_argument("Missing value for option " + argument);
+        }
+        std::string name = argument.substr(2, position - 2), value = argument.substr(position + 1);
+        if (name == "warmup") {
+            options.warmup = std::stoi(value);
+        } else if (name == "repetitions") {
+            options.repetitions = std::max(1, std::stoi(value));
+        } else if (name == "threads") {
+            std::stringstream stream(value);
+            for (std::string token; std::getline(stream, token, ',');) {
+                options.threads.push_back(std::max(1, std::stoi(token)));
+            }
+        } else if (name == "timeout") {
+            options.timeout = std::stod(value);
+        } else if (name == "format" && value == "text") {
+            options.format = Format::TEXT;
+        } else if (name == "format" && value == "csv") {
+            options.format = Format::CSV;
+        } else if (name == "format" && value == "json") {
+            options.format = Format::JSON;
+        } else {
+            throw std::invalid_argument("Unrecognized option " + argument);
+        }
+    }
+    return options;
+}
+
+/**
+ * Wall times and peak memory usage of a single (input, algorithm, thread count) configuration.
+ * The peak memory usage is the high-water mark of the resident set size of the process running the
+ * configuration, so unless it runs in a forked child it includes the peaks of all the earlier ones.
+ */
+struct Measurement {
+    std::string input, algorithm, result;
+    int threads = 1;
+    std::vector<double> times;
+    long peak_rss = 0;
+    bool timed_out = false, failed = false;
+
+    bool done() const {
+        return !timed_out && !failed;
+    }
+
+    const char* status() const {
+        return timed_out ? "timeout" : failed ? "failed" : "ok";
+    }
+
+    double percentile(double p) const {
+        std::vector<double> sorted(times);
+        std::sort(sorted.begin(), sorted.end());
+        auto rank = static_cast<std::size_t>(std::ceil(p * static_cast<double>(sorted.size())));
+        return sorted[std::max<std::size_t>(rank, 1) - 1];
+    }
+
+    double median() const {
+        std::vector<double> sorted(times);
+        std::sort(sorted.begin(), sorted.end());
+        auto k = sorted.size();
+        return k % 2 == 1 ? sorted[k / 2] : (sorted[k / 2 - 1] + sorted[k / 2]) / 2;
+    }
+
+    double minimum() const {
+        return *std::min_element(times.begin(), times.end());
+    }
+
+    double mean() const {
+        double total = 0.0;
+        for (auto t : times) {
+            total += t;
+        }
+        return total / static_cast<double>(times.size());
+    }
+};
+
+inline long peak_rss() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// Quote a CSV field as in RFC 4180, doubling the quotes inside it.
+inline std::string escape_csv(const std::string &text) {
+    std::string out = "\"";
+    for (auto c : text) {
+        if (c == '"') {
+            out.push_back('"');
+        }
+        out.push_back(c);
+    }
+    out.push_back('"');
+    return out;
+}
+
+// Quote a JSON string, escaping the quotes, the backslashes and the control characters.
+inline std::string escape_json(const std::string &text) {
+    std::string out = "\"";
+    for (auto c : text) {
+        if (c == '"' || c == '\\') {
+            out.push_back('\\');
+            out.push_back(c);
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char code[7];
+            std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned char>(c));
+            out += code;
+        } else {
+            out.push_back(c);
+        }
+    }
+    out.push_back('"');
+    return out;
+}
+
+/**
+ * Runs measured bodies with warmup, repetitions and thread count sweeps, and reports the wall time
+ * statistics in the requested format. If a timeout is set, every configuration runs in a forked
+ * child process, which is killed once the time limit is exceeded; the peak RSS then covers only
+ * that configuration. Otherwise all of them run in the current process, so the reported peak RSS
+ * never decreases from one configuration to the next. A configuration whose body or summary throws
+ * is reported as failed, and the sweep goes on with the next one.
+ */
+class Harness {
+ public:
+    explicit Harness(const Options &options, std::ostream &out = std::cout)
+        : options(options), out(out) {
+        if (options.format == Format::CSV) {
+            out << "input,algorithm,threads,repetitions,result,median,p95,min,mean,peak_rss_kb,"
+                << "status" << std::endl;
+        } else if (options.format == Format::JSON) {
+            out << "[";
+        }
+    }
+
+    Harness(const Harness &) = delete;
+    Harness& operator=(const Harness &) = delete;
+
+    ~Harness() {
+        if (options.format == Format::JSON) {
+            out << (first ? "]" : "\n]") << std::endl;
+        }
+    }
+
+    /**
+     * Measure the body for every thread count in the sweep. The body is timed as a whole and
+     * returns an object, on which the untimed summary is called after the last repetition to
+     * verify it and extract a printable result.
+     *
+     * @return the printable result of the last configuration, or std::nullopt on a timeout or
+     *         an exception thrown by the body or the summary.
+     */
+    template <typename Body, typename Summary>
+    std::optional<std::string> measure(
+            const std::string &input, const std::string &algorithm, Body body, Summary summary) {
+        std::optional<std::string> result;
+        std::vector<int> sweep(options.threads);
+        if (sweep.empty()) {
+            sweep.push_back(omp_get_max_threads());
+        }
+        for (auto threads : sweep) {
+            Measurement measurement;
+            measurement.input = input;
+            measurement.algorithm = algorithm;
+            measurement.threads = threads;
+            if (options.timeout > 0.0) {
+                run_forked(measurement, body, summary);
+            } else {
+                try {
+                    run_inplace(measurement, body, summary);
+                } catch (const std::exception &e) {
+                    std::cerr << input << " " << algorithm << " failed: " << e.what() << std::endl;
+                    measurement.failed = true;
+                }
+            }
+            report(measurement);
+            result = measurement.done() ? std::make_optional(measurement.result) : std::nullopt;
+        }
+        return result;
+    }
+
+ private:
+    template <typename Body, typename Summary>
+    void run_inplace(Measurement &measurement, Body &body, Summary &summary) {
+        omp_set_num_threads(measurement.threads);
+        for (int i = 0; i < options.warmup; i++) {
+            body();
+        }
+        for (int i = 0; i < options.repetitions; i++) {
+            auto start = std::chrono::steady_clock::now();
+            auto outcome = body();
+            auto finish = std::chrono::steady_clock::now();
+            measurement.times.push_back(std::chrono::duration<double>(finish - start).count());
+            if (i + 1 == options.repetitions) {
+                std::ostringstream stream;
+                stream << summary(outcome);
+                measurement.result = stream.str();
+            }
+        }
+        measurement.peak_rss = peak_rss();
+    }
+
+    template <typename Body, typename Summary>
+    void run_forked(Measurement &measurement, Body &body, Summary &summary) {
+        int pipe_fds[2];
+        if (pipe(pipe_fds) != 0) {
+            throw std::runtime_error("Unable to create a pipe for the benchmark child");
+        }
+        out.flush();
+        pid_t pid = fork();
+        if (pid < 0) {
+            throw std::runtime_error("Unable to fork the benchmark child");
+        }
+        if (pid == 0) {
+            close(pipe_fds[0]);
+            // the exceptions must not unwind into the copy of main in the child
+            try {
+                run_inplace(measurement, body, summary);
+            } catch (const std::exception &e) {
+                std::cerr << measurement.input << " " << measurement.algorithm << " failed: "
+                    << e.what() << std::endl;
+                _exit(1);
+            } catch (...) {
+                _exit(1);
+            }
+            std::ostringstream stream;
+            stream << std::setprecision(17) << measurement.peak_rss << " "
+                << measurement.times.size();
+            for (auto t : measurement.times) {
+                stream << " " << t;
+            }
+            stream << " " << measurement.result;
+            auto message = stream.str();
+            for (std::size_t written = 0; written < message.size();) {
+                auto k = write(pipe_fds[1], message.data() + written, message.size() - written);
+                if (k <= 0) {
+                    break;
+                }
+                written += static_cast<std::size_t>(k);
+            }
+            close(pipe_fds[1]);
+            _exit(0);
+        }
+        close(pipe_fds[1]);
+        std::string message;
+        auto deadline = std::chrono::steady_clock::now()
+            + std::chrono::duration<double>(options.timeout);
+        while (true) {
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now()).count();
+            struct pollfd descriptor = { pipe_fds[0], POLLIN, 0 };
+            int ready = remaining > 0 ? poll(&descriptor, 1, static_cast<int>(remaining)) : 0;
+            if (ready < 0 && errno == EINTR) {
+                continue;
+            }
+            if (ready <= 0) {
+                measurement.timed_out = true;
+                kill(pid, SIGKILL);
+                break;
+            }
+            char buffer[4096];
+            auto k = read(pipe_fds[0], buffer, sizeof(buffer));
+            if (k <= 0) {
+                break;
+            }
+            message.append(buffer, static_cast<std::size_t>(k));
+        }
+        close(pipe_fds[0]);
+        int status;
+        waitpid(pid, &status, 0);
+        if (measurement.timed_out) {
+            return;
+        }
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            measurement.failed = true;
+            return;
+        }
+        std::istringstream stream(message);
+        std::size_t k;
+        stream >> measurement.peak_rss >> k;
+        measurement.times.resize(k);
+        for (auto &t : measurement.times) {
+            stream >> t;
+        }
+        stream >> std::ws;
+        std::getline(stream, measurement.result, '\0');
+    }
+
+    void report(const Measurement &measurement) {
+        bool done = measurement.done();
+        switch (options.format) {
+        case Format::TEXT:
+            out << measurement.input << " " << measurement.algorithm
+                << " threads=" << measurement.threads;
+            if (done) {
+                out << " result=" << measurement.result << " median=" << measurement.median()
+                    << " p95=" << measurement.percentile(0.95) << " min=" << measurement.minimum()
+                    << " mean=" << measurement.mean() << " peak_rss_kb=" << measurement.peak_rss;
+            } else {
+                out << " " << measurement.status();
+            }
+            out << std::endl;
+            break;
+        case Format::CSV:
+            out << escape_csv(measurement.input) << "," << escape_csv(measurement.algorithm) << ","
+                << measurement.threads << "," << options.repetitions << ",";
+            if (done) {
+                out << escape_csv(measurement.result) << "," << measurement.median()
+                    << "," << measurement.percentile(0.95) << "," << measurement.minimum() << ","
+                    << measurement.mean() << "," << measurement.peak_rss << ",ok";
+            } else {
+                out << ",,,,,," << measurement.status();
+            }
+            out << std::endl;
+            break;
+        case Format::JSON:
+            out << (first ? "\n" : ",\n") << "  {\"input\": " << escape_json(measurement.input)
+                << ", \"algorithm\": " << escape_json(measurement.algorithm)
+                << ", \"threads\": " << measurement.threads
+                << ", \"repetitions\": " << options.repetitions;
+            if (done) {
+                out << ", \"result\": " << escape_json(measurement.result) << ", \"times\": [";
+                for (std::size_t i = 0; i < measurement.times.size(); i++) {
+                    out << (i > 0 ? ", " : "") << measurement.times[i];
+                }
+                out << "], \"median\": " << measurement.median()
+                    << ", \"p95\": " << measurement.percentile(0.95)
+                    << ", \"min\": " << measurement.minimum()
+                    << ", \"mean\": " << measurement.mean()
+                    << ", \"peak_rss_kb\": " << measurement.peak_rss << ", \"status\": \"ok\"}";
+            } else {
+                out << ", \"status\": \"" << measurement.status() << "\"}";
+            }
+            out << std::flush;
+            first = false;
+            break;
+        default:
+            break;
+        }
+    }
+
+    Options options;
+    std::ostream &out;
+    bool first = true;
+};
+
+}  // namespace Benchmark
+
+}  // namespace Koala
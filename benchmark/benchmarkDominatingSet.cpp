@@ -2,30 +2,61 @@
 #include <iostream>
 #include <map>
 
+#include <base/Portfolio.hpp>
 #include <dominating_set/ExactDominatingSet.hpp>
 #include <io/G6GraphReader.hpp>
 #include <set_cover/BranchAndReduceSetCover.hpp>
 
+#include "Benchmark.hpp"
+
 template <typename T>
-int run_algorithm(NetworKit::Graph &G, bool print = false) {
-    auto algorithm = T(G);
-    algorithm.run();
-    auto &dominating_set = algorithm.getDominatingSet();
-    std::cout << dominating_set.size() << " " << std::flush;
-    algorithm.check();
-    return dominating_set.size();
+std::optional<std::string> run_algorithm(
+        Koala::Benchmark::Harness &harness, const std::string &input, const std::string &name,
+        NetworKit::Graph &G) {
+    return harness.measure(input, name, [&] {
+        auto algorithm = T(G);
+        algorithm.run();
+        return algorithm;
+    }, [](T &algorithm) {
+        algorithm.check();
+        return algorithm.getDominatingSet().size();
+    });
+}
+
+// races all the exact algorithms, the losers are cancelled through their stop tokens
+std::optional<std::string> run_portfolio(
+        Koala::Benchmark::Harness &harness, const std::string &input, const std::string &name,
+        NetworKit::Graph &G) {
+    using Portfolio = Koala::Portfolio<
+        Koala::FominKratschWoegingerDominatingSet, Koala::SchiermeyerDominatingSet,
+        Koala::BranchAndReduceDominatingSet<Koala::RooijBodlaenderSetCover>>;
+    return harness.measure(input, name, [&] {
+        auto algorithm = Portfolio(Koala::borrow(G));
+        algorithm.run();
+        return algorithm;
+    }, [](Portfolio &algorithm) {
+        return algorithm.visit([](const Koala::DominatingSet &winner) {
+            winner.check();
+            return winner.getDominatingSet().size();
+        });
+    });
 }
 
 std::map<std::string, int> ALGORITHM = {
     { "exact", 0 },
-    { "FKW", 1 }, { "Schiermeyer", 2 }, { "Grandoni", 3 }, { "FGK", 4 }, { "Rooij", 5 }
+    { "FKW", 1 }, { "Schiermeyer", 2 }, { "Grandoni", 3 }, { "FGK", 4 }, { "Rooij", 5 },
+    { "portfolio", 6 }
 };
 
 int main(int argc, char **argv) {
-    if (argc != 2) {
-        std::cerr << "Usage: " << argv[0] << " <algorithm>" << std::endl;
+    auto options = Koala::Benchmark::parse(argc, argv);
+    if (options.positional.size() != 1) {
+        std::cerr << "Usage: " << argv[0] << " " << Koala::Benchmark::USAGE << " <algorithm>"
+            << std::endl;
         return 1;
     }
+    Koala::Benchmark::Harness harness(options);
+    const std::string &algorithm = options.positional[0];
     while (true) {
         std::string line;
         std::cin >> line;
@@ -33,38 +64,49 @@ int main(int argc, char **argv) {
             break;
         }
         NetworKit::Graph G = Koala::G6GraphReader().readline(line);
-        std::set<int> D;
-        std::cout << line << " " << std::flush;
-        switch (ALGORITHM[std::string(argv[1])]) {
+        std::set<std::optional<std::string>> D;
+        switch (ALGORITHM[algorithm]) {
         case 0:
-            D.insert(run_algorithm<Koala::FominKratschWoegingerDominatingSet>(G));
-            D.insert(run_algorithm<Koala::SchiermeyerDominatingSet>(G));
+            D.insert(run_algorithm<Koala::FominKratschWoegingerDominatingSet>(
+                harness, line, "FKW", G));
+            D.insert(run_algorithm<Koala::SchiermeyerDominatingSet>(
+                harness, line, "Schiermeyer", G));
             D.insert(run_algorithm<
-                Koala::BranchAndReduceDominatingSet<Koala::GrandoniSetCover>>(G));
+                Koala::BranchAndReduceDominatingSet<Koala::GrandoniSetCover>>(
+                    harness, line, "Grandoni", G));
             D.insert(run_algorithm<
-                Koala::BranchAndReduceDominatingSet<Koala::FominGrandoniKratschSetCover>>(G));
+                Koala::BranchAndReduceDominatingSet<Koala::FominGrandoniKratschSetCover>>(
+                    harness, line, "FGK", G));
             D.insert(run_algorithm<
-                Koala::BranchAndReduceDominatingSet<Koala::RooijBodlaenderSetCover>>(G));
-            assert(D.size() == 1);
+                Koala::BranchAndReduceDominatingSet<Koala::RooijBodlaenderSetCover>>(
+                    harness, line, "Rooij", G));
+            D.insert(run_portfolio(harness, line, "portfolio", G));
+            D.erase(std::nullopt);
+            assert(D.size() <= 1);
             break;
         case 1:
-            run_algorithm<Koala::FominKratschWoegingerDominatingSet>(G);
+            run_algorithm<Koala::FominKratschWoegingerDominatingSet>(harness, line, algorithm, G);
             break;
         case 2:
-            run_algorithm<Koala::SchiermeyerDominatingSet>(G);
+            run_algorithm<Koala::SchiermeyerDominatingSet>(harness, line, algorithm, G);
             break;
         case 3:
-            run_algorithm<Koala::BranchAndReduceDominatingSet<Koala::GrandoniSetCover>>(G);
+            run_algorithm<Koala::BranchAndReduceDominatingSet<Koala::GrandoniSetCover>>(
+                harness, line, algorithm, G);
             break;
         case 4:
             run_algorithm<
-                Koala::BranchAndReduceDominatingSet<Koala::FominGrandoniKratschSetCover>>(G);
+                Koala::BranchAndReduceDominatingSet<Koala::FominGrandoniKratschSetCover>>(
+                    harness, line, algorithm, G);
             break;
         case 5:
-            run_algorithm<Koala::BranchAndReduceDominatingSet<Koala::RooijBodlaenderSetCover>>(G);
+            run_algorithm<Koala::BranchAndReduceDominatingSet<Koala::RooijBodlaenderSetCover>>(
+                harness, line, algorithm, G);
+            break;
+        case 6:
+            run_portfolio(harness, line, algorithm, G);
             break;
         }
-        std::cout << std::endl;
     }
     return 0;
 }
@@ -0,0 +1,70 @@
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <memory>
+
+#include <generator/GraphGenerator.hpp>
+#include <io/DimacsGraphWriter.hpp>
+
+#include "Benchmark.hpp"
+
+std::map<std::string, int> GENERATOR = {
+    { "ER", 0 }, { "RMAT", 1 }, { "RGG", 2 }, { "grid", 3 }, { "road", 4 }, { "perfect", 5 },
+    { "AK", 6 }, { "RLG", 7 }
+};
+
+std::unique_ptr<Koala::GraphGenerator> create_generator(
+        const std::string &name, NetworKit::count n, uint64_t seed) {
+    const double AVERAGE_DEGREE = 8.0;
+    auto side = static_cast<NetworKit::count>(std::ceil(std::sqrt(static_cast<double>(n))));
+    switch (GENERATOR.contains(name) ? GENERATOR[name] : -1) {
+    case 0:
+        return std::make_unique<Koala::ErdosRenyiGenerator>(
+            n, AVERAGE_DEGREE / static_cast<double>(n), false, seed);
+    case 1:
+        return std::make_unique<Koala::RmatGenerator>(
+            static_cast<NetworKit::count>(std::ceil(std::log2(static_cast<double>(n)))),
+            AVERAGE_DEGREE / 2, 0.57, 0.19, 0.19, seed);
+    case 2:
+        return std::make_unique<Koala::RandomGeometricGenerator>(
+            n, std::sqrt(AVERAGE_DEGREE / (M_PI * static_cast<double>(n))), seed);
+    case 3:
+        return std::make_unique<Koala::GridGenerator>(side, side, 1.0, 1, seed);
+    case 4:
+        return std::make_unique<Koala::GridGenerator>(side, side, 0.9, 1000, seed);
+    case 5:
+        return std::make_unique<Koala::RandomIntervalGenerator>(
+            n, AVERAGE_DEGREE / static_cast<double>(n), seed);
+    case 6:
+        return std::make_unique<Koala::AKFlowNetworkGenerator>(n / 3);
+    case 7:
+        return std::make_unique<Koala::WashingtonFlowNetworkGenerator>(side, side, 10000, seed);
+    default:
+        return nullptr;
+    }
+}
+
+int main(int argc, const char *argv[]) {
+    auto options = Koala::Benchmark::parse(argc, argv);
+    if (options.positional.size() != 3 && options.positional.size() != 4) {
+        std::cerr << "Usage: " << argv[0] << " " << Koala::Benchmark::USAGE
+            << " <generator> <nodes> <output file> [seed]" << std::endl;
+        return 1;
+    }
+    const auto &name = options.positional[0], &path = options.positional[2];
+    auto n = std::stoull(options.positional[1]);
+    uint64_t seed = options.positional.size() == 4 ? std::stoull(options.positional[3]) : 0;
+    auto generator = create_generator(name, n, seed);
+    if (!generator) {
+        std::cerr << "Unknown generator: " << name << std::endl;
+        return 1;
+    }
+    Koala::Benchmark::Harness harness(options);
+    harness.measure(path, name, [&] {
+        Koala::DimacsGraphWriter().write(*generator, path);
+        return generator->numberOfNodes();
+    }, [](NetworKit::count nodes) {
+        return nodes;
+    });
+    return 0;
+}
@@ -0,0 +1 @@
+echo "benchmarkGenerator.sh $@"
@@ -0,0 +1,115 @@
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+
+#include <networkit/components/ConnectedComponents.hpp>
+
+#include <flow/GlobalMinimumCut.hpp>
+#include <generator/GraphGenerator.hpp>
+#include <io/DimacsGraphReader.hpp>
+
+#include "Benchmark.hpp"
+
+template <typename T>
+std::optional<std::string> run_algorithm(
+        Koala::Benchmark::Harness &harness, const std::string &input, const std::string &name,
+        const NetworKit::Graph &G) {
+    return harness.measure(input, name, [&] {
+        auto algorithm = T(G);
+        algorithm.run();
+        return algorithm;
+    }, [](T &algorithm) {
+        algorithm.check();
+        return algorithm.getCutSize();
+    });
+}
+
+std::map<std::string, int> ALGORITHM = {
+    { "exact", 0 },
+    { "StoerWagner", 1 }, { "NagamochiIbaraki", 2 }, { "KargerStein", 3 }
+};
+
+void run_algorithms(
+        Koala::Benchmark::Harness &harness, const std::string &input, const std::string &algorithm,
+        const NetworKit::Graph &G) {
+    switch (ALGORITHM.contains(algorithm) ? ALGORITHM[algorithm] : -1) {
+    case 0: {
+        std::set<std::optional<std::string>> T;
+        T.insert(run_algorithm<Koala::StoerWagnerGlobalMinimumCut>(
+            harness, input, "StoerWagner", G));
+        T.insert(run_algorithm<Koala::NagamochiIbarakiGlobalMinimumCut>(
+            harness, input, "NagamochiIbaraki", G));
+        T.erase(std::nullopt);
+        assert(T.size() <= 1);
+        break;
+    }
+    case 1:
+        run_algorithm<Koala::StoerWagnerGlobalMinimumCut>(harness, input, algorithm, G);
+        break;
+    case 2:
+        run_algorithm<Koala::NagamochiIbarakiGlobalMinimumCut>(harness, input, algorithm, G);
+        break;
+    case 3:
+        run_algorithm<Koala::KargerSteinGlobalMinimumCut>(harness, input, algorithm, G);
+        break;
+    default:
+        std::cerr << "Unknown algorithm: " << algorithm << std::endl;
+    }
+}
+
+std::unique_ptr<Koala::GraphGenerator> create_generator(
+        const std::string &name, NetworKit::count m, uint64_t seed) {
+    const double AVERAGE_DEGREE = 8.0;
+    auto n = static_cast<NetworKit::count>(2.0 * static_cast<double>(m) / AVERAGE_DEGREE);
+    auto side = static_cast<NetworKit::count>(std::ceil(std::sqrt(static_cast<double>(m) / 2)));
+    if (name == "ER") {
+        return std::make_unique<Koala::ErdosRenyiGenerator>(
+            n, AVERAGE_DEGREE / static_cast<double>(n), false, seed);
+    } else if (name == "RGG") {
+        return std::make_unique<Koala::RandomGeometricGenerator>(
+            n, std::sqrt(AVERAGE_DEGREE / (M_PI * static_cast<double>(n))), seed);
+    } else if (name == "road") {
+        return std::make_unique<Koala::GridGenerator>(side, side, 0.9, 1000, seed);
+    }
+    return nullptr;
+}
+
+int main(int argc, const char *argv[]) {
+    auto options = Koala::Benchmark::parse(argc, argv);
+    if (options.positional.size() < 2 || options.positional.size() > 4) {
+        std::cerr << "Usage: " << argv[0] << " " << Koala::Benchmark::USAGE
+            << " <algorithm> (<file.gr> | (ER|RGG|road) <edges> [seed])" << std::endl;
+        return 1;
+    }
+    Koala::Benchmark::Harness harness(options);
+    const auto &algorithm = options.positional[0], &input = options.positional[1];
+    auto position = input.find_last_of(".");
+    if (position != std::string::npos && input.substr(position + 1) == "gr") {
+        auto G_directed = Koala::DimacsGraphReader().read(input);
+        auto G = NetworKit::Graph(G_directed.numberOfNodes(), true, false);
+        G_directed.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+            G.increaseWeight(u, v, w);
+        });
+        run_algorithms(harness, input, algorithm, G);
+        return 0;
+    }
+    if (options.positional.size() < 3) {
+        std::cerr << "Missing the number of edges for the generator: " << input << std::endl;
+        return 1;
+    }
+    auto m = std::stoull(options.positional[2]);
+    uint64_t seed = options.positional.size() == 4 ? std::stoull(options.positional[3]) : 0;
+    auto generator = create_generator(input, m, seed);
+    if (!generator) {
+        std::cerr << "Unknown generator: " << input << std::endl;
+        return 1;
+    }
+    // the generated graphs may be disconnected, which makes every minimum cut trivial
+    auto G = NetworKit::ConnectedComponents::extractLargestConnectedComponent(
+        generator->generate(), true);
+    run_algorithms(harness, input + " " + std::to_string(m), algorithm, G);
+    return 0;
+}
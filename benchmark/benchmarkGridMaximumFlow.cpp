@@ -0,0 +1,81 @@
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <set>
+
+#include <flow/DinicMaximumFlow.hpp>
+#include <flow/GridMaximumFlow.hpp>
+#include <generator/GraphGenerator.hpp>
+
+#include "Benchmark.hpp"
+
+template <typename T, typename... Args>
+std::optional<std::string> run_algorithm(
+        Koala::Benchmark::Harness &harness, const std::string &input, const std::string &name,
+        const Koala::GridNetwork &network, Args... args) {
+    return harness.measure(input, name, [&] {
+        auto maximum_flow = T(network, args...);
+        maximum_flow.run();
+        return maximum_flow;
+    }, [](T &maximum_flow) {
+        maximum_flow.check();
+        return maximum_flow.getFlowSize();
+    });
+}
+
+std::map<std::string, int> ALGORITHM = {
+    { "all", 0 },
+    { "BK", 1 }, { "PushRelabel", 2 }, { "Dinic", 3 }
+};
+
+int main(int argc, const char *argv[]) {
+    auto options = Koala::Benchmark::parse(argc, argv);
+    if (options.positional.size() < 3 || options.positional.size() > 7) {
+        std::cerr << "Usage: " << argv[0] << " " << Koala::Benchmark::USAGE
+            << " <algorithm> <width> <height> [depth] [capacity] [seed] [block]" << std::endl;
+        return 1;
+    }
+    Koala::Benchmark::Harness harness(options);
+    const auto &algorithm = options.positional[0];
+    auto argument = [&](NetworKit::index i, NetworKit::count value) {
+        return options.positional.size() > i ? std::stoull(options.positional[i]) : value;
+    };
+    NetworKit::count width = argument(1, 0), height = argument(2, 0), depth = argument(3, 1);
+    NetworKit::count capacity = argument(4, 1000), block = argument(6, 32);
+    uint64_t seed = argument(5, 0);
+    Koala::SegmentationFlowNetworkGenerator generator(width, height, depth, capacity, seed);
+    Koala::GridNetwork network(width, height, depth);
+    generator.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        network.addArc(u, v, static_cast<int64_t>(w));
+    });
+    std::string input = "segmentation " + std::to_string(width) + "x" + std::to_string(height)
+        + "x" + std::to_string(depth);
+
+    std::set<std::optional<std::string>> T;
+    int selected = ALGORITHM.contains(algorithm) ? ALGORITHM[algorithm] : -1;
+    if (selected == 0 || selected == 1) {
+        T.insert(run_algorithm<Koala::BoykovKolmogorovGridMaximumFlow>(
+            harness, input, "BK", network));
+    }
+    if (selected == 0 || selected == 2) {
+        T.insert(run_algorithm<Koala::PushRelabelGridMaximumFlow>(
+            harness, input, "PushRelabel", network, block));
+    }
+    if (selected == 0 || selected == 3) {
+        auto G = network.toGraph();
+        T.insert(harness.measure(input, "Dinic", [&] {
+            auto maximum_flow = Koala::DinicMaximumFlow<int64_t>(G, 0, 1);
+            maximum_flow.run();
+            return maximum_flow;
+        }, [](Koala::DinicMaximumFlow<int64_t> &maximum_flow) {
+            return maximum_flow.getFlowSize();
+        }));
+    }
+    if (selected == -1) {
+        std::cerr << "Unknown algorithm: " << algorithm << std::endl;
+        return 1;
+    }
+    T.erase(std::nullopt);
+    assert(T.size() <= 1);
+    return 0;
+}
@@ -0,0 +1 @@
+echo "benchmarkGridMaximumFlow.sh $@"
@@ -2,30 +2,74 @@
 #include <iostream>
 #include <map>
 
+#include <base/Portfolio.hpp>
 #include <io/G6GraphReader.hpp>
 #include <io/DimacsGraphReader.hpp>
 #include <independent_set/IndependentSet.hpp>
 
-#define PRINT 1
+#include "Benchmark.hpp"
 
 template <typename T>
-int run_algorithm(NetworKit::Graph &G) {
-    auto algorithm = T(G);
-    algorithm.run();
-    auto &independent_set = algorithm.getIndependentSet();
-    std::cout << independent_set.size() << " " << std::flush;
-    return independent_set.size();
+std::optional<std::string> run_algorithm(
+        Koala::Benchmark::Harness &harness, const std::string &input, const std::string &name,
+        NetworKit::Graph &G) {
+    return harness.measure(input, name, [&] {
+        auto algorithm = T(G);
+        algorithm.run();
+        return algorithm;
+    }, [](T &algorithm) {
+        algorithm.check();
+        return algorithm.getIndependentSet().size();
+    });
+}
+
+// races the fastest exact algorithms and reports the first proven answer
+std::optional<std::string> run_portfolio(
+        Koala::Benchmark::Harness &harness, const std::string &input, const std::string &name,
+        NetworKit::Graph &G) {
+    using Portfolio = Koala::Portfolio<
+        Koala::Mis3IndependentSet, Koala::Mis5IndependentSet,
+        Koala::MeasureAndConquerIndependentSet>;
+    return harness.measure(input, name, [&] {
+        auto algorithm = Portfolio(Koala::borrow(G));
+        algorithm.run();
+        return algorithm;
+    }, [](Portfolio &algorithm) {
+        return algorithm.visit([](const Koala::IndependentSet &winner) {
+            winner.check();
+            return winner.getIndependentSet().size();
+        });
+    });
 }
 
 std::map<std::string, int> ALGORITHM = {
     { "exact", 0 },
     { "bruteforce", 1 }, { "MIS1", 2 }, { "MIS2", 3 }, { "MIS3", 4 }, { "MIS4", 5 },
-    { "MIS5", 6 }, { "MeasureAndConquer", 7 }
+    { "MIS5", 6 }, { "MeasureAndConquer", 7 }, { "portfolio", 8 }
 };
 
-void run_g6_tests(const std::string &path, const std::string &algorithm) {
+std::optional<std::string> run_all(
+        Koala::Benchmark::Harness &harness, const std::string &input, NetworKit::Graph &G) {
+    std::set<std::optional<std::string>> I;
+    I.insert(run_algorithm<Koala::BruteForceIndependentSet>(harness, input, "bruteforce", G));
+    I.insert(run_algorithm<Koala::Mis1IndependentSet>(harness, input, "MIS1", G));
+    I.insert(run_algorithm<Koala::Mis2IndependentSet>(harness, input, "MIS2", G));
+    I.insert(run_algorithm<Koala::Mis3IndependentSet>(harness, input, "MIS3", G));
+    I.insert(run_algorithm<Koala::Mis4IndependentSet>(harness, input, "MIS4", G));
+    I.insert(run_algorithm<Koala::Mis5IndependentSet>(harness, input, "MIS5", G));
+    I.insert(run_algorithm<Koala::MeasureAndConquerIndependentSet>(
+        harness, input, "MeasureAndConquer", G));
+    I.insert(run_portfolio(harness, input, "portfolio", G));
+    I.erase(std::nullopt);
+    assert(I.size() <= 1);
+    return I.empty() ? std::nullopt : *I.begin();
+}
+
+void run_g6_tests(
+        Koala::Benchmark::Harness &harness, const std::string &path, const std::string &algorithm,
+        std::ostream &out) {
     std::fstream file(path, std::fstream::in);
-    std::map<int, int> classification;
+    std::map<std::string, int> classification;
     while (true) {
         std::string line;
         file >> line;
@@ -33,51 +77,47 @@ void run_g6_tests(const std::string &path, const std::string &algorithm) {
             break;
         }
         NetworKit::Graph G = Koala::G6GraphReader().readline(line);
-        std::set<int> I;
-        std::cout << line << " " << std::flush;
         switch (ALGORITHM[algorithm]) {
         case 0:
-            I.insert(run_algorithm<Koala::BruteForceIndependentSet>(G));
-            I.insert(run_algorithm<Koala::Mis1IndependentSet>(G));
-            I.insert(run_algorithm<Koala::Mis2IndependentSet>(G));
-            I.insert(run_algorithm<Koala::Mis3IndependentSet>(G));
-            I.insert(run_algorithm<Koala::Mis4IndependentSet>(G));
-            I.insert(run_algorithm<Koala::Mis5IndependentSet>(G));
-            I.insert(run_algorithm<Koala::MeasureAndConquerIndependentSet>(G));
-            assert(I.size() == 1);
-            classification[*I.begin()]++;
+            if (auto size = run_all(harness, line, G)) {
+                classification[*size]++;
+            }
             break;
         case 1:
-            run_algorithm<Koala::BruteForceIndependentSet>(G);
+            run_algorithm<Koala::BruteForceIndependentSet>(harness, line, algorithm, G);
             break;
         case 2:
-            run_algorithm<Koala::Mis1IndependentSet>(G);
+            run_algorithm<Koala::Mis1IndependentSet>(harness, line, algorithm, G);
             break;
         case 3:
-            run_algorithm<Koala::Mis2IndependentSet>(G);
+            run_algorithm<Koala::Mis2IndependentSet>(harness, line, algorithm, G);
             break;
         case 4:
-            run_algorithm<Koala::Mis3IndependentSet>(G);
+            run_algorithm<Koala::Mis3IndependentSet>(harness, line, algorithm, G);
             break;
         case 5:
-            run_algorithm<Koala::Mis4IndependentSet>(G);
+            run_algorithm<Koala::Mis4IndependentSet>(harness, line, algorithm, G);
             break;
         case 6:
-            run_algorithm<Koala::Mis5IndependentSet>(G);
+            run_algorithm<Koala::Mis5IndependentSet>(harness, line, algorithm, G);
             break;
         case 7:
-            run_algorithm<Koala::MeasureAndConquerIndependentSet>(G);
+            run_algorithm<Koala::MeasureAndConquerIndependentSet>(harness, line, algorithm, G);
+            break;
+        case 8:
+            run_portfolio(harness, line, algorithm, G);
             break;
         }
-        std::cout << std::endl;
     }
-    std::cout << "List of graphs counted by solution size:" << std::endl;
-    for (const auto &[k, v] : classification) {
-        std::cout << k << ": " << v << std::endl;
+    if (!classification.empty()) {
+        out << "List of graphs counted by solution size:" << std::endl;
+        for (const auto &[k, v] : classification) {
+            out << k << ": " << v << std::endl;
+        }
     }
 }
 
-void run_dimacs_tests(const std::string &path, const std::string &algorithm) {
+void run_dimacs_tests(Koala::Benchmark::Harness &harness, const std::string &path) {
     auto G_directed = Koala::DimacsGraphReader().read(path);
     NetworKit::Graph G = NetworKit::Graph(G_directed.numberOfNodes(), true, false);
     G_directed.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
@@ -85,31 +125,24 @@ void run_dimacs_tests(const std::string &path, const std::string &algorithm) {
             G.addEdge(u, v);
         }
     });
-    std::cout << path << " " << std::flush;
-    std::set<int> I;
-    I.insert(run_algorithm<Koala::BruteForceIndependentSet>(G));
-    I.insert(run_algorithm<Koala::Mis1IndependentSet>(G));
-    I.insert(run_algorithm<Koala::Mis2IndependentSet>(G));
-    I.insert(run_algorithm<Koala::Mis3IndependentSet>(G));
-    I.insert(run_algorithm<Koala::Mis4IndependentSet>(G));
-    I.insert(run_algorithm<Koala::Mis5IndependentSet>(G));
-    I.insert(run_algorithm<Koala::MeasureAndConquerIndependentSet>(G));
-    assert(I.size() == 1);
-    std::cout << std::endl;
-    return;
+    run_all(harness, path, G);
 }
 
 int main(int argc, const char *argv[]) {
-    if (argc != 3) {
-        std::cerr << "Usage: " << argv[0] << " <algorithm> <file>" << std::endl;
+    auto options = Koala::Benchmark::parse(argc, argv);
+    if (options.positional.size() != 2) {
+        std::cerr << "Usage: " << argv[0] << " " << Koala::Benchmark::USAGE
+            << " <algorithm> <file>" << std::endl;
         return 1;
     }
-    std::string path(argv[2]);
+    auto &out = options.format == Koala::Benchmark::Format::TEXT ? std::cout : std::cerr;
+    Koala::Benchmark::Harness harness(options);
+    std::string path(options.positional[1]);
     auto position = path.find_last_of(".");
     if (path.substr(position + 1) == "g6") {
-        run_g6_tests(path, std::string(argv[1]));
+        run_g6_tests(harness, path, options.positional[0], out);
     } else if (path.substr(position + 1) == "gr") {
-        run_dimacs_tests(path, std::string(argv[1]));
+        run_dimacs_tests(harness, path);
     } else {
         std::cerr << "File type not supported: " << path << std::endl;
     }
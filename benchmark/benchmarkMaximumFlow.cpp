@@ -3,22 +3,47 @@
 #include <iostream>
 #include <map>
 
+#include <flow/DinicMaximumFlow.hpp>
 #include <flow/MaximumFlow.hpp>
+#include <flow/PreprocessedMaximumFlow.hpp>
 #include <io/DimacsGraphReader.hpp>
 
+#include "Benchmark.hpp"
+
+template <typename T>
+void run_algorithm(
+        Koala::Benchmark::Harness &harness, const std::string &input, const std::string &name,
+        NetworKit::Graph &G, NetworKit::node s, NetworKit::node t) {
+    harness.measure(input, name, [&] {
+        auto maximum_flow = T(G, s, t);
+        maximum_flow.run();
+        return maximum_flow;
+    }, [](T &maximum_flow) {
+        if constexpr (requires { maximum_flow.check(); }) {
+            maximum_flow.check();
+        }
+        return maximum_flow.getFlowSize();
+    });
+}
+
 int main(int argc, char **argv) {
-    if (argc == 1) {
-        std::cout << "Filename is empty" << std::endl;
-        return 0;
+    auto options = Koala::Benchmark::parse(argc, argv);
+    if (options.positional.empty()) {
+        std::cerr << "Usage: " << argv[0] << " " << Koala::Benchmark::USAGE << " <file>..."
+            << std::endl;
+        return 1;
     }
-    std::string path(argv[1]);
-    if (!std::filesystem::exists(path)) {
-        std::cout << "File " << path << " does not exist" << std::endl;
-        return 0;
+    Koala::Benchmark::Harness harness(options);
+    for (const auto &path : options.positional) {
+        if (!std::filesystem::exists(path)) {
+            std::cerr << "File " << path << " does not exist" << std::endl;
+            continue;
+        }
+        auto [G, s, t] = Koala::DimacsGraphReader().read_all(path);
+        run_algorithm<Koala::KingRaoTarjanMaximumFlow>(harness, path, "KRT", G, s, t);
+        run_algorithm<Koala::DinicMaximumFlow<int64_t>>(harness, path, "Dinic", G, s, t);
+        run_algorithm<Koala::PreprocessedMaximumFlow<Koala::DinicMaximumFlow<int64_t>>>(
+            harness, path, "Dinic+preprocessing", G, s, t);
     }
-    auto [G, s, t] = Koala::DimacsGraphReader().read_all(path);
-    auto maximum_flow = Koala::KingRaoTarjanMaximumFlow(G, s, t);
-    maximum_flow.run();
-    std::cout << path << " has maximum flow of size " << maximum_flow.getFlowSize() << std::endl;
     return 0;
 }
@@ -1,32 +1,60 @@
 #include <cassert>
 #include <iostream>
 #include <map>
+#include <random>
 #include <set>
 
 #include <networkit/graph/GraphTools.hpp>
 
+#include <generator/GraphGenerator.hpp>
 #include <io/G6GraphReader.hpp>
 #include <io/DimacsGraphReader.hpp>
 #include <mst/MinimumSpanningTree.hpp>
+#include <mst/SemiExternalMinimumSpanningTree.hpp>
 
-template <typename T>
-NetworKit::edgeweight run_algorithm(NetworKit::Graph &G) {
-    auto algorithm = T(G);
-    algorithm.run();
-    auto &spanning_tree = algorithm.getForest();
-    std::cout << spanning_tree.totalEdgeWeight() << " " << std::flush;
-    algorithm.check();
-    return spanning_tree.totalEdgeWeight();
+#include "Benchmark.hpp"
+
+template <typename T, typename... Args>
+std::optional<std::string> run_algorithm(
+        Koala::Benchmark::Harness &harness, const std::string &input, const std::string &name,
+        NetworKit::Graph &G, Args... args) {
+    return harness.measure(input, name, [&] {
+        auto algorithm = T(G, args...);
+        algorithm.run();
+        return algorithm;
+    }, [](T &algorithm) {
+        algorithm.check();
+        return algorithm.getForest().totalEdgeWeight();
+    });
 }
 
 std::map<std::string, int> ALGORITHM = {
     { "exact", 0 },
-    { "Kruskal", 1 }, { "Prim", 2 }, { "Boruvka", 3 }, { "KKT", 4 }
+    { "Kruskal", 1 }, { "Prim", 2 }, { "Boruvka", 3 }, { "KKT", 4 }, { "KruskalComparison", 5 },
+    { "FredmanTarjan", 6 }
 };
 
-void run_g6_tests(const std::string &path, const std::string &algorithm) {
+void run_all(Koala::Benchmark::Harness &harness, const std::string &input, NetworKit::Graph &G) {
+    std::set<std::optional<std::string>> T;
+    T.insert(run_algorithm<Koala::KruskalMinimumSpanningTree>(harness, input, "Kruskal", G));
+    T.insert(run_algorithm<Koala::KruskalMinimumSpanningTree>(
+        harness, input, "KruskalComparison", G,
+        Koala::KruskalMinimumSpanningTree::Sorting::COMPARISON));
+    T.insert(run_algorithm<Koala::PrimMinimumSpanningTree>(harness, input, "Prim", G));
+    T.insert(run_algorithm<Koala::BoruvkaMinimumSpanningTree>(harness, input, "Boruvka", G));
+    T.insert(run_algorithm<Koala::FredmanTarjanMinimumSpanningTree>(
+        harness, input, "FredmanTarjan", G));
+    for (int i = 0; i < 5; i++) {
+        T.insert(run_algorithm<Koala::KargerKleinTarjanMinimumSpanningTree>(
+            harness, input, "KKT", G));
+    }
+    T.erase(std::nullopt);
+    assert(T.size() <= 1);
+}
+
+void run_g6_tests(
+        Koala::Benchmark::Harness &harness, const std::string &path, const std::string &algorithm) {
     std::fstream file(path, std::fstream::in);
-    std::map<int, int> classification;
     while (true) {
         std::string line;
         file >> line;
@@ -40,33 +68,36 @@ void run_g6_tests(const std::string &path, const std::string &algorithm) {
                 G.addEdge(u, v);
             }
         });
-        std::set<NetworKit::edgeweight> T;
-        std::cout << line << " " << std::flush;
         switch (ALGORITHM[algorithm]) {
         case 0:
-            T.insert(run_algorithm<Koala::KruskalMinimumSpanningTree>(G));
-            T.insert(run_algorithm<Koala::PrimMinimumSpanningTree>(G));
-            T.insert(run_algorithm<Koala::BoruvkaMinimumSpanningTree>(G));
-            for (int i = 0; i < 5; i++) {
-                T.insert(run_algorithm<Koala::KargerKleinTarjanMinimumSpanningTree>(G));
-            }
-            assert(T.size() == 1);
+            run_all(harness, line, G);
             break;
         case 1:
-            run_algorithm<Koala::KruskalMinimumSpanningTree>(G);
+            run_algorithm<Koala::KruskalMinimumSpanningTree>(harness, line, algorithm, G);
             break;
         case 2:
-            run_algorithm<Koala::PrimMinimumSpanningTree>(G);
+            run_algorithm<Koala::PrimMinimumSpanningTree>(harness, line, algorithm, G);
             break;
         case 3:
-            run_algorithm<Koala::BoruvkaMinimumSpanningTree>(G);
+            run_algorithm<Koala::BoruvkaMinimumSpanningTree>(harness, line, algorithm, G);
+            break;
+        case 4:
+            run_algorithm<Koala::KargerKleinTarjanMinimumSpanningTree>(
+                harness, line, algorithm, G);
+            break;
+        case 5:
+            run_algorithm<Koala::KruskalMinimumSpanningTree>(
+                harness, line, algorithm, G,
+                Koala::KruskalMinimumSpanningTree::Sorting::COMPARISON);
+            break;
+        case 6:
+            run_algorithm<Koala::FredmanTarjanMinimumSpanningTree>(harness, line, algorithm, G);
             break;
         }
-        std::cout << std::endl;
     }
 }
 
-void run_dimacs_tests(const std::string &path, const std::string &algorithm) {
+void run_dimacs_tests(Koala::Benchmark::Harness &harness, const std::string &path) {
     auto G_directed = Koala::DimacsGraphReader().read(path);
     auto G = NetworKit::Graph(G_directed.numberOfNodes(), true, false);
     G_directed.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
@@ -74,30 +105,54 @@ void run_dimacs_tests(const std::string &path, const std::string &algorithm) {
             G.addEdge(u, v, w);
         }
     });
-    std::cout << path << " " << std::flush;
-    std::set<NetworKit::edgeweight> T;
-    T.insert(run_algorithm<Koala::KruskalMinimumSpanningTree>(G));
-    T.insert(run_algorithm<Koala::PrimMinimumSpanningTree>(G));
-    T.insert(run_algorithm<Koala::BoruvkaMinimumSpanningTree>(G));
-    for (int i = 0; i < 5; i++) {
-        T.insert(run_algorithm<Koala::KargerKleinTarjanMinimumSpanningTree>(G));
-    }
-    assert(T.size() == 1);
-    std::cout << std::endl;
-    return;
+    run_all(harness, path, G);
+}
+
+void run_edge_list_tests(Koala::Benchmark::Harness &harness, const std::string &path) {
+    // the edges are never loaded into a graph, so only the semi-external algorithm applies
+    harness.measure(path, "SemiExternal", [&] {
+        auto algorithm = Koala::SemiExternalMinimumSpanningTree(path, path + ".forest");
+        algorithm.run();
+        return algorithm;
+    }, [](Koala::SemiExternalMinimumSpanningTree &algorithm) {
+        return algorithm.getForestWeight();
+    });
+}
+
+void run_dense_tests(
+        Koala::Benchmark::Harness &harness, NetworKit::count n, double p, uint64_t seed) {
+    // the dense random graphs with distinct random weights, where the heap-based algorithms win
+    auto G_unweighted = Koala::ErdosRenyiGenerator(n, p, false, seed).generate();
+    auto G = NetworKit::Graph(n, true, false);
+    std::mt19937_64 generator(seed);
+    G_unweighted.forEdges([&](NetworKit::node u, NetworKit::node v) {
+        G.addEdge(u, v, static_cast<NetworKit::edgeweight>(generator() % 1000000000));
+    });
+    run_all(harness, "ER " + std::to_string(n) + " " + std::to_string(p), G);
 }
 
 int main(int argc, const char *argv[]) {
-    if (argc != 3) {
-        std::cerr << "Usage: " << argv[0] << " <algorithm> <file>" << std::endl;
+    auto options = Koala::Benchmark::parse(argc, argv);
+    if (options.positional.size() < 2 || options.positional.size() > 5) {
+        std::cerr << "Usage: " << argv[0] << " " << Koala::Benchmark::USAGE
+            << " <algorithm> (<file> | ER <nodes> <probability> [seed])" << std::endl;
         return 1;
     }
-    std::string path(argv[2]);
+    Koala::Benchmark::Harness harness(options);
+    std::string path(options.positional[1]);
+    if (path == "ER" && options.positional.size() >= 4) {
+        uint64_t seed = options.positional.size() == 5 ? std::stoull(options.positional[4]) : 0;
+        run_dense_tests(
+            harness, std::stoull(options.positional[2]), std::stod(options.positional[3]), seed);
+        return 0;
+    }
     auto position = path.find_last_of(".");
     if (path.substr(position + 1) == "g6") {
-        run_g6_tests(path, std::string(argv[1]));
+        run_g6_tests(harness, path, options.positional[0]);
     } else if (path.substr(position + 1) == "gr") {
-        run_dimacs_tests(path, std::string(argv[1]));
+        run_dimacs_tests(harness, path);
+    } else if (path.substr(position + 1) == "el") {
+        run_edge_list_tests(harness, path);
     } else {
         std::cerr << "File type not supported: " << path << std::endl;
     }
@@ -6,8 +6,17 @@
 #include <io/G6GraphReader.hpp>
 #include <recognition/PerfectGraphRecognition.hpp>
 
-int main() {
-    std::map<Koala::PerfectGraphRecognition::State, int> classification;
+#include "Benchmark.hpp"
+
+int main(int argc, char **argv) {
+    auto options = Koala::Benchmark::parse(argc, argv);
+    if (!options.positional.empty()) {
+        std::cerr << "Usage: " << argv[0] << " " << Koala::Benchmark::USAGE << " < graphs.g6"
+            << std::endl;
+        return 1;
+    }
+    Koala::Benchmark::Harness harness(options);
+    std::map<std::string, int> classification;
     std::string types[] = {
         "UNKNOWN",
         "PERFECT",
@@ -26,18 +35,36 @@ int main() {
             break;
         }
         NetworKit::Graph G = Koala::G6GraphReader().readline(line);
-        auto recognize = Koala::PerfectGraphRecognition(G);
-        recognize.run();
-        classification[recognize.getState()]++;
-        recognize.check();
-        if (recognize.getState() == Koala::PerfectGraphRecognition::State::PERFECT) {
-            auto color = Koala::PerfectGraphVertexColoring(G);
-            color.run();
-            color.check();
+        auto state = harness.measure(line, "recognition", [&] {
+            auto recognize = Koala::PerfectGraphRecognition(G);
+            recognize.run();
+            return recognize;
+        }, [&](Koala::PerfectGraphRecognition &recognize) {
+            recognize.check();
+            return types[static_cast<int>(recognize.getState())];
+        });
+        if (!state) {
+            continue;
+        }
+        classification[*state]++;
+        if (*state == "PERFECT") {
+            harness.measure(line, "coloring", [&] {
+                auto color = Koala::PerfectGraphVertexColoring(G);
+                color.run();
+                return color;
+            }, [](Koala::PerfectGraphVertexColoring &color) {
+                color.check();
+                int max_color = 0;
+                for (const auto &[v, c] : color.getColoring()) {
+                    max_color = std::max(max_color, c);
+                }
+                return max_color;
+            });
         }
     }
+    auto &out = options.format == Koala::Benchmark::Format::TEXT ? std::cout : std::cerr;
     for (const auto &[k, v] : classification) {
-        std::cout << types[static_cast<int>(k)] << ": " << v << std::endl;
+        out << k << ": " << v << std::endl;
     }
     return 0;
 }
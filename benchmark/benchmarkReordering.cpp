@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <random>
+#include <set>
+#include <vector>
+
+#include <coloring/GreedyVertexColoring.hpp>
+#include <generator/GraphGenerator.hpp>
+#include <io/DimacsGraphReader.hpp>
+#include <mst/MinimumSpanningTree.hpp>
+#include <profiling/Profiler.hpp>
+#include <reordering/VertexReordering.hpp>
+
+#include "Benchmark.hpp"
+
+// The average of log2(1 + |u - v|) over the edges, i.e. the number of bits of the distance between
+// the adjacency lists, a hardware-independent proxy of the cache misses of the traversals.
+double average_log_gap(const NetworKit::Graph &G) {
+    double total = 0.0;
+    G.forEdges([&](NetworKit::node u, NetworKit::node v) {
+        total += std::log2(1.0 + static_cast<double>(u > v ? u - v : v - u));
+    });
+    return G.numberOfEdges() > 0 ? total / static_cast<double>(G.numberOfEdges()) : 0.0;
+}
+
+NetworKit::count breadth_first_sweep(const NetworKit::Graph &G) {
+    std::vector<bool> visited(G.upperNodeIdBound(), false);
+    std::vector<NetworKit::node> queue;
+    NetworKit::count components = 0;
+    G.forNodes([&](NetworKit::node s) {
+        if (visited[s]) {
+            return;
+        }
+        components++;
+        visited[s] = true;
+        queue.assign(1, s);
+        for (NetworKit::index i = 0; i < queue.size(); i++) {
+            G.forNeighborsOf(queue[i], [&](NetworKit::node v) {
+                if (!visited[v]) {
+                    visited[v] = true;
+                    queue.push_back(v);
+                }
+            });
+        }
+    });
+    return components;
+}
+
+// The last-level cache read misses of a single execution of the body, counted by the hardware
+// counters of the profiler on the calling thread, if they are available.
+template <typename Body>
+std::optional<uint64_t> llc_misses(Body body) {
+    Koala::Profiling::Profile profile;
+    {
+        Koala::Profiling::ProfileScope scope(profile, true);
+        Koala::Profiling::ScopedRegion region("workload");
+        body();
+    }
+    const auto &statistics = profile.getRegions().at("workload");
+    if (!statistics.has_counters) {
+        return std::nullopt;
+    }
+    return statistics.get(Koala::Profiling::Counter::LLC_MISSES);
+}
+
+// The cache statistics go to the standard error, so that they do not break the csv or json output.
+template <typename Body>
+void report_llc_misses(const std::string &input, const std::string &algorithm, Body body) {
+    auto misses = llc_misses(body);
+    std::cerr << input << " " << algorithm << " LLC read misses ";
+    if (misses) {
+        std::cerr << *misses << std::endl;
+    } else {
+        std::cerr << "unavailable" << std::endl;
+    }
+}
+
+void run_workloads(
+        Koala::Benchmark::Harness &harness, const std::string &input, const std::string &order,
+        const NetworKit::Graph &G) {
+    std::cerr << input << " " << order << " average log gap " << std::fixed
+        << std::setprecision(3) << average_log_gap(G) << std::endl;
+    auto bfs = [&] {
+        return breadth_first_sweep(G);
+    };
+    harness.measure(input, order + " BFS", bfs, [](NetworKit::count components) {
+        return components;
+    });
+    report_llc_misses(input, order + " BFS", bfs);
+    auto kruskal = [&] {
+        auto algorithm = Koala::KruskalMinimumSpanningTree(Koala::borrow(G));
+        algorithm.run();
+        return algorithm;
+    };
+    harness.measure(input, order + " Kruskal", kruskal,
+        [](Koala::KruskalMinimumSpanningTree &algorithm) {
+            return algorithm.getForest().totalEdgeWeight();
+        });
+    report_llc_misses(input, order + " Kruskal", kruskal);
+    auto smallest_last = [&] {
+        auto algorithm = Koala::SmallestLastVertexColoring(Koala::borrow(G));
+        algorithm.run();
+        return algorithm;
+    };
+    harness.measure(input, order + " SmallestLast", smallest_last,
+        [](Koala::SmallestLastVertexColoring &algorithm) {
+            std::set<int> colors;
+            for (const auto &[v, color] : algorithm.getColoring()) {
+                colors.insert(color);
+            }
+            return colors.size();
+        });
+    report_llc_misses(input, order + " SmallestLast", smallest_last);
+}
+
+template <typename T>
+void run_reordering(
+        Koala::Benchmark::Harness &harness, const std::string &input, const std::string &name,
+        const NetworKit::Graph &G) {
+    harness.measure(input, name, [&] {
+        auto reordering = T(Koala::borrow(G));
+        reordering.run();
+        return reordering;
+    }, [](T &reordering) {
+        reordering.check();
+        return reordering.getReorderedGraph().numberOfEdges();
+    });
+    // the measured runs may happen in a forked child, so the reordered graph is built once more
+    auto reordering = T(Koala::borrow(G));
+    reordering.run();
+    run_workloads(harness, input, name, reordering.getReorderedGraph());
+}
+
+std::map<std::string, int> ALGORITHM = {
+    { "all", 0 },
+    { "DegreeSort", 1 }, { "BFS", 2 }, { "RCM", 3 }, { "Gorder", 4 }
+};
+
+// the generated graphs are relabelled at random, as the real inputs rarely come in a local order
+NetworKit::Graph shuffle(const NetworKit::Graph &G, uint64_t seed) {
+    std::vector<NetworKit::node> label(G.upperNodeIdBound());
+    for (NetworKit::node v = 0; v < label.size(); v++) {
+        label[v] = v;
+    }
+    std::mt19937_64 generator(seed);
+    std::shuffle(label.begin(), label.end(), generator);
+    NetworKit::Graph H(G.upperNodeIdBound(), true, false);
+    G.forEdges([&](NetworKit::node u, NetworKit::node v) {
+        H.addEdge(label[u], label[v], static_cast<NetworKit::edgeweight>(generator() % 1000 + 1));
+    });
+    return H;
+}
+
+int main(int argc, const char *argv[]) {
+    auto options = Koala::Benchmark::parse(argc, argv);
+    if (options.positional.size() < 2 || options.positional.size() > 5) {
+        std::cerr << "Usage: " << argv[0] << " " << Koala::Benchmark::USAGE
+            << " <reordering> (<file> | ER <nodes> <probability> [seed]"
+            << " | RMAT <scale> <edge factor> [seed])" << std::endl;
+        return 1;
+    }
+    Koala::Benchmark::Harness harness(options);
+    const auto &algorithm = options.positional[0];
+    std::string path(options.positional[1]), input = path;
+    uint64_t seed = options.positional.size() == 5 ? std::stoull(options.positional[4]) : 0;
+    NetworKit::Graph G;
+    if (path == "ER" && options.positional.size() >= 4) {
+        G = shuffle(Koala::ErdosRenyiGenerator(
+            std::stoull(options.positional[2]), std::stod(options.positional[3]), false, seed)
+                .generate(), seed);
+        input += " " + options.positional[2] + " " + options.positional[3];
+    } else if (path == "RMAT" && options.positional.size() >= 4) {
+        G = shuffle(Koala::RmatGenerator(
+            std::stoull(options.positional[2]), std::stoull(options.positional[3]), 0.57, 0.19,
+            0.19, seed).generate(), seed);
+        input += " " + options.positional[2] + " " + options.positional[3];
+    } else if (path.substr(path.find_last_of(".") + 1) == "gr") {
+        auto G_directed = Koala::DimacsGraphReader().read(path);
+        G = NetworKit::Graph(G_directed.numberOfNodes(), true, false);
+        G_directed.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+            if (!G.hasEdge(u, v) && !G.hasEdge(v, u) && w > 0) {
+                G.addEdge(u, v, w);
+            }
+        });
+    } else {
+        std::cerr << "File type not supported: " << path << std::endl;
+        return 1;
+    }
+
+    int selected = ALGORITHM.contains(algorithm) ? ALGORITHM[algorithm] : -1;
+    if (selected == -1) {
+        std::cerr << "Unknown reordering: " << algorithm << std::endl;
+        return 1;
+    }
+    run_workloads(harness, input, "original", G);
+    if (selected == 0 || selected == 1) {
+        run_reordering<Koala::DegreeSortReordering>(harness, input, "DegreeSort", G);
+    }
+    if (selected == 0 || selected == 2) {
+        run_reordering<Koala::BFSReordering>(harness, input, "BFS", G);
+    }
+    if (selected == 0 || selected == 3) {
+        run_reordering<Koala::ReverseCuthillMcKeeReordering>(harness, input, "RCM", G);
+    }
+    if (selected == 0 || selected == 4) {
+        run_reordering<Koala::GorderReordering>(harness, input, "Gorder", G);
+    }
+    return 0;
+}
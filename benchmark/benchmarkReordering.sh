@@ -0,0 +1 @@
+echo "benchmarkReordering.sh $@"
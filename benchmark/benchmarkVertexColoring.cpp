@@ -2,37 +2,74 @@
 #include <iostream>
 #include <map>
 
+#include <base/Portfolio.hpp>
 #include <coloring/ExactVertexColoring.hpp>
 #include <coloring/GreedyVertexColoring.hpp>
 #include <coloring/PerfectGraphVertexColoring.hpp>
 #include <io/G6GraphReader.hpp>
 
+#include "Benchmark.hpp"
+
 template <typename T>
-int run_algorithm(NetworKit::Graph &G) {
-    auto algorithm = T(G);
-    algorithm.run();
-    auto colors = algorithm.getColoring();
-    G.forEdges([&](NetworKit::node u, NetworKit::node v) { assert(colors[u] != colors[v]); });
-    int max_color = 0;
-    for (const auto& [v, c] : colors) {
-        max_color = std::max(max_color, c);
-    }
-    std::cout << max_color << " " << std::flush;
-    return max_color;
+std::optional<std::string> run_algorithm(
+        Koala::Benchmark::Harness &harness, const std::string &input, const std::string &name,
+        NetworKit::Graph &G) {
+    return harness.measure(input, name, [&] {
+        auto algorithm = T(G);
+        algorithm.run();
+        return algorithm;
+    }, [&](T &algorithm) {
+        auto colors = algorithm.getColoring();
+        G.forEdges([&](NetworKit::node u, NetworKit::node v) { assert(colors[u] != colors[v]); });
+        int max_color = 0;
+        for (const auto& [v, c] : colors) {
+            max_color = std::max(max_color, c);
+        }
+        return max_color;
+    });
+}
+
+// races the exact algorithms and reports the first proven answer
+std::optional<std::string> run_portfolio(
+        Koala::Benchmark::Harness &harness, const std::string &input, const std::string &name,
+        NetworKit::Graph &G) {
+    using Portfolio = Koala::Portfolio<
+        Koala::BrownEnumerationVertexColoring, Koala::ChristofidesEnumerationVertexColoring,
+        Koala::BrelazEnumerationVertexColoring, Koala::KormanEnumerationVertexColoring>;
+    return harness.measure(input, name, [&] {
+        auto algorithm = Portfolio(Koala::borrow(G));
+        algorithm.run();
+        return algorithm;
+    }, [&](Portfolio &algorithm) {
+        auto colors = algorithm.visit([](const Koala::EnumerationVertexColoring &winner) {
+            return winner.getColoring();
+        });
+        G.forEdges([&](NetworKit::node u, NetworKit::node v) { assert(colors[u] != colors[v]); });
+        int max_color = 0;
+        for (const auto& [v, c] : colors) {
+            max_color = std::max(max_color, c);
+        }
+        return max_color;
+    });
 }
 
 std::map<std::string, int> ALGORITHM = {
     { "exact", 0 },
     { "RS", 1 }, { "LF", 2 }, { "SL", 3 }, { "SLF", 4 }, { "GIS", 5 },
     { "Brown", 10 }, { "Christofides", 11 }, { "Brelaz", 12 }, { "Korman", 13 },
+    { "portfolio", 14 },
     { "perfect", 20 }
 };
 
 int main(int argc, char **argv) {
-    if (argc != 2) {
-        std::cerr << "Usage: " << argv[0] << " <algorithm>" << std::endl;
+    auto options = Koala::Benchmark::parse(argc, argv);
+    if (options.positional.size() != 1) {
+        std::cerr << "Usage: " << argv[0] << " " << Koala::Benchmark::USAGE << " <algorithm>"
+            << std::endl;
         return 1;
     }
+    Koala::Benchmark::Harness harness(options);
+    const std::string &algorithm = options.positional[0];
     while (true) {
         std::string line;
         std::cin >> line;
@@ -40,48 +77,56 @@ int main(int argc, char **argv) {
             break;
         }
         NetworKit::Graph G = Koala::G6GraphReader().readline(line);
-        std::set<int> C;
-        std::cout << line << " " << std::flush;
-        switch (ALGORITHM[std::string(argv[1])]) {
+        std::set<std::optional<std::string>> C;
+        switch (ALGORITHM[algorithm]) {
         case 0:
-            C.insert(run_algorithm<Koala::BrownEnumerationVertexColoring>(G));
-            C.insert(run_algorithm<Koala::ChristofidesEnumerationVertexColoring>(G));
-            C.insert(run_algorithm<Koala::BrelazEnumerationVertexColoring>(G));
-            C.insert(run_algorithm<Koala::KormanEnumerationVertexColoring>(G));
-            assert(C.size() == 1);
+            C.insert(run_algorithm<Koala::BrownEnumerationVertexColoring>(
+                harness, line, "Brown", G));
+            C.insert(run_algorithm<Koala::ChristofidesEnumerationVertexColoring>(
+                harness, line, "Christofides", G));
+            C.insert(run_algorithm<Koala::BrelazEnumerationVertexColoring>(
+                harness, line, "Brelaz", G));
+            C.insert(run_algorithm<Koala::KormanEnumerationVertexColoring>(
+                harness, line, "Korman", G));
+            C.insert(run_portfolio(harness, line, "portfolio", G));
+            C.erase(std::nullopt);
+            assert(C.size() <= 1);
             break;
         case 1:
-            run_algorithm<Koala::RandomSequentialVertexColoring>(G);
+            run_algorithm<Koala::RandomSequentialVertexColoring>(harness, line, algorithm, G);
             break;
         case 2:
-            run_algorithm<Koala::LargestFirstVertexColoring>(G);
+            run_algorithm<Koala::LargestFirstVertexColoring>(harness, line, algorithm, G);
             break;
         case 3:
-            run_algorithm<Koala::SmallestLastVertexColoring>(G);
+            run_algorithm<Koala::SmallestLastVertexColoring>(harness, line, algorithm, G);
             break;
         case 4:
-            run_algorithm<Koala::SaturatedLargestFirstVertexColoring>(G);
+            run_algorithm<Koala::SaturatedLargestFirstVertexColoring>(harness, line, algorithm, G);
             break;
         case 5:
-            run_algorithm<Koala::GreedyIndependentSetVertexColoring>(G);
+            run_algorithm<Koala::GreedyIndependentSetVertexColoring>(harness, line, algorithm, G);
             break;
         case 10:
-            run_algorithm<Koala::BrownEnumerationVertexColoring>(G);
+            run_algorithm<Koala::BrownEnumerationVertexColoring>(harness, line, algorithm, G);
             break;
         case 11:
-            run_algorithm<Koala::ChristofidesEnumerationVertexColoring>(G);
+            run_algorithm<Koala::ChristofidesEnumerationVertexColoring>(
+                harness, line, algorithm, G);
             break;
         case 12:
-            run_algorithm<Koala::BrelazEnumerationVertexColoring>(G);
+            run_algorithm<Koala::BrelazEnumerationVertexColoring>(harness, line, algorithm, G);
             break;
         case 13:
-            run_algorithm<Koala::KormanEnumerationVertexColoring>(G);
+            run_algorithm<Koala::KormanEnumerationVertexColoring>(harness, line, algorithm, G);
+            break;
+        case 14:
+            run_portfolio(harness, line, algorithm, G);
             break;
         case 20:
-            run_algorithm<Koala::PerfectGraphVertexColoring>(G);
+            run_algorithm<Koala::PerfectGraphVertexColoring>(harness, line, algorithm, G);
             break;
         }
-        std::cout << std::endl;
     }
     return 0;
 }
@@ -0,0 +1,59 @@
+/*
+ * Algorithm.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <base/Algorithm.hpp>
+
+namespace Koala {
+
+void Algorithm::setStopToken(std::stop_token token) {
+    stop_token = std::move(token);
+}
+
+void Algorithm::setDeadline(Clock::time_point deadline) {
+    this->deadline = deadline;
+}
+
+void Algorithm::setTimeLimit(std::chrono::duration<double> limit) {
+    deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(limit);
+}
+
+bool Algorithm::isInterrupted() const {
+    assureFinished();
+    return interrupted;
+}
+
+bool Algorithm::isOptimal() const {
+    assureFinished();
+    return optimal;
+}
+
+const Profiling::Profile& Algorithm::getProfile() const {
+    return profile;
+}
+
+bool Algorithm::isStopRequested() {
+    if (!interrupted) {
+        interrupted = stop_token.stop_requested() || (deadline && Clock::now() >= *deadline);
+    }
+    return interrupted;
+}
+
+bool Algorithm::pollStopRequested() {
+    if (polls++ % POLL_INTERVAL != 0) {
+        return interrupted;
+    }
+    return isStopRequested();
+}
+
+const std::stop_token& Algorithm::getStopToken() const {
+    return stop_token;
+}
+
+const std::optional<Algorithm::Clock::time_point>& Algorithm::getDeadline() const {
+    return deadline;
+}
+
+} /* namespace Koala */
@@ -13,7 +13,17 @@
 namespace Koala {
 
 EnumerationVertexColoring::EnumerationVertexColoring(const NetworKit::Graph& graph)
-    : graph(std::make_optional(graph)) {
+    : EnumerationVertexColoring(std::make_shared<const NetworKit::Graph>(graph)) {
+}
+
+EnumerationVertexColoring::EnumerationVertexColoring(std::shared_ptr<const NetworKit::Graph> graph)
+    : graph(std::move(graph)) {
+}
+
+void EnumerationVertexColoring::setMemoryResource(std::pmr::memory_resource *resource) {
+    // the sets allocated from the previous pool have to go before it
+    feasible_colors.clear();
+    arena = SearchArena(resource);
 }
 
 const std::map<NetworKit::node, int> EnumerationVertexColoring::getColoring() const {
@@ -64,7 +74,9 @@ void EnumerationVertexColoring::backwards() {
 }
 
 void EnumerationVertexColoring::determine_feasible_colors(int i) {
-    std::set<int> feasible_colors_for_node;
+    // the set is refilled in place, so its nodes are recycled by the pool of the algorithm
+    auto &feasible_colors_for_node = feasible_colors[i];
+    feasible_colors_for_node.clear();
     int current_maximal_color = 0;
     for (int j = 0; j < i; ++j) {
         if (current_maximal_color < current_solution[j]) {
@@ -81,7 +93,12 @@ void EnumerationVertexColoring::determine_feasible_colors(int i) {
             feasible_colors_for_node.erase(current_solution[j]);
         }
     }
-    feasible_colors[i] = feasible_colors_for_node;
+}
+
+void EnumerationVertexColoring::resize_feasible_colors() {
+    while (feasible_colors.size() < graph->numberOfNodes()) {
+        feasible_colors.emplace_back(arena.resource());
+    }
 }
 
 std::vector<NetworKit::node> BrownEnumerationVertexColoring::greedy_largest_first_ordering() {
@@ -152,17 +169,18 @@ void BrownEnumerationVertexColoring::determine_current_predecessors(int r) {
 }
 
 void BrownEnumerationVertexColoring::run() {
+    interrupted = false;
     ordering = greedy_largest_first_ordering();
     lower_bound = 1, upper_bound = graph->numberOfNodes();
     r = 0;
     current_bound = upper_bound + 1;
-    feasible_colors.resize(graph->numberOfNodes());
+    resize_feasible_colors();
     feasible_colors[0].insert(1);
     current_solution.resize(graph->numberOfNodes());
 
     while (true) {
         forwards();
-        if (current_bound == lower_bound) {
+        if (current_bound == lower_bound || isStopRequested()) {
             break;
         }
         backwards();
@@ -170,6 +188,7 @@ void BrownEnumerationVertexColoring::run() {
             break;
         }
     }
+    optimal = !interrupted;
     hasRun = true;
 }
 
@@ -214,6 +233,7 @@ ChristofidesEnumerationVertexColoring::getTransitiveClosure() const {
 }
 
 void ChristofidesEnumerationVertexColoring::run() {
+    interrupted = false;
     ordering = greedy_largest_first_ordering();
     lower_bound = 1, upper_bound = graph->numberOfNodes();
     r = 0;
@@ -221,13 +241,13 @@ void ChristofidesEnumerationVertexColoring::run() {
 
     calculate_transitive_closure();
 
-    feasible_colors.resize(graph->numberOfNodes());
+    resize_feasible_colors();
     feasible_colors[0].insert(1);
     current_solution.resize(graph->numberOfNodes());
 
     while (true) {
         forwards();
-        if (current_bound == lower_bound) {
+        if (current_bound == lower_bound || isStopRequested()) {
             break;
         }
         backwards();
@@ -236,6 +256,7 @@ void ChristofidesEnumerationVertexColoring::run() {
         }
     }
 
+    optimal = !interrupted;
     hasRun = true;
 }
 
@@ -452,6 +473,7 @@ void BrelazEnumerationVertexColoring::backwards() {
 }
 
 void BrelazEnumerationVertexColoring::run() {
+    interrupted = false;
     current_solution.resize(graph->numberOfNodes());
     best_solution.resize(graph->numberOfNodes());
 
@@ -461,12 +483,12 @@ void BrelazEnumerationVertexColoring::run() {
         r = 0;
         current_bound = upper_bound;
 
-        feasible_colors.resize(graph->numberOfNodes());
+        resize_feasible_colors();
         feasible_colors[0].insert(1);
 
         while (true) {
             forwards();
-            if (current_bound == lower_bound) {
+            if (current_bound == lower_bound || isStopRequested()) {
                 break;
             }
             backwards();
@@ -475,6 +497,7 @@ void BrelazEnumerationVertexColoring::run() {
             }
         }
     }
+    optimal = !interrupted;
     hasRun = true;
 }
 
@@ -553,8 +576,9 @@ void KormanEnumerationVertexColoring::backwards() {
 }
 
 void KormanEnumerationVertexColoring::determine_feasible_colors(int i,
-std::unordered_set<int> blocked_colors) {
-    std::set<int> feasible_colors_for_node;
+const std::unordered_set<int> &blocked_colors) {
+    auto &feasible_colors_for_node = feasible_colors[new_ordering[i]];
+    feasible_colors_for_node.clear();
     int current_maximal_color = 0;
 
     for (int j = 0; j < i; ++j) {
@@ -570,11 +594,10 @@ std::unordered_set<int> blocked_colors) {
             feasible_colors_for_node.insert(j);
         }
     }
-
-    feasible_colors[new_ordering[i]] = feasible_colors_for_node;
 }
 
 void KormanEnumerationVertexColoring::run() {
+    interrupted = false;
     ordering = greedy_largest_first_ordering();
     lower_bound = 1;
     upper_bound = graph->numberOfNodes();
@@ -589,13 +612,13 @@ void KormanEnumerationVertexColoring::run() {
     current_bound = upper_bound + 1;
 
     new_ordering.push_back(0);
-    feasible_colors.resize(graph->numberOfNodes());
+    resize_feasible_colors();
     feasible_colors[0].insert(1);
     current_solution[0] = 1;
 
     while (true) {
         forwards();
-        if (current_bound == lower_bound) {
+        if (current_bound == lower_bound || isStopRequested()) {
             break;
         }
         backwards();
@@ -603,6 +626,7 @@ void KormanEnumerationVertexColoring::run() {
             break;
         }
     }
+    optimal = !interrupted;
     hasRun = true;
 }
 
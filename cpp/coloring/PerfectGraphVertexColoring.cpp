@@ -7,7 +7,9 @@
  */
 
 #include <map>
+#include <mutex>
 #include <optional>
+#include <set>
 #include <tuple>
 
 extern "C" {
@@ -87,13 +89,32 @@ std::vector<int> get_vector(const NetworKit::Graph &graph) {
 namespace Koala {
 
 void PerfectGraphVertexColoring::run() {
+    interrupted = false;
     omega = get_omega(*graph);
-    for (int color = 1; graph->numberOfNodes() > 0; color++) {
-        for (const auto &v : get_stable_set_intersecting_all_maximum_cliques()) {
+    // the color classes are removed one by one, so the procedure works on its own copy
+    NetworKit::Graph remaining = *graph;
+    int color = 1;
+    for (; remaining.numberOfNodes() > 0 && !isStopRequested(); color++) {
+        for (const auto &v : get_stable_set_intersecting_all_maximum_cliques(remaining)) {
             colors[v] = color;
-            graph->removeNode(v);
+            remaining.removeNode(v);
         }
     }
+    // if interrupted, the remaining vertices are colored greedily with the new colors
+    remaining.forNodes([&](NetworKit::node v) {
+        std::set<int> used;
+        remaining.forNeighborsOf(v, [&](NetworKit::node u) {
+            if (colors.contains(u)) {
+                used.insert(colors[u]);
+            }
+        });
+        int c = color;
+        while (used.contains(c)) {
+            c++;
+        }
+        colors[v] = c;
+    });
+    optimal = !interrupted;
     hasRun = true;
 }
 
@@ -102,15 +123,16 @@ void PerfectGraphVertexColoring::check() const {
     int chi = std::max_element(
         std::begin(colors), std::end(colors),
         [] (const auto &a, const auto &b) { return a.second < b.second; })->second;
-    assert(omega == chi);
+    assert(interrupted || omega == chi);
 }
 
-std::vector<int> PerfectGraphVertexColoring::get_stable_set_intersecting_all_maximum_cliques() {
-    auto cliques = get_maximum_clique(*graph);
+std::vector<int> PerfectGraphVertexColoring::get_stable_set_intersecting_all_maximum_cliques(
+        const NetworKit::Graph &graph) {
+    auto cliques = get_maximum_clique(graph);
     int omega = std::accumulate(cliques.begin(), cliques.end(), 0);
     while (true) {
-        auto stable_set = get_maximum_weighted_stable_set(*graph, cliques);
-        NetworKit::Graph subgraph = *graph;
+        auto stable_set = get_maximum_weighted_stable_set(graph, cliques);
+        NetworKit::Graph subgraph = graph;
         for (auto v : stable_set) {
             subgraph.removeNode(v);
         }
@@ -144,9 +166,15 @@ int PerfectGraphVertexColoring::get_theta(
         return 1 + (from.size() == 0);
     }
     auto e = std::make_tuple(indices.back(), from.size(), from, to);
+    // the cache is shared by all instances, so it is guarded for the concurrent runs
     static std::map<decltype(e), int> CACHE;
-    if (indices.back() <= CACHE_LIMIT && CACHE.count(e) > 0) {
-        return CACHE[e];
+    static std::mutex CACHE_MUTEX;
+    if (indices.back() <= CACHE_LIMIT) {
+        std::lock_guard<std::mutex> lock(CACHE_MUTEX);
+        auto it = CACHE.find(e);
+        if (it != CACHE.end()) {
+            return it->second;
+        }
     }
     double theta = compute_theta(indices.back(), from.size(), from.data(), to.data());
     int theta_int = theta + 0.5;
@@ -155,6 +183,7 @@ int PerfectGraphVertexColoring::get_theta(
         throw std::logic_error("Non-integer theta for a perfect graph: " + std::to_string(theta));
     }
     if (indices.back() <= CACHE_LIMIT) {
+        std::lock_guard<std::mutex> lock(CACHE_MUTEX);
         CACHE[e] = theta_int;
     }
     return theta_int;
@@ -9,7 +9,11 @@
 
 namespace Koala {
 
-VertexColoring::VertexColoring(NetworKit::Graph &graph) : graph(std::make_optional(graph)) { }
+VertexColoring::VertexColoring(NetworKit::Graph &graph)
+    : VertexColoring(std::make_shared<const NetworKit::Graph>(graph)) { }
+
+VertexColoring::VertexColoring(std::shared_ptr<const NetworKit::Graph> graph)
+    : graph(std::move(graph)) { }
 
 const std::map<NetworKit::node, int>& VertexColoring::getColoring() const {
     assureFinished();
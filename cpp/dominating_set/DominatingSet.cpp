@@ -9,7 +9,11 @@
 
 namespace Koala {
 
-DominatingSet::DominatingSet(NetworKit::Graph &graph) : graph(std::make_optional(graph)) { }
+DominatingSet::DominatingSet(NetworKit::Graph &graph)
+    : DominatingSet(std::make_shared<const NetworKit::Graph>(graph)) { }
+
+DominatingSet::DominatingSet(std::shared_ptr<const NetworKit::Graph> graph)
+    : graph(std::move(graph)) { }
 
 const std::set<NetworKit::node>& DominatingSet::getDominatingSet() const {
     assureFinished();
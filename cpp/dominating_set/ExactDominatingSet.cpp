@@ -20,12 +20,13 @@ namespace Koala {
 
 bool is_optional_dominating_set(
         const NetworKit::Graph &G, const std::set<NetworKit::node> &solution,
-        std::set<NetworKit::node> bound) {
+        const std::set<NetworKit::node> &bound, std::pmr::memory_resource *resource) {
+    std::pmr::set<NetworKit::node> undominated(bound.begin(), bound.end(), resource);
     for (const auto &u : solution) {
-        bound.erase(u);
-        G.forNeighborsOf(u, [&bound](NetworKit::node v) { bound.erase(v); });
+        undominated.erase(u);
+        G.forNeighborsOf(u, [&undominated](NetworKit::node v) { undominated.erase(v); });
     }
-    return bound.empty();
+    return undominated.empty();
 }
 
 std::vector<NetworKit::node> merge(
@@ -35,11 +36,20 @@ std::vector<NetworKit::node> merge(
     return merged;
 }
 
+void ExactDominatingSet::setMemoryResource(std::pmr::memory_resource *resource) {
+    arena = SearchArena(resource);
+}
+
 bool ExactDominatingSet::find_small_MODS_recursive(
         const NetworKit::Graph &G, const std::vector<NetworKit::node> &V,
         NetworKit::index index, NetworKit::count size, std::set<NetworKit::node> &S) {
+    if (pollStopRequested()) {
+        return false;
+    }
     if (index == V.size()) {
-        return is_optional_dominating_set(G, S, bound);
+        // every leaf checks a fresh copy of the bound vertices, so it reuses the same arena
+        SearchArena::Frame frame(arena);
+        return is_optional_dominating_set(G, S, bound, arena.resource());
     }
     if (S.size() < size) {
         S.insert(V.at(index));
@@ -56,6 +66,7 @@ bool ExactDominatingSet::find_small_MODS_recursive(
 
 void FominKratschWoegingerDominatingSet::run() {
     hasRun = true;
+    interrupted = false;
     graph->forNodes([this](NetworKit::node u) {
         bound.insert(u);
         if (graph->degree(u) == 1) {
@@ -69,6 +80,7 @@ void FominKratschWoegingerDominatingSet::run() {
         G_directed.addEdge(u, v), G_directed.addEdge(v, u);
     }
     dominating_set = find_big_MODS_recursive(G_directed);
+    optimal = !interrupted;
 }
 
 std::set<NetworKit::node> FominKratschWoegingerDominatingSet::find_big_MODS_recursive(
@@ -153,6 +165,10 @@ std::set<NetworKit::node> FominKratschWoegingerDominatingSet::find_MODS_for_mini
             return solution;
         }
     }
+    if (interrupted) {
+        // all unrequired vertices always form an optional dominating set
+        return std::set<NetworKit::node>(unrequired.begin(), unrequired.end());
+    }
     throw std::invalid_argument("There is no small optional dominating set in the graph");
 }
 
@@ -233,17 +249,18 @@ void FominKratschWoegingerDominatingSet::retrieve_vertex(
 
 void SchiermeyerDominatingSet::run() {
     hasRun = true;
+    interrupted = false;
     bound.insert(graph->nodeRange().begin(), graph->nodeRange().end());
     NetworKit::Graph core_graph = get_core_graph(*graph, free, bound, required);
     if (bound.empty()) {
         dominating_set.insert(required.begin(), required.end());
-        return;
-    }
-    auto unrequired = merge(free, bound);
-    if (find_small_MODS(core_graph, unrequired)) {
-        return;
+    } else {
+        auto unrequired = merge(free, bound);
+        if (!find_small_MODS(core_graph, unrequired)) {
+            find_big_MODS(core_graph, unrequired);
+        }
     }
-    find_big_MODS(core_graph, unrequired);
+    optimal = !interrupted;
 }
 
 NetworKit::Graph SchiermeyerDominatingSet::get_core_graph(
@@ -332,6 +349,10 @@ void SchiermeyerDominatingSet::find_big_MODS(
 
 std::vector<NetworKit::node> SchiermeyerDominatingSet::find_big_MODS_recursive(
         const NetworKit::Graph &G, const std::vector<NetworKit::node> &V, NetworKit::index index) {
+    if (pollStopRequested()) {
+        // all unrequired vertices always form an optional dominating set
+        return V;
+    }
     if (index == V.size()) {
         if (neighborhood.size() < 3 * required.size()) {
             return V;
@@ -0,0 +1,88 @@
+/*
+ * Connectivity.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <flow/Connectivity.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <flow/DinicMaximumFlow.hpp>
+
+namespace Koala {
+
+NetworKit::count edgeConnectivity(
+        const NetworKit::Graph &graph, NetworKit::node s, NetworKit::node t) {
+    DinicMaximumFlow<UnitCapacity> flow(borrow(graph), s, t);
+    flow.run();
+    return flow.getFlowSize();
+}
+
+NetworKit::count edgeConnectivity(const NetworKit::Graph &graph) {
+    if (graph.numberOfNodes() < 2) {
+        throw std::invalid_argument("The edge connectivity requires at least two vertices");
+    }
+    std::vector<NetworKit::node> nodes(graph.nodeRange().begin(), graph.nodeRange().end());
+    // a single network serves all the flow computations, only its residuals are reset
+    DinicMaximumFlow<UnitCapacity> flow(borrow(graph), nodes[0], nodes[1]);
+    auto connectivity = [&](NetworKit::node s, NetworKit::node t) -> NetworKit::count {
+        flow.setTerminals(s, t);
+        flow.run();
+        return flow.getFlowSize();
+    };
+    // every minimum cut separates nodes[0] from some other vertex
+    NetworKit::count result = NetworKit::none;
+    for (NetworKit::index i = 1; i < nodes.size() && result > 0; i++) {
+        result = std::min(result, connectivity(nodes[0], nodes[i]));
+        if (graph.isDirected() && result > 0) {
+            result = std::min(result, connectivity(nodes[i], nodes[0]));
+        }
+    }
+    return result;
+}
+
+NetworKit::count vertexConnectivity(
+        const NetworKit::Graph &graph, NetworKit::node s, NetworKit::node t) {
+    if (graph.isDirected()) {
+        throw std::invalid_argument("The vertex connectivity is computed for undirected graphs");
+    }
+    if (s == t || graph.hasEdge(s, t)) {
+        throw std::invalid_argument("The vertices have to be distinct and nonadjacent");
+    }
+    // vertex v is split into the arc 2v -> 2v + 1 with unit capacity
+    NetworKit::Graph split(2 * graph.upperNodeIdBound(), false, true);
+    graph.forNodes([&](NetworKit::node v) {
+        split.addEdge(2 * v, 2 * v + 1);
+    });
+    graph.forEdges([&](NetworKit::node u, NetworKit::node v) {
+        if (u != v) {
+            split.addEdge(2 * u + 1, 2 * v), split.addEdge(2 * v + 1, 2 * u);
+        }
+    });
+    DinicMaximumFlow<UnitCapacity> flow(borrow(split), 2 * s + 1, 2 * t);
+    flow.run();
+    return flow.getFlowSize();
+}
+
+NetworKit::count vertexConnectivity(const NetworKit::Graph &graph) {
+    if (graph.isDirected()) {
+        throw std::invalid_argument("The vertex connectivity is computed for undirected graphs");
+    }
+    std::vector<NetworKit::node> nodes(graph.nodeRange().begin(), graph.nodeRange().end());
+    NetworKit::count result = nodes.empty() ? 0 : nodes.size() - 1;
+    // some vertex among the first result + 1 ones lies outside a minimum separator, and the
+    // separator splits it from a vertex with a larger index
+    for (NetworKit::index i = 0; i <= result && i < nodes.size(); i++) {
+        for (NetworKit::index j = i + 1; j < nodes.size(); j++) {
+            if (!graph.hasEdge(nodes[i], nodes[j])) {
+                result = std::min(result, vertexConnectivity(graph, nodes[i], nodes[j]));
+            }
+        }
+    }
+    return result;
+}
+
+}  /* namespace Koala */
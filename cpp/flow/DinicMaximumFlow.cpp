@@ -0,0 +1,271 @@
+/*
+ * DinicMaximumFlow.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <flow/DinicMaximumFlow.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+
+namespace Koala {
+
+template <class Capacity>
+DinicMaximumFlow<Capacity>::DinicMaximumFlow(
+        const NetworKit::Graph &graph, NetworKit::node s, NetworKit::node t)
+    : DinicMaximumFlow(std::make_shared<const NetworKit::Graph>(graph), s, t) { }
+
+template <class Capacity>
+DinicMaximumFlow<Capacity>::DinicMaximumFlow(
+        std::shared_ptr<const NetworKit::Graph> graph, NetworKit::node s, NetworKit::node t)
+        : graph(std::move(graph)), flow_size(0) {
+    setTerminals(s, t);
+}
+
+template <class Capacity>
+void DinicMaximumFlow<Capacity>::setTerminals(NetworKit::node s, NetworKit::node t) {
+    if (!graph->hasNode(s) || !graph->hasNode(t) || s == t) {
+        throw std::invalid_argument("The source and the sink have to be distinct vertices");
+    }
+    source = s, target = t;
+}
+
+template <class Capacity>
+typename DinicMaximumFlow<Capacity>::flow_type DinicMaximumFlow<Capacity>::getFlowSize() const {
+    assureFinished();
+    return flow_size;
+}
+
+template <class Capacity>
+const std::vector<bool>& DinicMaximumFlow<Capacity>::getSourceSide() const {
+    assureFinished();
+    return source_side;
+}
+
+template <class Capacity>
+void DinicMaximumFlow<Capacity>::build() {
+    NetworKit::count n = graph->upperNodeIdBound();
+    std::vector<std::tuple<NetworKit::node, NetworKit::node, flow_type>> arcs;
+    arcs.reserve(graph->isDirected() ? graph->numberOfEdges() : 2 * graph->numberOfEdges());
+    graph->forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        if (u == v || w <= 0) {
+            return;
+        }
+        if constexpr (!UNIT) {
+            // 2^digits is exact in double, unlike the maximum of int64_t
+            if (w != std::floor(w) || w >= std::ldexp(1.0, std::numeric_limits<Capacity>::digits)) {
+                throw std::invalid_argument(
+                    "The edge weights have to be integers representable in the capacity type");
+            }
+        }
+        flow_type c = UNIT ? 1 : static_cast<flow_type>(w);
+        arcs.emplace_back(u, v, c);
+        if (!graph->isDirected()) {
+            arcs.emplace_back(v, u, c);
+        }
+    });
+
+    first.assign(n + 1, 0);
+    for (const auto &[u, v, c] : arcs) {
+        first[u + 1]++, first[v + 1]++;
+    }
+    for (NetworKit::node v = 0; v < n; v++) {
+        first[v + 1] += first[v];
+    }
+    NetworKit::count m = first[n];
+    head.resize(m), reverse.resize(m);
+    if constexpr (UNIT) {
+        capacity.assign((m + 63) / 64, 0);
+    } else {
+        capacity.assign(m, 0);
+    }
+    std::vector<NetworKit::index> position(first.begin(), first.end() - 1);
+    for (const auto &[u, v, c] : arcs) {
+        NetworKit::index forward = position[u]++, backward = position[v]++;
+        head[forward] = v, head[backward] = u;
+        reverse[forward] = backward, reverse[backward] = forward;
+        if constexpr (UNIT) {
+            capacity[forward / 64] |= uint64_t(1) << (forward % 64);
+        } else {
+            capacity[forward] = c;
+        }
+    }
+    level.resize(n), current.resize(n);
+}
+
+template <class Capacity>
+void DinicMaximumFlow<Capacity>::initialize() {
+    KOALA_PROFILE_REGION("initialize");
+    if (first.empty()) {
+        build();
+    }
+    if constexpr (!UNIT) {
+        flow_type total = 0;
+        for (NetworKit::index a = first[source]; a < first[source + 1]; a++) {
+            if (capacity[a] > std::numeric_limits<flow_type>::max() - total) {
+                throw std::invalid_argument(
+                    "The total capacity of the source arcs overflows the capacity type");
+            }
+            total += capacity[a];
+        }
+    }
+    residual = capacity;
+}
+
+template <class Capacity>
+inline typename DinicMaximumFlow<Capacity>::flow_type DinicMaximumFlow<Capacity>::get_capacity(
+        NetworKit::index a) const {
+    if constexpr (UNIT) {
+        return (capacity[a / 64] >> (a % 64)) & 1;
+    } else {
+        return capacity[a];
+    }
+}
+
+template <class Capacity>
+inline bool DinicMaximumFlow<Capacity>::has_residual(NetworKit::index a) const {
+    if constexpr (UNIT) {
+        return (residual[a / 64] >> (a % 64)) & 1;
+    } else {
+        return residual[a] > 0;
+    }
+}
+
+template <class Capacity>
+inline typename DinicMaximumFlow<Capacity>::flow_type DinicMaximumFlow<Capacity>::get_residual(
+        NetworKit::index a) const {
+    if constexpr (UNIT) {
+        return has_residual(a);
+    } else {
+        return residual[a];
+    }
+}
+
+template <class Capacity>
+inline void DinicMaximumFlow<Capacity>::push(NetworKit::index a, flow_type delta) {
+    if constexpr (UNIT) {
+        residual[a / 64] &= ~(uint64_t(1) << (a % 64));
+        residual[reverse[a] / 64] |= uint64_t(1) << (reverse[a] % 64);
+    } else {
+        residual[a] -= delta, residual[reverse[a]] += delta;
+    }
+}
+
+template <class Capacity>
+bool DinicMaximumFlow<Capacity>::find_levels() {
+    std::fill(level.begin(), level.end(), NetworKit::none);
+    std::queue<NetworKit::node> queue;
+    level[source] = 0, queue.push(source);
+    while (!queue.empty()) {
+        NetworKit::node u = queue.front();
+        queue.pop();
+        for (NetworKit::index a = first[u]; a < first[u + 1]; a++) {
+            if (has_residual(a) && level[head[a]] == NetworKit::none) {
+                level[head[a]] = level[u] + 1, queue.push(head[a]);
+            }
+        }
+    }
+    return level[target] != NetworKit::none;
+}
+
+template <class Capacity>
+typename DinicMaximumFlow<Capacity>::flow_type DinicMaximumFlow<Capacity>::find_blocking_flow() {
+    std::copy(first.begin(), first.end() - 1, current.begin());
+    flow_type total = 0;
+    std::vector<NetworKit::index> path;
+    NetworKit::node v = source;
+    while (true) {
+        if (v == target) {
+            flow_type delta = std::numeric_limits<flow_type>::max();
+            for (auto a : path) {
+                delta = std::min(delta, get_residual(a));
+            }
+            NetworKit::index saturated = path.size();
+            for (NetworKit::index i = 0; i < path.size(); i++) {
+                push(path[i], delta);
+                if (saturated == path.size() && !has_residual(path[i])) {
+                    saturated = i;
+                }
+            }
+            total += delta;
+            // retreat to the tail of the first saturated arc
+            path.resize(saturated);
+            v = path.empty() ? source : head[path.back()];
+            continue;
+        }
+        NetworKit::index &a = current[v];
+        while (a < first[v + 1] && (!has_residual(a) || level[head[a]] != level[v] + 1)) {
+            a++;
+        }
+        if (a < first[v + 1]) {
+            path.push_back(a), v = head[a];
+            continue;
+        }
+        // dead end, no further augmenting path goes through v in this phase
+        level[v] = NetworKit::none;
+        if (path.empty()) {
+            break;
+        }
+        v = head[reverse[path.back()]], path.pop_back();
+        current[v]++;
+    }
+    return total;
+}
+
+template <class Capacity>
+void DinicMaximumFlow<Capacity>::run() {
+    KOALA_PROFILE_RUN();
+    interrupted = false;
+    initialize();
+    flow_size = 0;
+    while (!isStopRequested() && find_levels()) {
+        KOALA_PROFILE_REGION("blocking flow");
+        flow_size += find_blocking_flow();
+    }
+    find_levels();
+    source_side.assign(graph->upperNodeIdBound(), false);
+    graph->forNodes([&](NetworKit::node v) {
+        source_side[v] = level[v] != NetworKit::none;
+    });
+    hasRun = true;
+    optimal = !interrupted;
+}
+
+template <class Capacity>
+void DinicMaximumFlow<Capacity>::check() const {
+    assureFinished();
+    KOALA_PROFILE_ATTACH();
+    NetworKit::count n = graph->upperNodeIdBound();
+    std::vector<flow_type> excess(n, 0);
+    flow_type cut = 0;
+    for (NetworKit::node v = 0; v < n; v++) {
+        for (NetworKit::index a = first[v]; a < first[v + 1]; a++) {
+            assert(get_residual(a) >= 0);
+            assert(get_residual(a) + get_residual(reverse[a])
+                == get_capacity(a) + get_capacity(reverse[a]));
+            // the flow on the reverse arcs is the negated flow on the forward ones
+            excess[v] -= get_capacity(a) - get_residual(a);
+            if (!interrupted && source_side[v] && !source_side[head[a]]) {
+                cut += get_capacity(a);
+            }
+        }
+    }
+    for (NetworKit::node v = 0; v < n; v++) {
+        assert(v == source || v == target || excess[v] == 0);
+    }
+    assert(-excess[source] == flow_size && excess[target] == flow_size);
+    assert(source_side[source]);
+    assert(interrupted || (!source_side[target] && cut == flow_size));
+}
+
+template class DinicMaximumFlow<UnitCapacity>;
+template class DinicMaximumFlow<int32_t>;
+template class DinicMaximumFlow<int64_t>;
+
+}  /* namespace Koala */
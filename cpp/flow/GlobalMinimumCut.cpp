@@ -0,0 +1,471 @@
+/*
+ * GlobalMinimumCut.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <flow/GlobalMinimumCut.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+#include <networkit/structures/UnionFind.hpp>
+
+#include <structures/Heap.hpp>
+#include <structures/Random.hpp>
+
+namespace Koala {
+
+namespace {
+
+using Edges = std::vector<NetworKit::WeightedEdge>;
+using HeapKey = std::pair<NetworKit::edgeweight, NetworKit::node>;
+
+constexpr NetworKit::edgeweight INFINITE_WEIGHT = std::numeric_limits<NetworKit::edgeweight>::max();
+constexpr NetworKit::count BRUTE_FORCE_LIMIT = 6;
+
+// Merge the parallel edges into one, with the total weight.
+void aggregate(Edges &edges) {
+    for (auto &e : edges) {
+        if (e.u > e.v) {
+            std::swap(e.u, e.v);
+        }
+    }
+    std::sort(edges.begin(), edges.end(), [](const auto &e1, const auto &e2) {
+        return std::tie(e1.u, e1.v) < std::tie(e2.u, e2.v);
+    });
+    NetworKit::index k = 0;
+    for (NetworKit::index i = 0; i < edges.size(); i++) {
+        if (k > 0 && edges[k - 1].u == edges[i].u && edges[k - 1].v == edges[i].v) {
+            edges[k - 1].weight += edges[i].weight;
+        } else {
+            edges[k++] = edges[i];
+        }
+    }
+    edges.resize(k);
+}
+
+// Relabel the endpoints by the given labels, dropping the self-loops and merging parallel edges.
+void relabel(Edges &edges, const std::vector<NetworKit::node> &label) {
+    NetworKit::index k = 0;
+    for (const auto &e : edges) {
+        NetworKit::node u = label[e.u], v = label[e.v];
+        if (u != v) {
+            edges[k++] = NetworKit::WeightedEdge(u, v, e.weight);
+        }
+    }
+    edges.resize(k);
+    aggregate(edges);
+}
+
+// Contract the random edges until only t vertices are left, in the order of exponential keys,
+// which is equivalent to repeatedly contracting an edge chosen with probability proportional to its
+// weight. Returns the number of vertices left and sets the label of every vertex.
+NetworKit::count contract(
+        NetworKit::count n, const Edges &edges, NetworKit::count t, Philox &generator,
+        std::vector<NetworKit::node> &label, Edges &contracted) {
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<std::pair<double, NetworKit::index>> keys(edges.size());
+    for (NetworKit::index i = 0; i < edges.size(); i++) {
+        double exponential = -std::log1p(-uniform(generator));
+        keys[i] = { edges[i].weight > 0 ? exponential / edges[i].weight
+            : std::numeric_limits<double>::infinity(), i };
+    }
+    std::sort(keys.begin(), keys.end());
+    NetworKit::UnionFind union_find(n);
+    NetworKit::count k = n;
+    for (const auto &[key, i] : keys) {
+        if (k <= t) {
+            break;
+        }
+        if (union_find.find(edges[i].u) != union_find.find(edges[i].v)) {
+            union_find.merge(edges[i].u, edges[i].v), k--;
+        }
+    }
+    std::vector<NetworKit::node> representative(n, NetworKit::none);
+    NetworKit::count count = 0;
+    label.resize(n);
+    for (NetworKit::node v = 0; v < n; v++) {
+        auto r = union_find.find(v);
+        if (representative[r] == NetworKit::none) {
+            representative[r] = count++;
+        }
+        label[v] = representative[r];
+    }
+    contracted = edges;
+    relabel(contracted, label);
+    return count;
+}
+
+NetworKit::edgeweight brute_force(
+        NetworKit::count n, const Edges &edges, std::vector<bool> &side) {
+    NetworKit::edgeweight best = INFINITE_WEIGHT;
+    uint64_t best_mask = 0;
+    for (uint64_t mask = 1; mask < (uint64_t(1) << (n - 1)); mask++) {
+        NetworKit::edgeweight size = 0;
+        for (const auto &e : edges) {
+            if (((mask >> e.u) & 1) != ((mask >> e.v) & 1)) {
+                size += e.weight;
+            }
+        }
+        if (size < best) {
+            best = size, best_mask = mask;
+        }
+    }
+    for (NetworKit::node v = 0; v < n; v++) {
+        side[v] = (best_mask >> v) & 1;
+    }
+    return best;
+}
+
+NetworKit::edgeweight karger_stein(
+        NetworKit::count n, const Edges &edges, Philox &generator,
+        std::vector<bool> &side) {
+    if (n <= BRUTE_FORCE_LIMIT) {
+        return brute_force(n, edges, side);
+    }
+    auto t = static_cast<NetworKit::count>(
+        std::ceil(1.0 + static_cast<double>(n) / std::sqrt(2.0)));
+    NetworKit::edgeweight best = INFINITE_WEIGHT;
+    for (int repetition = 0; repetition < 2; repetition++) {
+        std::vector<NetworKit::node> label;
+        Edges contracted;
+        auto k = contract(n, edges, t, generator, label, contracted);
+        std::vector<bool> contracted_side(k);
+        auto size = karger_stein(k, contracted, generator, contracted_side);
+        if (size < best) {
+            best = size;
+            for (NetworKit::node v = 0; v < n; v++) {
+                side[v] = contracted_side[label[v]];
+            }
+        }
+    }
+    return best;
+}
+
+}  // namespace
+
+GlobalMinimumCut::GlobalMinimumCut(const NetworKit::Graph &graph)
+    : GlobalMinimumCut(std::make_shared<const NetworKit::Graph>(graph)) { }
+
+GlobalMinimumCut::GlobalMinimumCut(std::shared_ptr<const NetworKit::Graph> graph)
+        : graph(std::move(graph)), cut_size(0) {
+    if (this->graph->isDirected()) {
+        throw std::invalid_argument("The global minimum cut is defined for undirected graphs");
+    }
+    if (this->graph->numberOfNodes() < 2) {
+        throw std::invalid_argument("The global minimum cut requires at least two vertices");
+    }
+}
+
+NetworKit::edgeweight GlobalMinimumCut::getCutSize() const {
+    assureFinished();
+    return cut_size;
+}
+
+const std::vector<bool>& GlobalMinimumCut::getCut() const {
+    assureFinished();
+    return cut;
+}
+
+void GlobalMinimumCut::check() const {
+    assureFinished();
+    NetworKit::count count = 0;
+    graph->forNodes([&](NetworKit::node u) {
+        count += cut[u];
+    });
+    assert(count > 0 && count < graph->numberOfNodes());
+    NetworKit::edgeweight size = 0;
+    graph->forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        if (cut[u] != cut[v]) {
+            size += w;
+        }
+    });
+    assert(std::abs(size - cut_size) <= 1e-9 * std::max(1.0, cut_size));
+    graph->forNodes([&](NetworKit::node u) {
+        assert(!optimal || cut_size <= graph->weightedDegree(u) + 1e-9 * std::max(1.0, cut_size));
+    });
+}
+
+std::optional<GlobalMinimumCut::Edges> GlobalMinimumCut::initialize() {
+    nodes.assign(graph->nodeRange().begin(), graph->nodeRange().end());
+    std::vector<NetworKit::node> label(graph->upperNodeIdBound(), NetworKit::none);
+    for (NetworKit::index i = 0; i < nodes.size(); i++) {
+        label[nodes[i]] = i;
+    }
+    Edges edges;
+    edges.reserve(graph->numberOfEdges());
+    NetworKit::UnionFind union_find(nodes.size());
+    graph->forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        if (u != v) {
+            edges.emplace_back(label[u], label[v], w);
+            union_find.merge(label[u], label[v]);
+        }
+    });
+    std::vector<bool> side(nodes.size());
+    for (NetworKit::index i = 0; i < nodes.size(); i++) {
+        side[i] = union_find.find(i) == union_find.find(0);
+    }
+    if (std::find(side.begin(), side.end(), false) != side.end()) {
+        set_cut(0, side);
+        return std::nullopt;
+    }
+    return edges;
+}
+
+void GlobalMinimumCut::set_cut(NetworKit::edgeweight size, const std::vector<bool> &side) {
+    cut_size = size;
+    cut.assign(graph->upperNodeIdBound(), false);
+    for (NetworKit::index i = 0; i < nodes.size(); i++) {
+        cut[nodes[i]] = side[i];
+    }
+}
+
+void StoerWagnerGlobalMinimumCut::run() {
+    KOALA_PROFILE_RUN();
+    interrupted = false;
+    auto edges = initialize();
+    hasRun = true;
+    if (!edges) {
+        optimal = true;
+        return;
+    }
+    NetworKit::count n = nodes.size();
+    std::vector<std::vector<std::pair<NetworKit::node, NetworKit::edgeweight>>> adjacency(n);
+    for (const auto &e : *edges) {
+        adjacency[e.u].emplace_back(e.v, e.weight), adjacency[e.v].emplace_back(e.u, e.weight);
+    }
+    NetworKit::UnionFind union_find(n);
+    std::vector<NetworKit::node> alive(n);
+    std::iota(alive.begin(), alive.end(), 0);
+    std::vector<std::pair<NetworKit::node, NetworKit::node>> merges;
+    NetworKit::edgeweight best = INFINITE_WEIGHT;
+    NetworKit::index best_phase = 0;
+    NetworKit::node best_node = NetworKit::none;
+
+    PairingHeap<HeapKey> heap;
+    std::vector<PairingHeap<HeapKey>::iterator> handle(n);
+    std::vector<NetworKit::edgeweight> key(n);
+    std::vector<bool> in_heap(n);
+    std::vector<NetworKit::index> position(n, NetworKit::none);
+    while (alive.size() > 1 && (best == INFINITE_WEIGHT || !isStopRequested())) {
+        KOALA_PROFILE_REGION("maximum adjacency ordering");
+        heap.clear();
+        for (auto v : alive) {
+            key[v] = 0, in_heap[v] = true, handle[v] = heap.push({0, v});
+        }
+        NetworKit::node s = NetworKit::none, t = NetworKit::none;
+        NetworKit::edgeweight cut_of_the_phase = 0;
+        while (!heap.empty()) {
+            auto [w, v] = heap.top();
+            heap.pop();
+            in_heap[v] = false, s = t, t = v, cut_of_the_phase = w;
+            for (const auto &[x, c] : adjacency[v]) {
+                auto r = union_find.find(x);
+                if (in_heap[r]) {
+                    key[r] += c;
+                    heap.update(handle[r], {key[r], r});
+                }
+            }
+        }
+        if (cut_of_the_phase < best) {
+            best = cut_of_the_phase, best_phase = merges.size(), best_node = t;
+        }
+        merges.emplace_back(s, t);
+        union_find.merge(s, t);
+        NetworKit::node r = union_find.find(s), other = r == s ? t : s;
+        if (adjacency[r].size() < adjacency[other].size()) {
+            std::swap(adjacency[r], adjacency[other]);
+        }
+        auto &merged = adjacency[r];
+        merged.insert(merged.end(), adjacency[other].begin(), adjacency[other].end());
+        adjacency[other].clear(), adjacency[other].shrink_to_fit();
+        // drop the self-loops and merge the parallel edges, so the phases scan no stale entries
+        NetworKit::index k = 0;
+        for (const auto &[x, c] : merged) {
+            auto y = union_find.find(x);
+            if (y == r) {
+                continue;
+            }
+            if (position[y] == NetworKit::none) {
+                position[y] = k, merged[k++] = {y, c};
+            } else {
+                merged[position[y]].second += c;
+            }
+        }
+        merged.resize(k);
+        for (const auto &[x, c] : merged) {
+            position[x] = NetworKit::none;
+        }
+        alive.erase(std::find(alive.begin(), alive.end(), other));
+    }
+
+    NetworKit::UnionFind replay(n);
+    for (NetworKit::index i = 0; i < best_phase; i++) {
+        replay.merge(merges[i].first, merges[i].second);
+    }
+    std::vector<bool> side(n);
+    for (NetworKit::node v = 0; v < n; v++) {
+        side[v] = replay.find(v) == replay.find(best_node);
+    }
+    set_cut(best, side);
+    optimal = !interrupted;
+}
+
+void NagamochiIbarakiGlobalMinimumCut::run() {
+    KOALA_PROFILE_RUN();
+    interrupted = false;
+    auto initial = initialize();
+    hasRun = true;
+    if (!initial) {
+        optimal = true;
+        return;
+    }
+    NetworKit::count n = nodes.size(), k = n;
+    Edges edges = std::move(*initial);
+    aggregate(edges);
+    std::vector<NetworKit::node> label(n);
+    std::iota(label.begin(), label.end(), 0);
+    NetworKit::edgeweight best = INFINITE_WEIGHT;
+    std::vector<bool> side(n);
+    auto update_best = [&]() {
+        std::vector<NetworKit::edgeweight> degree(k);
+        for (const auto &e : edges) {
+            degree[e.u] += e.weight, degree[e.v] += e.weight;
+        }
+        NetworKit::node v = std::min_element(degree.begin(), degree.end()) - degree.begin();
+        if (degree[v] < best) {
+            best = degree[v];
+            for (NetworKit::node u = 0; u < n; u++) {
+                side[u] = label[u] == v;
+            }
+        }
+    };
+    update_best();
+
+    PairingHeap<HeapKey> heap;
+    while (k > 1 && !isStopRequested()) {
+        NetworKit::UnionFind union_find(k);
+        {
+            KOALA_PROFILE_REGION("maximum adjacency ordering");
+            std::vector<NetworKit::index> offset(k + 1);
+            for (const auto &e : edges) {
+                offset[e.u + 1]++, offset[e.v + 1]++;
+            }
+            std::partial_sum(offset.begin(), offset.end(), offset.begin());
+            std::vector<std::pair<NetworKit::node, NetworKit::edgeweight>> adjacency(offset[k]);
+            std::vector<NetworKit::index> position(offset.begin(), offset.end() - 1);
+            for (const auto &e : edges) {
+                adjacency[position[e.u]++] = {e.v, e.weight};
+                adjacency[position[e.v]++] = {e.u, e.weight};
+            }
+
+            heap.clear();
+            std::vector<PairingHeap<HeapKey>::iterator> handle(k);
+            std::vector<NetworKit::edgeweight> key(k);
+            std::vector<bool> in_heap(k, true);
+            for (NetworKit::node v = 0; v < k; v++) {
+                handle[v] = heap.push({0, v});
+            }
+            NetworKit::node s = NetworKit::none, t = NetworKit::none;
+            while (!heap.empty()) {
+                auto v = heap.top().second;
+                heap.pop();
+                in_heap[v] = false, s = t, t = v;
+                for (NetworKit::index i = offset[v]; i < offset[v + 1]; i++) {
+                    const auto &[x, c] = adjacency[i];
+                    if (in_heap[x]) {
+                        key[x] += c;
+                        heap.update(handle[x], {key[x], x});
+                        // the edge belongs to the forest F_i with i >= key[x] of the certificate
+                        if (key[x] >= best) {
+                            union_find.merge(v, x);
+                        }
+                    }
+                }
+            }
+            // every cut separating the last two vertices has weight at least deg(t) >= best
+            union_find.merge(s, t);
+        }
+        KOALA_PROFILE_REGION("contraction");
+        std::vector<NetworKit::node> representative(k, NetworKit::none), contracted(k);
+        NetworKit::count count = 0;
+        for (NetworKit::node v = 0; v < k; v++) {
+            auto r = union_find.find(v);
+            if (representative[r] == NetworKit::none) {
+                representative[r] = count++;
+            }
+            contracted[v] = representative[r];
+        }
+        for (auto &v : label) {
+            v = contracted[v];
+        }
+        relabel(edges, contracted);
+        k = count;
+        if (k > 1) {
+            update_best();
+        }
+    }
+    set_cut(best, side);
+    optimal = !interrupted;
+}
+
+KargerSteinGlobalMinimumCut::KargerSteinGlobalMinimumCut(
+        const NetworKit::Graph &graph, NetworKit::count trials, uint64_t seed)
+    : KargerSteinGlobalMinimumCut(std::make_shared<const NetworKit::Graph>(graph), trials, seed) { }
+
+KargerSteinGlobalMinimumCut::KargerSteinGlobalMinimumCut(
+        std::shared_ptr<const NetworKit::Graph> graph, NetworKit::count trials, uint64_t seed)
+        : GlobalMinimumCut(std::move(graph)), trials(trials), seed(seed) {
+    if (this->trials == 0) {
+        auto log = static_cast<NetworKit::count>(
+            std::ceil(std::log2(static_cast<double>(this->graph->numberOfNodes()))));
+        this->trials = std::max<NetworKit::count>(1, log * log);
+    }
+}
+
+void KargerSteinGlobalMinimumCut::run() {
+    KOALA_PROFILE_RUN();
+    interrupted = false;
+    auto initial = initialize();
+    hasRun = true;
+    optimal = false;
+    if (!initial) {
+        optimal = true;
+        return;
+    }
+    NetworKit::count n = nodes.size();
+    Edges edges = std::move(*initial);
+    aggregate(edges);
+    std::vector<NetworKit::edgeweight> sizes(trials, INFINITE_WEIGHT);
+    std::vector<std::vector<bool>> sides(trials, std::vector<bool>(n));
+    std::atomic<bool> stop(false);
+    #pragma omp parallel for schedule(dynamic)
+    for (int64_t i = 0; i < static_cast<int64_t>(trials); i++) {
+        // the first trial always finishes, so that there is a cut to report
+        if (i > 0) {
+            if (stop.load(std::memory_order_relaxed)) {
+                continue;
+            }
+            bool requested;
+            #pragma omp critical(karger_stein_stop)
+            requested = isStopRequested();
+            if (requested) {
+                stop.store(true, std::memory_order_relaxed);
+                continue;
+            }
+        }
+        Philox generator(seed, i);
+        sizes[i] = karger_stein(n, edges, generator, sides[i]);
+    }
+    auto best = std::min_element(sizes.begin(), sizes.end()) - sizes.begin();
+    set_cut(sizes[best], sides[best]);
+}
+
+}  /* namespace Koala */
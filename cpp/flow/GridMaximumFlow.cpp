@@ -0,0 +1,503 @@
+/*
+ * GridMaximumFlow.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <flow/GridMaximumFlow.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+
+namespace Koala {
+
+GridNetwork::GridNetwork(NetworKit::count width, NetworKit::count height, NetworKit::count depth)
+        : width(width), height(height), depth(depth) {
+    if (width == 0 || height == 0 || depth == 0) {
+        throw std::invalid_argument("The grid has to be nonempty");
+    }
+    int64_t w = width, wh = width * height;
+    offset = {1, -1, w, -w, wh, -wh};
+    NetworKit::count n = numberOfCells();
+    neighbors.resize(n);
+    #pragma omp parallel for
+    for (int64_t v = 0; v < static_cast<int64_t>(n); v++) {
+        NetworKit::index x = v % width, y = v / width % height, z = v / wh;
+        neighbors[v] = (x + 1 < width) | (x > 0) << 1 | (y + 1 < height) << 2 | (y > 0) << 3
+            | (z + 1 < depth) << 4 | (z > 0) << 5;
+    }
+    for (auto &c : capacity) {
+        c.assign(n, 0);
+    }
+    source_capacity.assign(n, 0), sink_capacity.assign(n, 0);
+}
+
+NetworKit::count GridNetwork::getWidth() const {
+    return width;
+}
+
+NetworKit::count GridNetwork::getHeight() const {
+    return height;
+}
+
+NetworKit::count GridNetwork::getDepth() const {
+    return depth;
+}
+
+NetworKit::count GridNetwork::numberOfCells() const {
+    return width * height * depth;
+}
+
+NetworKit::index GridNetwork::getCell(
+        NetworKit::index x, NetworKit::index y, NetworKit::index z) const {
+    return (z * height + y) * width + x;
+}
+
+NetworKit::index GridNetwork::getNeighbor(NetworKit::index cell, int direction) const {
+    return (neighbors[cell] >> direction) & 1 ? cell + offset[direction] : NetworKit::none;
+}
+
+void GridNetwork::addArc(NetworKit::node u, NetworKit::node v, int64_t c) {
+    NetworKit::count n = numberOfCells();
+    if (u >= n + 2 || v >= n + 2 || u == v || u == 1 || v == 0 || (u == 0 && v == 1)) {
+        throw std::invalid_argument("The arc does not belong to the grid network");
+    }
+    if (u == 0) {
+        source_capacity[v - 2] += c;
+    } else if (v == 1) {
+        sink_capacity[u - 2] += c;
+    } else {
+        for (int d = 0; d < DIRECTIONS; d++) {
+            if (getNeighbor(u - 2, d) == v - 2) {
+                capacity[d][u - 2] += c;
+                return;
+            }
+        }
+        throw std::invalid_argument("The arc does not join adjacent cells");
+    }
+}
+
+int64_t GridNetwork::getSourceCapacity(NetworKit::index cell) const {
+    return source_capacity[cell];
+}
+
+int64_t GridNetwork::getSinkCapacity(NetworKit::index cell) const {
+    return sink_capacity[cell];
+}
+
+int64_t GridNetwork::getCapacity(NetworKit::index cell, int direction) const {
+    return capacity[direction][cell];
+}
+
+int64_t GridNetwork::getCutCapacity(const std::vector<bool> &side) const {
+    int64_t result = 0;
+    #pragma omp parallel for reduction(+:result)
+    for (int64_t v = 0; v < static_cast<int64_t>(numberOfCells()); v++) {
+        if (!side[v]) {
+            result += source_capacity[v];
+            continue;
+        }
+        result += sink_capacity[v];
+        for (int d = 0; d < DIRECTIONS; d++) {
+            auto u = getNeighbor(v, d);
+            if (u != NetworKit::none && !side[u]) {
+                result += capacity[d][v];
+            }
+        }
+    }
+    return result;
+}
+
+NetworKit::Graph GridNetwork::toGraph() const {
+    NetworKit::Graph G(numberOfCells() + 2, true, true);
+    auto add = [&](NetworKit::node u, NetworKit::node v, int64_t c) {
+        if (c > 0) {
+            G.increaseWeight(u, v, c), G.increaseWeight(v, u, 0);
+        }
+    };
+    for (NetworKit::index v = 0; v < numberOfCells(); v++) {
+        add(0, v + 2, source_capacity[v]), add(v + 2, 1, sink_capacity[v]);
+        for (int d = 0; d < DIRECTIONS; d++) {
+            if (getNeighbor(v, d) != NetworKit::none) {
+                add(v + 2, getNeighbor(v, d) + 2, capacity[d][v]);
+            }
+        }
+    }
+    return G;
+}
+
+GridMaximumFlow::GridMaximumFlow(const GridNetwork &network)
+        : network(network), flow_size(0) { }
+
+int64_t GridMaximumFlow::getFlowSize() const {
+    assureFinished();
+    return flow_size;
+}
+
+const std::vector<bool>& GridMaximumFlow::getSourceSide() const {
+    assureFinished();
+    return source_side;
+}
+
+void GridMaximumFlow::initialize() {
+    residual = network.capacity;
+    source_residual = network.source_capacity, sink_residual = network.sink_capacity;
+    flow_size = 0, interrupted = false;
+}
+
+void GridMaximumFlow::check() const {
+    assureFinished();
+    NetworKit::count n = network.numberOfCells();
+    for (NetworKit::index v = 0; v < n; v++) {
+        int64_t excess = network.source_capacity[v] - source_residual[v]
+            - network.sink_capacity[v] + sink_residual[v];
+        for (int d = 0; d < GridNetwork::DIRECTIONS; d++) {
+            assert(residual[d][v] >= 0);
+            excess += residual[d][v] - network.capacity[d][v];
+        }
+        assert(excess >= 0);
+    }
+    assert(interrupted || network.getCutCapacity(source_side) == flow_size);
+}
+
+void BoykovKolmogorovGridMaximumFlow::activate(NetworKit::index v) {
+    if (!is_active[v]) {
+        is_active[v] = true, active.push_back(v);
+    }
+}
+
+bool BoykovKolmogorovGridMaximumFlow::grow(NetworKit::index &meet, int &direction) {
+    while (active_head < active.size()) {
+        NetworKit::index p = active[active_head];
+        if (tree[p] != FREE) {
+            for (int d = 0; d < GridNetwork::DIRECTIONS; d++) {
+                NetworKit::index q = neighbor(p, d);
+                if (q == NetworKit::none) {
+                    continue;
+                }
+                // in the source tree the arcs lead from the parents, in the sink tree to them
+                if (tree[p] == SOURCE_TREE ? residual[d][p] == 0 : residual[d ^ 1][q] == 0) {
+                    continue;
+                }
+                if (tree[q] == FREE) {
+                    tree[q] = tree[p], parent[q] = d ^ 1;
+                    timestamp[q] = timestamp[p], distance[q] = distance[p] + 1;
+                    activate(q);
+                } else if (tree[q] != tree[p]) {
+                    meet = tree[p] == SOURCE_TREE ? p : q;
+                    direction = tree[p] == SOURCE_TREE ? d : d ^ 1;
+                    return true;
+                } else if (timestamp[q] <= timestamp[p] && distance[q] > distance[p]) {
+                    parent[q] = d ^ 1;
+                    timestamp[q] = timestamp[p], distance[q] = distance[p] + 1;
+                }
+            }
+        }
+        is_active[p] = false, active_head++;
+        if (active_head > active.size() / 2 && active_head > 1024) {
+            active.erase(active.begin(), active.begin() + active_head), active_head = 0;
+        }
+    }
+    return false;
+}
+
+void BoykovKolmogorovGridMaximumFlow::augment(NetworKit::index meet, int direction) {
+    NetworKit::index other = neighbor(meet, direction);
+    int64_t delta = residual[direction][meet];
+    NetworKit::index v;
+    for (v = meet; parent[v] != TERMINAL; v = neighbor(v, parent[v])) {
+        delta = std::min(delta, residual[parent[v] ^ 1][neighbor(v, parent[v])]);
+    }
+    delta = std::min(delta, source_residual[v]);
+    for (v = other; parent[v] != TERMINAL; v = neighbor(v, parent[v])) {
+        delta = std::min(delta, residual[parent[v]][v]);
+    }
+    delta = std::min(delta, sink_residual[v]);
+
+    push(meet, direction, delta);
+    for (v = meet; parent[v] != TERMINAL; ) {
+        NetworKit::index u = neighbor(v, parent[v]);
+        push(u, parent[v] ^ 1, delta);
+        if (residual[parent[v] ^ 1][u] == 0) {
+            parent[v] = ORPHAN, orphans.push_back(v);
+        }
+        v = u;
+    }
+    source_residual[v] -= delta;
+    if (source_residual[v] == 0) {
+        parent[v] = ORPHAN, orphans.push_back(v);
+    }
+    for (v = other; parent[v] != TERMINAL; ) {
+        NetworKit::index u = neighbor(v, parent[v]);
+        push(v, parent[v], delta);
+        if (residual[parent[v]][v] == 0) {
+            parent[v] = ORPHAN, orphans.push_back(v);
+        }
+        v = u;
+    }
+    sink_residual[v] -= delta;
+    if (sink_residual[v] == 0) {
+        parent[v] = ORPHAN, orphans.push_back(v);
+    }
+    flow_size += delta;
+}
+
+void BoykovKolmogorovGridMaximumFlow::adopt(NetworKit::index p) {
+    constexpr auto INFINITE = std::numeric_limits<NetworKit::count>::max();
+    int best = ORPHAN;
+    NetworKit::count best_distance = INFINITE;
+    for (int d = 0; d < GridNetwork::DIRECTIONS; d++) {
+        NetworKit::index q = neighbor(p, d);
+        if (q == NetworKit::none || tree[q] != tree[p]
+                || (tree[p] == SOURCE_TREE ? residual[d ^ 1][q] : residual[d][p]) == 0) {
+            continue;
+        }
+        // q is a valid parent only if its path leads to the terminal, distances are cached per time
+        NetworKit::count length = 0;
+        NetworKit::index v = q;
+        while (true) {
+            if (timestamp[v] == time) {
+                length += distance[v];
+                break;
+            }
+            length++;
+            if (parent[v] == TERMINAL) {
+                timestamp[v] = time, distance[v] = 1;
+                break;
+            }
+            if (parent[v] == ORPHAN) {
+                length = INFINITE;
+                break;
+            }
+            v = neighbor(v, parent[v]);
+        }
+        if (length == INFINITE) {
+            continue;
+        }
+        if (length < best_distance) {
+            best = d, best_distance = length;
+        }
+        for (v = q; timestamp[v] != time; v = neighbor(v, parent[v])) {
+            timestamp[v] = time, distance[v] = length--;
+        }
+    }
+    if (best != ORPHAN) {
+        parent[p] = best, timestamp[p] = time, distance[p] = best_distance + 1;
+        return;
+    }
+    for (int d = 0; d < GridNetwork::DIRECTIONS; d++) {
+        NetworKit::index q = neighbor(p, d);
+        if (q == NetworKit::none || tree[q] != tree[p]) {
+            continue;
+        }
+        if ((tree[p] == SOURCE_TREE ? residual[d ^ 1][q] : residual[d][p]) > 0) {
+            activate(q);
+        }
+        if (parent[q] == (d ^ 1)) {
+            parent[q] = ORPHAN, orphans.push_back(q);
+        }
+    }
+    tree[p] = FREE;
+}
+
+void BoykovKolmogorovGridMaximumFlow::run() {
+    KOALA_PROFILE_RUN();
+    NetworKit::count n = network.numberOfCells();
+    tree.assign(n, FREE), parent.assign(n, ORPHAN);
+    timestamp.assign(n, 0), distance.assign(n, 0);
+    is_active.assign(n, false), active.clear(), orphans.clear();
+    active_head = 0, time = 0;
+    initialize();
+    {
+        KOALA_PROFILE_REGION("terminals");
+        for (NetworKit::index v = 0; v < n; v++) {
+            // the flow through a single cell needs no search at all
+            int64_t delta = std::min(source_residual[v], sink_residual[v]);
+            source_residual[v] -= delta, sink_residual[v] -= delta, flow_size += delta;
+            if (source_residual[v] > 0 || sink_residual[v] > 0) {
+                tree[v] = source_residual[v] > 0 ? SOURCE_TREE : SINK_TREE;
+                parent[v] = TERMINAL, distance[v] = 1;
+                activate(v);
+            }
+        }
+    }
+    NetworKit::index meet;
+    int direction;
+    while (grow(meet, direction)) {
+        if (isStopRequested()) {
+            break;
+        }
+        time++;
+        augment(meet, direction);
+        while (!orphans.empty()) {
+            NetworKit::index p = orphans.back();
+            orphans.pop_back();
+            adopt(p);
+        }
+    }
+    source_side.assign(n, false);
+    for (NetworKit::index v = 0; v < n; v++) {
+        source_side[v] = tree[v] == SOURCE_TREE;
+    }
+    optimal = !interrupted;
+    hasRun = true;
+}
+
+PushRelabelGridMaximumFlow::PushRelabelGridMaximumFlow(
+        const GridNetwork &network, NetworKit::count block_size)
+        : GridMaximumFlow(network), block_size(block_size) {
+    if (block_size == 0) {
+        throw std::invalid_argument("The block size has to be positive");
+    }
+}
+
+NetworKit::count PushRelabelGridMaximumFlow::global_relabel() {
+    KOALA_PROFILE_REGION("global relabel");
+    // the distances to the sink are at most the number of cells, so larger labels mean unreachable
+    NetworKit::count n = network.numberOfCells(), unreachable = n + 1;
+    std::fill(label.begin(), label.end(), unreachable);
+    std::vector<NetworKit::index> queue;
+    for (NetworKit::index v = 0; v < n; v++) {
+        if (sink_residual[v] > 0) {
+            label[v] = 1, queue.push_back(v);
+        }
+    }
+    for (NetworKit::index i = 0; i < queue.size(); i++) {
+        NetworKit::index v = queue[i];
+        for (int d = 0; d < GridNetwork::DIRECTIONS; d++) {
+            NetworKit::index u = neighbor(v, d);
+            if (u != NetworKit::none && label[u] == unreachable && residual[d ^ 1][u] > 0) {
+                label[u] = label[v] + 1, queue.push_back(u);
+            }
+        }
+    }
+    // the cells relabeled far beyond the current distances are most likely cut off from the sink,
+    // so they wait for the next global relabeling instead of lifting the flow step by step
+    limit = std::min(queue.empty() ? 0 : label[queue.back()] + 2 * block_size, unreachable);
+    NetworKit::count active = 0;
+    #pragma omp parallel for reduction(+:active)
+    for (int64_t v = 0; v < static_cast<int64_t>(n); v++) {
+        active += excess[v] > 0 && label[v] < unreachable;
+    }
+    return active;
+}
+
+int64_t PushRelabelGridMaximumFlow::discharge_block(
+        NetworKit::index bx, NetworKit::index by, NetworKit::index bz) {
+    NetworKit::count unreachable = network.numberOfCells() + 1;
+    NetworKit::index x0 = bx * block_size, y0 = by * block_size, z0 = bz * block_size;
+    NetworKit::index x1 = std::min(x0 + block_size, network.getWidth());
+    NetworKit::index y1 = std::min(y0 + block_size, network.getHeight());
+    NetworKit::index z1 = std::min(z0 + block_size, network.getDepth());
+    auto inside = [&](NetworKit::index v) {
+        NetworKit::index x = v % network.getWidth();
+        NetworKit::index y = v / network.getWidth() % network.getHeight();
+        NetworKit::index z = v / (network.getWidth() * network.getHeight());
+        return x0 <= x && x < x1 && y0 <= y && y < y1 && z0 <= z && z < z1;
+    };
+
+    std::vector<NetworKit::index> stack;
+    for (NetworKit::index z = z0; z < z1; z++) {
+        for (NetworKit::index y = y0; y < y1; y++) {
+            for (NetworKit::index x = x0; x < x1; x++) {
+                NetworKit::index v = network.getCell(x, y, z);
+                if (excess[v] > 0 && label[v] < limit) {
+                    stack.push_back(v);
+                }
+            }
+        }
+    }
+    int64_t result = 0;
+    while (!stack.empty()) {
+        NetworKit::index v = stack.back();
+        stack.pop_back();
+        while (excess[v] > 0 && label[v] < limit) {
+            if (label[v] == 1 && sink_residual[v] > 0) {
+                int64_t delta = std::min(excess[v], sink_residual[v]);
+                sink_residual[v] -= delta, excess[v] -= delta, result += delta;
+            }
+            for (int d = 0; d < GridNetwork::DIRECTIONS && excess[v] > 0; d++) {
+                NetworKit::index u = neighbor(v, d);
+                if (u == NetworKit::none || residual[d][v] == 0 || label[u] + 1 != label[v]) {
+                    continue;
+                }
+                int64_t delta = std::min(excess[v], residual[d][v]);
+                push(v, d, delta), excess[v] -= delta;
+                if (inside(u)) {
+                    if (excess[u] == 0) {
+                        stack.push_back(u);
+                    }
+                    excess[u] += delta;
+                } else {
+                    // the cells outside are idle, but the neighboring blocks of the same color
+                    // may push to them concurrently
+                    #pragma omp atomic
+                    excess[u] += delta;
+                }
+            }
+            if (excess[v] == 0) {
+                break;
+            }
+            NetworKit::count next = sink_residual[v] > 0 ? 1 : unreachable;
+            for (int d = 0; d < GridNetwork::DIRECTIONS; d++) {
+                NetworKit::index u = neighbor(v, d);
+                if (u != NetworKit::none && residual[d][v] > 0) {
+                    next = std::min(next, label[u] + 1);
+                }
+            }
+            label[v] = std::min(next, unreachable);
+        }
+    }
+    return result;
+}
+
+void PushRelabelGridMaximumFlow::run() {
+    KOALA_PROFILE_RUN();
+    NetworKit::count n = network.numberOfCells();
+    excess.assign(n, 0), label.assign(n, n + 1);
+    initialize();
+    // only the first phase is needed, so the arcs from the source stay saturated
+    for (NetworKit::index v = 0; v < n; v++) {
+        excess[v] = source_residual[v], source_residual[v] = 0;
+    }
+    NetworKit::index blocks_x = (network.getWidth() + block_size - 1) / block_size;
+    NetworKit::index blocks_y = (network.getHeight() + block_size - 1) / block_size;
+    NetworKit::index blocks_z = (network.getDepth() + block_size - 1) / block_size;
+    std::vector<std::vector<std::tuple<NetworKit::index, NetworKit::index, NetworKit::index>>>
+        blocks(2);
+    for (NetworKit::index bz = 0; bz < blocks_z; bz++) {
+        for (NetworKit::index by = 0; by < blocks_y; by++) {
+            for (NetworKit::index bx = 0; bx < blocks_x; bx++) {
+                // the blocks adjacent along an axis always have distinct colors
+                blocks[(bx + by + bz) % 2].emplace_back(bx, by, bz);
+            }
+        }
+    }
+    while (global_relabel() > 0) {
+        if (isStopRequested()) {
+            break;
+        }
+        KOALA_PROFILE_REGION("discharge");
+        for (const auto &color : blocks) {
+            int64_t delta = 0;
+            #pragma omp parallel for schedule(dynamic) reduction(+:delta)
+            for (int64_t i = 0; i < static_cast<int64_t>(color.size()); i++) {
+                auto [bx, by, bz] = color[i];
+                delta += discharge_block(bx, by, bz);
+            }
+            flow_size += delta;
+        }
+    }
+    // the cells that cannot reach the sink in the residual network form a minimum cut
+    source_side.assign(n, false);
+    for (NetworKit::index v = 0; v < n; v++) {
+        source_side[v] = label[v] > n;
+    }
+    optimal = !interrupted;
+    hasRun = true;
+}
+
+}  /* namespace Koala */
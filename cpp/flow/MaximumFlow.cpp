@@ -6,10 +6,12 @@
  *      Ported by: Krzysztof Turowski (krzysztof.szymon.turowski@gmail.com)
  */
 
+#include <cassert>
 #include <iostream>
 #include <ranges>
 
 #include <flow/MaximumFlow.hpp>
+#include <flow/MaximumFlowVerifier.hpp>
 
 using edge = std::pair<NetworKit::node, NetworKit::node>;
 
@@ -20,13 +22,37 @@ edge reverse(const edge &p) {
 namespace Koala {
 
 MaximumFlow::MaximumFlow(NetworKit::Graph &graph, NetworKit::node s, NetworKit::node t)
-    : graph(std::make_optional(graph)), source(s), target(t) { }
+    : MaximumFlow(std::make_shared<const NetworKit::Graph>(graph), s, t) { }
+
+MaximumFlow::MaximumFlow(
+        std::shared_ptr<const NetworKit::Graph> graph, NetworKit::node s, NetworKit::node t)
+    : graph(std::move(graph)), source(s), target(t) { }
 
 int MaximumFlow::getFlowSize() const {
     assureFinished();
     return flow_size;
 }
 
+const std::map<edge, int>& MaximumFlow::getFlow() const {
+    assureFinished();
+    return flow;
+}
+
+void MaximumFlow::check() const {
+    assureFinished();
+    std::vector<NetworKit::WeightedEdge> arcs;
+    for (const auto &[e, f] : flow) {
+        if (f > 0) {
+            arcs.emplace_back(e.first, e.second, f);
+        }
+    }
+    MaximumFlowVerifier verifier(*graph, source, target, arcs);
+    verifier.run();
+    const auto &certificate = verifier.getCertificate();
+    assert(certificate.isMaximum());
+    assert(certificate.flow_value == flow_size);
+}
+
 int KingRaoTarjanMaximumFlow::get_visible_excess(NetworKit::node v) {
     return std::max(0, excess[v] - hidden_excess[v]);
 }
@@ -94,7 +120,7 @@ void KingRaoTarjanMaximumFlow::cut(const edge &e) {
 
 void KingRaoTarjanMaximumFlow::initialize() {
     dynamic_tree.initialize(graph->numberOfNodes());
-    edge_designator.initialize(graph);
+    edge_designator.initialize(*graph);
     graph->forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
         capacity[std::make_pair(u, v)] = w;
         hidden_excess[u] += w;
@@ -171,8 +197,17 @@ void KingRaoTarjanMaximumFlow::relabel(NetworKit::node v) {
 }
 
 void KingRaoTarjanMaximumFlow::run() {
-    initialize();
-    auto L = get_edges_list();
+    KOALA_PROFILE_RUN();
+    {
+        KOALA_PROFILE_REGION("initialize");
+        initialize();
+    }
+    std::vector<edge> L;
+    {
+        KOALA_PROFILE_REGION("edge list");
+        L = get_edges_list();
+    }
+    KOALA_PROFILE_REGION("push/relabel loop");
     while (!L.empty()) {
         auto e = L.back();
         L.pop_back();
@@ -187,7 +222,14 @@ void KingRaoTarjanMaximumFlow::run() {
             }
         }
     }
+    {
+        KOALA_PROFILE_REGION("flow");
+        graph->forEdges([&](NetworKit::node u, NetworKit::node v) {
+            set_flow(std::make_pair(u, v), get_flow(std::make_pair(u, v)));
+        });
+    }
     flow_size = get_visible_excess(target);
+    optimal = true;
     hasRun = true;
 }
 
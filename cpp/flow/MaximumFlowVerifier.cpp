@@ -0,0 +1,157 @@
+/*
+ * MaximumFlowVerifier.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <flow/MaximumFlowVerifier.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+
+#include <networkit/auxiliary/Parallel.hpp>
+
+namespace Koala {
+
+namespace {
+
+// Sort the arcs and merge the repeated ones into one, with the total weight.
+void aggregate(std::vector<NetworKit::WeightedEdge> &arcs) {
+    Aux::Parallel::sort(arcs.begin(), arcs.end(), [](const auto &e1, const auto &e2) {
+        return std::tie(e1.u, e1.v) < std::tie(e2.u, e2.v);
+    });
+    NetworKit::index k = 0;
+    for (NetworKit::index i = 0; i < arcs.size(); i++) {
+        if (k > 0 && arcs[k - 1].u == arcs[i].u && arcs[k - 1].v == arcs[i].v) {
+            arcs[k - 1].weight += arcs[i].weight;
+        } else {
+            arcs[k++] = arcs[i];
+        }
+    }
+    arcs.resize(k);
+}
+
+}  // namespace
+
+MaximumFlowVerifier::MaximumFlowVerifier(
+        const NetworKit::Graph &graph, NetworKit::node s, NetworKit::node t,
+        const std::vector<NetworKit::WeightedEdge> &flow_arcs, NetworKit::edgeweight tolerance)
+        : source(s), target(t), tolerance(tolerance), unmatched(0) {
+    if (!graph.hasNode(s) || !graph.hasNode(t) || s == t) {
+        throw std::invalid_argument("The source and the sink have to be distinct vertices");
+    }
+    std::vector<NetworKit::WeightedEdge> arcs;
+    arcs.reserve(2 * graph.numberOfEdges());
+    graph.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        arcs.emplace_back(u, v, w), arcs.emplace_back(v, u, graph.isDirected() ? 0 : w);
+    });
+    aggregate(arcs);
+
+    NetworKit::count n = graph.upperNodeIdBound(), m = arcs.size();
+    first.assign(n + 1, 0), head.resize(m), reverse.resize(m), capacity.resize(m);
+    flow.assign(m, 0);
+    for (NetworKit::index a = 0; a < m; a++) {
+        first[arcs[a].u + 1]++, head[a] = arcs[a].v, capacity[a] = arcs[a].weight;
+    }
+    for (NetworKit::node u = 0; u < n; u++) {
+        first[u + 1] += first[u];
+    }
+    auto find = [&](NetworKit::node u, NetworKit::node v) {
+        auto begin = head.begin() + first[u], end = head.begin() + first[u + 1];
+        auto it = std::lower_bound(begin, end, v);
+        return it != end && *it == v ? it - head.begin() : NetworKit::none;
+    };
+    #pragma omp parallel for
+    for (int64_t a = 0; a < static_cast<int64_t>(m); a++) {
+        reverse[a] = find(head[a], arcs[a].u);
+    }
+
+    std::vector<NetworKit::WeightedEdge> flows(flow_arcs);
+    aggregate(flows);
+    NetworKit::count missing = 0;
+    #pragma omp parallel for reduction(+:missing)
+    for (int64_t i = 0; i < static_cast<int64_t>(flows.size()); i++) {
+        const auto &e = flows[i];
+        auto a = e.u < n && e.v < n ? find(e.u, e.v) : NetworKit::none;
+        if (a != NetworKit::none) {
+            flow[a] = e.weight;
+        } else if (std::abs(e.weight) > tolerance) {
+            missing++;
+        }
+    }
+    unmatched = missing;
+}
+
+const MaximumFlowCertificate& MaximumFlowVerifier::getCertificate() const {
+    assureFinished();
+    return certificate;
+}
+
+void MaximumFlowVerifier::run() {
+    KOALA_PROFILE_RUN();
+    NetworKit::count n = first.size() - 1, m = head.size();
+    certificate = MaximumFlowCertificate();
+
+    NetworKit::count capacity_violations = unmatched, conservation_violations = 0;
+    NetworKit::edgeweight flow_value = 0;
+    {
+        KOALA_PROFILE_REGION("feasibility");
+        #pragma omp parallel for reduction(+:capacity_violations)
+        for (int64_t a = 0; a < static_cast<int64_t>(m); a++) {
+            if (flow[a] < -tolerance || flow[a] > capacity[a] + tolerance) {
+                capacity_violations++;
+            }
+        }
+        #pragma omp parallel for reduction(+:conservation_violations, flow_value)
+        for (int64_t u = 0; u < static_cast<int64_t>(n); u++) {
+            NetworKit::edgeweight excess = 0;
+            for (NetworKit::index a = first[u]; a < first[u + 1]; a++) {
+                excess += flow[reverse[a]] - flow[a];
+            }
+            if (static_cast<NetworKit::node>(u) == source) {
+                flow_value -= excess;
+            } else if (static_cast<NetworKit::node>(u) != target && std::abs(excess) > tolerance) {
+                conservation_violations++;
+            }
+        }
+    }
+    certificate.capacity_violations = capacity_violations;
+    certificate.conservation_violations = conservation_violations;
+    certificate.flow_value = flow_value;
+
+    {
+        KOALA_PROFILE_REGION("residual cut");
+        auto &side = certificate.source_side;
+        side.assign(n, false);
+        std::queue<NetworKit::node> queue;
+        side[source] = true, queue.push(source);
+        while (!queue.empty()) {
+            NetworKit::node u = queue.front();
+            queue.pop();
+            for (NetworKit::index a = first[u]; a < first[u + 1]; a++) {
+                if (!side[head[a]] && capacity[a] - flow[a] + flow[reverse[a]] > tolerance) {
+                    side[head[a]] = true, queue.push(head[a]);
+                }
+            }
+        }
+        certificate.target_reachable = side[target];
+        NetworKit::edgeweight cut_capacity = 0;
+        #pragma omp parallel for reduction(+:cut_capacity)
+        for (int64_t u = 0; u < static_cast<int64_t>(n); u++) {
+            if (side[u]) {
+                for (NetworKit::index a = first[u]; a < first[u + 1]; a++) {
+                    cut_capacity += side[head[a]] ? 0 : capacity[a];
+                }
+            }
+        }
+        certificate.cut_capacity = cut_capacity;
+        certificate.cut_equals_flow = std::abs(cut_capacity - flow_value)
+            <= tolerance * std::max(1.0, std::abs(cut_capacity));
+    }
+    hasRun = true;
+}
+
+}  /* namespace Koala */
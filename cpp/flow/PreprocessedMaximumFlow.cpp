@@ -0,0 +1,314 @@
+/*
+ * PreprocessedMaximumFlow.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <flow/PreprocessedMaximumFlow.hpp>
+
+#include <algorithm>
+#include <queue>
+#include <stdexcept>
+
+namespace Koala {
+
+MaximumFlowPreprocessing::MaximumFlowPreprocessing(
+        const NetworKit::Graph &graph, NetworKit::node s, NetworKit::node t)
+        : graph(std::make_optional(graph)), source(s), target(t) {
+    if (!graph.hasNode(s) || !graph.hasNode(t) || s == t) {
+        throw std::invalid_argument("The source and the sink have to be distinct vertices");
+    }
+}
+
+const NetworKit::Graph& MaximumFlowPreprocessing::getReducedGraph() const {
+    assureFinished();
+    return *reduced;
+}
+
+NetworKit::node MaximumFlowPreprocessing::getReducedSource() const {
+    assureFinished();
+    return label[source];
+}
+
+NetworKit::node MaximumFlowPreprocessing::getReducedTarget() const {
+    assureFinished();
+    return label[target];
+}
+
+std::vector<bool> MaximumFlowPreprocessing::expandSourceSide(const std::vector<bool> &side) const {
+    assureFinished();
+    std::vector<bool> result(graph->upperNodeIdBound(), false);
+    graph->forNodes([&](NetworKit::node v) {
+        if (label[v] != NetworKit::none) {
+            result[v] = side[label[v]];
+        }
+    });
+    for (auto it = reductions.rbegin(); it != reductions.rend(); it++) {
+        switch (it->type) {
+        case Reduction::Type::REMOVED:
+            result[it->v] = it->side;
+            break;
+        case Reduction::Type::SAME_SIDE:
+            result[it->v] = result[it->u];
+            break;
+        case Reduction::Type::SERIES:
+            // the contracted arc u -> w is cut at the cheaper of its two halves
+            if (result[it->u] && !result[it->w]) {
+                result[it->v] = it->out <= it->in;
+            } else {
+                result[it->v] = result[it->u] && result[it->w];
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    return result;
+}
+
+void MaximumFlowPreprocessing::add_arc(
+        NetworKit::node u, NetworKit::node v, NetworKit::edgeweight c) {
+    out_arcs[u].push_back(tail.size()), in_arcs[v].push_back(tail.size());
+    tail.push_back(u), head.push_back(v), capacity.push_back(c), arc_alive.push_back(true);
+}
+
+void MaximumFlowPreprocessing::remove_node(NetworKit::node v) {
+    node_alive[v] = false;
+    for (auto a : in_arcs[v]) {
+        arc_alive[a] = false;
+    }
+    for (auto a : out_arcs[v]) {
+        arc_alive[a] = false;
+    }
+}
+
+void MaximumFlowPreprocessing::compact() {
+    auto is_dead = [&](NetworKit::index a) { return !arc_alive[a]; };
+    for (NetworKit::node v = 0; v < node_alive.size(); v++) {
+        std::erase_if(in_arcs[v], is_dead), std::erase_if(out_arcs[v], is_dead);
+    }
+}
+
+bool MaximumFlowPreprocessing::prune_unreachable() {
+    KOALA_PROFILE_REGION("reachability");
+    auto search = [&](NetworKit::node start, bool forward) {
+        std::vector<bool> visited(node_alive.size(), false);
+        std::queue<NetworKit::node> queue;
+        visited[start] = true, queue.push(start);
+        while (!queue.empty()) {
+            NetworKit::node u = queue.front();
+            queue.pop();
+            for (auto a : forward ? out_arcs[u] : in_arcs[u]) {
+                NetworKit::node v = forward ? head[a] : tail[a];
+                if (arc_alive[a] && !visited[v]) {
+                    visited[v] = true, queue.push(v);
+                }
+            }
+        }
+        return visited;
+    };
+    auto from_source = search(source, true), to_target = search(target, false);
+    bool changed = false;
+    for (NetworKit::node v = 0; v < node_alive.size(); v++) {
+        if (node_alive[v] && v != source && v != target && (!from_source[v] || !to_target[v])) {
+            // no arc leaves the vertices reachable from s, yet not reaching t, to the other ones
+            reductions.push_back({Reduction::Type::REMOVED, v, v, v, 0, 0, from_source[v]});
+            remove_node(v);
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+bool MaximumFlowPreprocessing::prune_strongly_connected_components() {
+    KOALA_PROFILE_REGION("strongly connected components");
+    NetworKit::count n = node_alive.size();
+    std::vector<NetworKit::index> index(n, NetworKit::none), low(n), component(n, NetworKit::none);
+    std::vector<NetworKit::node> stack;
+    std::vector<std::pair<NetworKit::node, NetworKit::index>> calls;
+    std::vector<std::vector<NetworKit::node>> components;
+    NetworKit::index counter = 0;
+    for (NetworKit::node r = 0; r < n; r++) {
+        if (!node_alive[r] || index[r] != NetworKit::none) {
+            continue;
+        }
+        index[r] = low[r] = counter++, stack.push_back(r), calls.emplace_back(r, 0);
+        while (!calls.empty()) {
+            auto &[u, i] = calls.back();
+            if (i < out_arcs[u].size()) {
+                NetworKit::node v = head[out_arcs[u][i++]];
+                if (index[v] == NetworKit::none) {
+                    index[v] = low[v] = counter++, stack.push_back(v), calls.emplace_back(v, 0);
+                } else if (component[v] == NetworKit::none) {
+                    low[u] = std::min(low[u], index[v]);
+                }
+                continue;
+            }
+            NetworKit::node v = u;
+            calls.pop_back();
+            if (!calls.empty()) {
+                low[calls.back().first] = std::min(low[calls.back().first], low[v]);
+            }
+            if (low[v] == index[v]) {
+                components.emplace_back();
+                NetworKit::node x;
+                do {
+                    x = stack.back(), stack.pop_back();
+                    component[x] = components.size() - 1, components.back().push_back(x);
+                } while (x != v);
+            }
+        }
+    }
+
+    bool changed = false;
+    for (const auto &C : components) {
+        if (C.size() < 2) {
+            continue;
+        }
+        NetworKit::node attachment = NetworKit::none;
+        bool single = true;
+        for (auto v : C) {
+            bool boundary = v == source || v == target;
+            for (auto a : in_arcs[v]) {
+                boundary = boundary || component[tail[a]] != component[v];
+            }
+            for (auto a : out_arcs[v]) {
+                boundary = boundary || component[head[a]] != component[v];
+            }
+            if (boundary) {
+                single = single && attachment == NetworKit::none;
+                attachment = v;
+            }
+        }
+        if (!single || attachment == NetworKit::none) {
+            continue;
+        }
+        // every flow entering the component leaves it through the same vertex
+        for (auto v : C) {
+            if (v != attachment) {
+                reductions.push_back({Reduction::Type::SAME_SIDE, v, attachment, v, 0, 0, false});
+                remove_node(v);
+                changed = true;
+            }
+        }
+    }
+    return changed;
+}
+
+bool MaximumFlowPreprocessing::merge_parallel_arcs() {
+    KOALA_PROFILE_REGION("parallel arcs");
+    std::vector<NetworKit::index> arc(node_alive.size(), NetworKit::none);
+    bool changed = false;
+    for (NetworKit::node u = 0; u < node_alive.size(); u++) {
+        for (auto a : out_arcs[u]) {
+            if (arc[head[a]] == NetworKit::none) {
+                arc[head[a]] = a;
+            } else {
+                capacity[arc[head[a]]] += capacity[a], arc_alive[a] = false;
+                changed = true;
+            }
+        }
+        for (auto a : out_arcs[u]) {
+            arc[head[a]] = NetworKit::none;
+        }
+    }
+    return changed;
+}
+
+bool MaximumFlowPreprocessing::contract_series_arcs() {
+    KOALA_PROFILE_REGION("series arcs");
+    auto find_single = [&](const std::vector<NetworKit::index> &arcs) {
+        NetworKit::index result = NetworKit::none;
+        for (auto a : arcs) {
+            if (arc_alive[a]) {
+                if (result != NetworKit::none) {
+                    return NetworKit::none;
+                }
+                result = a;
+            }
+        }
+        return result;
+    };
+    std::vector<NetworKit::node> queue;
+    for (NetworKit::node v = 0; v < node_alive.size(); v++) {
+        if (node_alive[v] && v != source && v != target) {
+            queue.push_back(v);
+        }
+    }
+    bool changed = false;
+    while (!queue.empty()) {
+        NetworKit::node v = queue.back();
+        queue.pop_back();
+        if (!node_alive[v]) {
+            continue;
+        }
+        NetworKit::index a_in = find_single(in_arcs[v]), a_out = find_single(out_arcs[v]);
+        if (a_in == NetworKit::none || a_out == NetworKit::none) {
+            continue;
+        }
+        NetworKit::node u = tail[a_in], w = head[a_out];
+        reductions.push_back({
+            Reduction::Type::SERIES, v, u, w, capacity[a_in], capacity[a_out], false});
+        NetworKit::edgeweight c = std::min(capacity[a_in], capacity[a_out]);
+        remove_node(v);
+        if (u != w) {
+            add_arc(u, w, c);
+        } else if (u != source && u != target) {
+            queue.push_back(u);
+        }
+        changed = true;
+    }
+    return changed;
+}
+
+void MaximumFlowPreprocessing::run() {
+    KOALA_PROFILE_RUN();
+    NetworKit::count n = graph->upperNodeIdBound();
+    tail.clear(), head.clear(), capacity.clear(), arc_alive.clear(), reductions.clear();
+    in_arcs.assign(n, {}), out_arcs.assign(n, {});
+    node_alive.assign(n, false);
+    graph->forNodes([&](NetworKit::node v) {
+        node_alive[v] = true;
+    });
+    graph->forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        if (u == v || w <= 0) {
+            return;
+        }
+        if (u != target && v != source) {
+            add_arc(u, v, w);
+        }
+        if (!graph->isDirected() && v != target && u != source) {
+            add_arc(v, u, w);
+        }
+    });
+
+    for (bool changed = true; changed; ) {
+        changed = prune_unreachable();
+        compact();
+        changed = prune_strongly_connected_components() || changed;
+        compact();
+        changed = merge_parallel_arcs() || changed;
+        compact();
+        changed = contract_series_arcs() || changed;
+        compact();
+    }
+
+    label.assign(n, NetworKit::none);
+    NetworKit::count k = 0;
+    for (NetworKit::node v = 0; v < n; v++) {
+        if (node_alive[v]) {
+            label[v] = k++;
+        }
+    }
+    // as in DimacsGraphReader, every arc comes with the reverse one, possibly of zero capacity
+    reduced = NetworKit::Graph(k, true, true);
+    for (NetworKit::index a = 0; a < tail.size(); a++) {
+        if (arc_alive[a]) {
+            reduced->increaseWeight(label[tail[a]], label[head[a]], capacity[a]);
+            reduced->increaseWeight(label[head[a]], label[tail[a]], 0);
+        }
+    }
+    hasRun = true;
+}
+
+}  /* namespace Koala */
@@ -182,15 +182,15 @@ long double KRTEdgeDesignator::reset() {
     return k;
 }
 
-void KRTEdgeDesignator::initialize(const std::optional<NetworKit::Graph> &graph) {
-    int n = graph->numberOfNodes();
+void KRTEdgeDesignator::initialize(const NetworKit::Graph &graph) {
+    int n = graph.numberOfNodes();
     MAX_K = 2 * n, N = (n + 1) * MAX_K, M = 0;
     U = std::vector<std::vector<int>>(N), V = std::vector<std::vector<int>>(N);
     degU = std::vector<int>(N, 0);
     designated = std::vector<int>(N, -1);
     rl = std::vector<int>(N, 0), erl = std::vector<int>(N, 0);
 
-    graph->forEdges([&](NetworKit::node u, NetworKit::node v) {
+    graph.forEdges([&](NetworKit::node u, NetworKit::node v) {
         for (int k = 1; k < MAX_K; k++, M++) {
             int left = encodeId(u, k), right = encodeId(v, k - 1);
             U[left].push_back(right);
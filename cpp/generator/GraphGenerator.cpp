@@ -0,0 +1,456 @@
+/*
+ * GraphGenerator.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <generator/GraphGenerator.hpp>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+#include <networkit/auxiliary/Parallel.hpp>
+
+#include <structures/Random.hpp>
+
+namespace Koala {
+
+GraphGenerator::GraphGenerator(uint64_t seed) : seed(seed) { }
+
+bool GraphGenerator::isWeighted() const {
+    return false;
+}
+
+bool GraphGenerator::isDirected() const {
+    return false;
+}
+
+NetworKit::count GraphGenerator::numberOfEdges() const {
+    NetworKit::count m = 0;
+    forEdges([&](NetworKit::node, NetworKit::node, NetworKit::edgeweight) { m++; });
+    return m;
+}
+
+NetworKit::Graph GraphGenerator::generate() const {
+    NetworKit::Graph G(numberOfNodes(), isWeighted(), isDirected());
+    bool flow_network = isWeighted() && isDirected();
+    forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        if (flow_network) {
+            G.increaseWeight(u, v, w);
+            G.increaseWeight(v, u, 0);
+        } else {
+            G.addEdge(u, v, w);
+        }
+    });
+    G.shrinkToFit();
+    return G;
+}
+
+void GraphGenerator::forChunks(
+        NetworKit::count items, const ChunkGenerator &generator,
+        const EdgeCallback &callback) const {
+    const NetworKit::count chunks = (items + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    const NetworKit::count batch = 4 * static_cast<NetworKit::count>(omp_get_max_threads());
+    std::vector<std::vector<NetworKit::WeightedEdge>> buffers(batch);
+    for (NetworKit::index first = 0; first < chunks; first += batch) {
+        const auto last = static_cast<int64_t>(std::min(chunks, first + batch));
+        #pragma omp parallel for schedule(dynamic, 1)
+        for (int64_t chunk = static_cast<int64_t>(first); chunk < last; chunk++) {
+            const auto i = static_cast<NetworKit::index>(chunk);
+            auto &buffer = buffers[i - first];
+            buffer.clear();
+            generator(i, i * CHUNK_SIZE, std::min(items, (i + 1) * CHUNK_SIZE), buffer);
+        }
+        for (NetworKit::index i = 0; i < static_cast<NetworKit::index>(last) - first; i++) {
+            for (const auto &e : buffers[i]) {
+                callback(e.u, e.v, e.weight);
+            }
+        }
+    }
+}
+
+uint64_t GraphGenerator::hash(uint64_t stream, uint64_t counter) const {
+    return Philox(seed, stream)[counter];
+}
+
+double GraphGenerator::uniform(uint64_t stream, uint64_t counter) const {
+    return to_unit(hash(stream, counter));
+}
+
+bool FlowNetworkGenerator::isWeighted() const {
+    return true;
+}
+
+bool FlowNetworkGenerator::isDirected() const {
+    return true;
+}
+
+ErdosRenyiGenerator::ErdosRenyiGenerator(
+        NetworKit::count n, double p, bool directed, uint64_t seed)
+    : GraphGenerator(seed), n(n), p(p), directed(directed) { }
+
+NetworKit::count ErdosRenyiGenerator::numberOfNodes() const {
+    return n;
+}
+
+bool ErdosRenyiGenerator::isDirected() const {
+    return directed;
+}
+
+void ErdosRenyiGenerator::forEdges(const EdgeCallback &callback) const {
+    if (p <= 0.0) {
+        return;
+    }
+    const double log_q = std::log1p(-std::min(p, 1.0));
+    forChunks(n, [&](NetworKit::index chunk, NetworKit::index begin, NetworKit::index end,
+            std::vector<NetworKit::WeightedEdge> &edges) {
+        Philox random(hash(0, chunk));
+        for (NetworKit::node u = begin; u < end; u++) {
+            // candidates are v < u for undirected graphs and v != u for directed ones
+            const NetworKit::count candidates = directed ? n - 1 : u;
+            for (NetworKit::index i = 0; ; i++) {
+                if (p < 1.0) {
+                    auto skip = std::floor(std::log1p(-random.real()) / log_q);
+                    if (skip >= static_cast<double>(candidates - i)) {
+                        break;
+                    }
+                    i += static_cast<NetworKit::index>(skip);
+                }
+                if (i >= candidates) {
+                    break;
+                }
+                NetworKit::node v = directed && i >= u ? i + 1 : i;
+                edges.emplace_back(u, v, NetworKit::defaultEdgeWeight);
+            }
+        }
+    }, callback);
+}
+
+RmatGenerator::RmatGenerator(
+        NetworKit::count scale, NetworKit::count edge_factor, double a, double b, double c,
+        uint64_t seed)
+    : GraphGenerator(seed), scale(scale), edge_factor(edge_factor), a(a), b(b), c(c) { }
+
+NetworKit::count RmatGenerator::numberOfNodes() const {
+    return NetworKit::count(1) << scale;
+}
+
+void RmatGenerator::forEdges(const EdgeCallback &callback) const {
+    forChunks(edge_factor * numberOfNodes(), [&](NetworKit::index, NetworKit::index begin,
+            NetworKit::index end, std::vector<NetworKit::WeightedEdge> &edges) {
+        for (NetworKit::index e = begin; e < end; e++) {
+            NetworKit::node u = 0, v = 0;
+            for (NetworKit::index level = 0; level < scale; level++) {
+                // quadrants a, b, c, d are top-left, top-right, bottom-left, bottom-right
+                double r = uniform(e, level);
+                u = (u << 1) | (r >= a + b ? 1 : 0);
+                v = (v << 1) | ((r >= a && r < a + b) || r >= a + b + c ? 1 : 0);
+            }
+            if (u != v) {
+                edges.emplace_back(std::max(u, v), std::min(u, v), NetworKit::defaultEdgeWeight);
+            }
+        }
+    }, callback);
+}
+
+NetworKit::Graph RmatGenerator::generate() const {
+    std::vector<NetworKit::Edge> edges;
+    forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight) {
+        edges.emplace_back(u, v);
+    });
+    Aux::Parallel::sort(edges.begin(), edges.end(), [](const auto &e1, const auto &e2) {
+        return e1.u < e2.u || (e1.u == e2.u && e1.v < e2.v);
+    });
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    NetworKit::Graph G(numberOfNodes(), false, false);
+    for (const auto &e : edges) {
+        G.addEdge(e.u, e.v);
+    }
+    G.shrinkToFit();
+    return G;
+}
+
+RandomGeometricGenerator::RandomGeometricGenerator(
+        NetworKit::count n, double radius, uint64_t seed)
+    : GraphGenerator(seed), n(n), radius(radius) { }
+
+NetworKit::count RandomGeometricGenerator::numberOfNodes() const {
+    return n;
+}
+
+bool RandomGeometricGenerator::isWeighted() const {
+    return true;
+}
+
+void RandomGeometricGenerator::forEdges(const EdgeCallback &callback) const {
+    auto x = [&](NetworKit::node v) { return uniform(v, 0); };
+    auto y = [&](NetworKit::node v) { return uniform(v, 1); };
+    const auto side = static_cast<NetworKit::index>(
+        std::clamp(std::floor(1.0 / radius), 1.0, std::sqrt(static_cast<double>(n)) + 1.0));
+    auto cell = [&](double coordinate) {
+        return std::min(side - 1, static_cast<NetworKit::index>(coordinate * side));
+    };
+    // bucket the points into a side x side grid of cells, each at least radius wide
+    std::vector<NetworKit::index> start(side * side + 1, 0);
+    std::vector<NetworKit::node> points(n);
+    for (NetworKit::node v = 0; v < n; v++) {
+        start[cell(x(v)) * side + cell(y(v)) + 1]++;
+    }
+    std::partial_sum(start.begin(), start.end(), start.begin());
+    std::vector<NetworKit::index> position(start.begin(), start.end() - 1);
+    for (NetworKit::node v = 0; v < n; v++) {
+        points[position[cell(x(v)) * side + cell(y(v))]++] = v;
+    }
+    forChunks(n, [&](NetworKit::index, NetworKit::index begin, NetworKit::index end,
+            std::vector<NetworKit::WeightedEdge> &edges) {
+        for (NetworKit::node u = begin; u < end; u++) {
+            const double xu = x(u), yu = y(u);
+            const auto cx = static_cast<int64_t>(cell(xu)), cy = static_cast<int64_t>(cell(yu));
+            for (int64_t i = std::max<int64_t>(cx - 1, 0);
+                    i <= std::min<int64_t>(cx + 1, static_cast<int64_t>(side) - 1); i++) {
+                for (int64_t j = std::max<int64_t>(cy - 1, 0);
+                        j <= std::min<int64_t>(cy + 1, static_cast<int64_t>(side) - 1); j++) {
+                    const auto k = static_cast<NetworKit::index>(i) * side
+                        + static_cast<NetworKit::index>(j);
+                    for (NetworKit::index l = start[k]; l < start[k + 1]; l++) {
+                        const NetworKit::node v = points[l];
+                        const double distance = std::hypot(xu - x(v), yu - y(v));
+                        if (v < u && distance <= radius) {
+                            edges.emplace_back(u, v, distance);
+                        }
+                    }
+                }
+            }
+        }
+    }, callback);
+}
+
+GridGenerator::GridGenerator(
+        NetworKit::count rows, NetworKit::count columns, double keep_probability,
+        NetworKit::count max_weight, uint64_t seed)
+    : GraphGenerator(seed), rows(rows), columns(columns), keep_probability(keep_probability),
+      max_weight(max_weight) {
+    if (max_weight == 0) {
+        throw std::invalid_argument("The maximum weight has to be positive");
+    }
+}
+
+NetworKit::count GridGenerator::numberOfNodes() const {
+    return rows * columns;
+}
+
+bool GridGenerator::isWeighted() const {
+    return max_weight > 1;
+}
+
+void GridGenerator::forEdges(const EdgeCallback &callback) const {
+    forChunks(rows * columns, [&](NetworKit::index, NetworKit::index begin, NetworKit::index end,
+            std::vector<NetworKit::WeightedEdge> &edges) {
+        for (NetworKit::node u = begin; u < end; u++) {
+            const NetworKit::index r = u / columns, c = u % columns;
+            const bool has_neighbor[] = { c + 1 < columns, r + 1 < rows };
+            const NetworKit::node neighbor[] = { u + 1, u + columns };
+            for (NetworKit::index direction = 0; direction < 2; direction++) {
+                if (!has_neighbor[direction]
+                        || uniform(u, 2 * direction) >= keep_probability) {
+                    continue;
+                }
+                auto w = 1 + hash(u, 2 * direction + 1) % max_weight;
+                edges.emplace_back(neighbor[direction], u, static_cast<NetworKit::edgeweight>(w));
+            }
+        }
+    }, callback);
+}
+
+RandomIntervalGenerator::RandomIntervalGenerator(
+        NetworKit::count n, double max_length, uint64_t seed)
+    : GraphGenerator(seed), n(n), max_length(max_length) { }
+
+NetworKit::count RandomIntervalGenerator::numberOfNodes() const {
+    return n;
+}
+
+void RandomIntervalGenerator::forEdges(const EdgeCallback &callback) const {
+    std::vector<double> left(n), right(n);
+    #pragma omp parallel for
+    for (int64_t i = 0; i < static_cast<int64_t>(n); i++) {
+        auto v = static_cast<NetworKit::node>(i);
+        left[v] = uniform(v, 0);
+        right[v] = left[v] + max_length * uniform(v, 1);
+    }
+    std::vector<NetworKit::node> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    Aux::Parallel::sort(order.begin(), order.end(), [&](NetworKit::node u, NetworKit::node v) {
+        return left[u] < left[v] || (left[u] == left[v] && u < v);
+    });
+    forChunks(n, [&](NetworKit::index, NetworKit::index begin, NetworKit::index end,
+            std::vector<NetworKit::WeightedEdge> &edges) {
+        for (NetworKit::index i = begin; i < end; i++) {
+            const NetworKit::node u = order[i];
+            for (NetworKit::index j = i + 1; j < n && left[order[j]] <= right[u]; j++) {
+                edges.emplace_back(std::max(u, order[j]), std::min(u, order[j]),
+                    NetworKit::defaultEdgeWeight);
+            }
+        }
+    }, callback);
+}
+
+AKFlowNetworkGenerator::AKFlowNetworkGenerator(NetworKit::count k)
+    : FlowNetworkGenerator(0), k(k) { }
+
+NetworKit::count AKFlowNetworkGenerator::numberOfNodes() const {
+    return 3 * k + 2;
+}
+
+NetworKit::node AKFlowNetworkGenerator::getSource() const {
+    return 0;
+}
+
+NetworKit::node AKFlowNetworkGenerator::getTarget() const {
+    return 1;
+}
+
+void AKFlowNetworkGenerator::forEdges(const EdgeCallback &callback) const {
+    if (k == 0) {
+        return;
+    }
+    const NetworKit::node s = getSource(), t = getTarget();
+    auto path = [&](NetworKit::index i) { return 2 + i; };
+    auto ladder = [&](NetworKit::index i) { return 2 + k + i; };
+    auto shared = [&](NetworKit::index i) { return 2 + 2 * k + i; };
+    auto capacity = [](NetworKit::count c) { return static_cast<NetworKit::edgeweight>(c); };
+    callback(s, path(0), capacity(k));
+    callback(s, ladder(0), capacity(k));
+    for (NetworKit::index i = 0; i < k; i++) {
+        if (i + 1 < k) {
+            callback(path(i), path(i + 1), capacity(k - 1 - i));
+            callback(ladder(i), ladder(i + 1), capacity(k - 1 - i));
+            callback(shared(i), shared(i + 1), capacity(k));
+        }
+        callback(path(i), t, capacity(1));
+        callback(ladder(i), shared(i), capacity(1));
+    }
+    callback(shared(k - 1), t, capacity(k));
+}
+
+WashingtonFlowNetworkGenerator::WashingtonFlowNetworkGenerator(
+        NetworKit::count rows, NetworKit::count columns, NetworKit::count max_capacity,
+        uint64_t seed)
+    : FlowNetworkGenerator(seed), rows(rows), columns(columns), max_capacity(max_capacity) {
+    if (max_capacity == 0) {
+        throw std::invalid_argument("The maximum capacity has to be positive");
+    }
+}
+
+NetworKit::count WashingtonFlowNetworkGenerator::numberOfNodes() const {
+    return rows * columns + 2;
+}
+
+NetworKit::node WashingtonFlowNetworkGenerator::getSource() const {
+    return 0;
+}
+
+NetworKit::node WashingtonFlowNetworkGenerator::getTarget() const {
+    return 1;
+}
+
+void WashingtonFlowNetworkGenerator::forEdges(const EdgeCallback &callback) const {
+    const NetworKit::count DEGREE = 3;
+    const auto infinity = static_cast<NetworKit::edgeweight>(DEGREE * max_capacity);
+    auto grid = [&](NetworKit::index r, NetworKit::index c) { return 2 + c * rows + r; };
+    for (NetworKit::index r = 0; r < rows && columns > 0; r++) {
+        callback(getSource(), grid(r, 0), infinity);
+    }
+    forChunks(rows * columns, [&](NetworKit::index, NetworKit::index begin,
+            NetworKit::index end, std::vector<NetworKit::WeightedEdge> &edges) {
+        for (NetworKit::index i = begin; i < end; i++) {
+            const NetworKit::index c = i / rows, r = i % rows;
+            if (c + 1 == columns) {
+                edges.emplace_back(grid(r, c), getTarget(), infinity);
+                continue;
+            }
+            for (NetworKit::index j = 0; j < DEGREE; j++) {
+                auto next = grid(hash(i, 2 * j) % rows, c + 1);
+                auto w = 1 + hash(i, 2 * j + 1) % max_capacity;
+                edges.emplace_back(grid(r, c), next, static_cast<NetworKit::edgeweight>(w));
+            }
+        }
+    }, callback);
+}
+
+SegmentationFlowNetworkGenerator::SegmentationFlowNetworkGenerator(
+        NetworKit::count width, NetworKit::count height, NetworKit::count depth,
+        NetworKit::count max_capacity, uint64_t seed)
+    : FlowNetworkGenerator(seed), width(width), height(height), depth(depth),
+      max_capacity(max_capacity) { }
+
+NetworKit::count SegmentationFlowNetworkGenerator::numberOfNodes() const {
+    return width * height * depth + 2;
+}
+
+NetworKit::node SegmentationFlowNetworkGenerator::getSource() const {
+    return 0;
+}
+
+NetworKit::node SegmentationFlowNetworkGenerator::getTarget() const {
+    return 1;
+}
+
+void SegmentationFlowNetworkGenerator::forEdges(const EdgeCallback &callback) const {
+    const NetworKit::count WAVES = 3;
+    const uint64_t FIELD = ~0ULL;
+    const double PI = std::acos(-1.0);
+    // the smooth part of the intensity is a sum of random plane waves over a few grid periods
+    auto intensity = [&](NetworKit::index x, NetworKit::index y, NetworKit::index z) {
+        double value = 0;
+        for (NetworKit::index k = 0; k < WAVES; k++) {
+            double phase = 2 * PI * uniform(FIELD, 4 * k);
+            double fx = (1 + 3 * uniform(FIELD, 4 * k + 1)) / width;
+            double fy = (1 + 3 * uniform(FIELD, 4 * k + 2)) / height;
+            double fz = (1 + 3 * uniform(FIELD, 4 * k + 3)) / depth;
+            value += std::sin(2 * PI * (fx * x + fy * y + fz * z) + phase);
+        }
+        auto v = (z * height + y) * width + x;
+        return std::clamp(0.5 + 0.3 * value / WAVES + 0.4 * (uniform(v, 0) - 0.5), 0.0, 1.0);
+    };
+    auto cell = [&](NetworKit::index x, NetworKit::index y, NetworKit::index z) {
+        return 2 + (z * height + y) * width + x;
+    };
+    auto capacity = [&](double c) {
+        return static_cast<NetworKit::edgeweight>(std::llround(c * max_capacity));
+    };
+    forChunks(width * height * depth, [&](NetworKit::index, NetworKit::index begin,
+            NetworKit::index end, std::vector<NetworKit::WeightedEdge> &edges) {
+        for (NetworKit::index i = begin; i < end; i++) {
+            const NetworKit::index x = i % width, y = i / width % height, z = i / (width * height);
+            const double p = intensity(x, y, z);
+            if (capacity(p) > 0) {
+                edges.emplace_back(getSource(), cell(x, y, z), capacity(p));
+            }
+            if (capacity(1 - p) > 0) {
+                edges.emplace_back(cell(x, y, z), getTarget(), capacity(1 - p));
+            }
+            auto join = [&](NetworKit::index nx, NetworKit::index ny, NetworKit::index nz) {
+                double difference = p - intensity(nx, ny, nz);
+                auto w = 1 + capacity(0.5 * std::exp(-8 * difference * difference));
+                edges.emplace_back(cell(x, y, z), cell(nx, ny, nz), w);
+                edges.emplace_back(cell(nx, ny, nz), cell(x, y, z), w);
+            };
+            if (x + 1 < width) {
+                join(x + 1, y, z);
+            }
+            if (y + 1 < height) {
+                join(x, y + 1, z);
+            }
+            if (z + 1 < depth) {
+                join(x, y, z + 1);
+            }
+        }
+    }, callback);
+}
+
+} /* namespace Koala */
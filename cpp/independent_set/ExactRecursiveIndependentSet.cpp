@@ -15,15 +15,21 @@
 namespace Koala {
 
 void RecursiveIndependentSet::run() {
+    interrupted = false;
     auto result = recursive();
     independentSet = std::set(result.begin(), result.end());
+    optimal = !interrupted;
     hasRun = true;
 }
 
 std::vector<NetworKit::node> Mis1IndependentSet::recursive() {
+    SearchArena::Frame frame(arena);
     if (graph->isEmpty()) {
         return {};
     }
+    if (pollStopRequested()) {
+        return runIndependentSetGreedy();
+    }
     int selectedToSet;
     std::vector<NetworKit::node> largestSet;
     for (auto u : getNeighborsPlus(getMinimumDegreeNode())) {
@@ -42,9 +48,13 @@ std::vector<NetworKit::node> Mis1IndependentSet::recursive() {
 }
 
 std::vector<NetworKit::node> Mis2IndependentSet::recursive() {
+    SearchArena::Frame frame(arena);
     if (graph->isEmpty()) {
         return {};
     }
+    if (pollStopRequested()) {
+        return runIndependentSetGreedy();
+    }
 
     auto v = getMinimumDegreeNode();
     switch (graph->degree(v)) {
@@ -296,7 +306,8 @@ std::vector<NetworKit::node> Mis2IndependentSet::recursive() {
     auto vNeighborsPlus = getNeighborsPlus(v);  // for case 1
     auto vMirrors = getMirrors(v);  // for case 2
     auto wNeighborsPlus = getNeighborsPlus(w);
-    std::set<NetworKit::node> case2TemporarySet(vMirrors.begin(), vMirrors.end());
+    std::pmr::set<NetworKit::node> case2TemporarySet(
+        vMirrors.begin(), vMirrors.end(), arena.resource());
     case2TemporarySet.insert(wNeighborsPlus.begin(), wNeighborsPlus.end());
     std::vector<NetworKit::node> vMirrorsWNeighborsPlus(
         case2TemporarySet.begin(), case2TemporarySet.end());
@@ -332,9 +343,13 @@ std::vector<NetworKit::node> Mis2IndependentSet::recursive() {
 }
 
 std::vector<NetworKit::node> Mis3IndependentSet::recursive() {
+    SearchArena::Frame frame(arena);
     if (graph->isEmpty()) {
         return {};
     }
+    if (pollStopRequested()) {
+        return runIndependentSetGreedy();
+    }
     auto u = getMinimumDegreeNode();
     switch (graph->degree(u)) {
     case 0: {
@@ -379,9 +394,13 @@ std::vector<NetworKit::node> Mis3IndependentSet::recursive() {
 }
 
 std::vector<NetworKit::node> Mis4IndependentSet::recursive() {
+    SearchArena::Frame frame(arena);
     if (graph->isEmpty()) {
         return {};
     }
+    if (pollStopRequested()) {
+        return runIndependentSetGreedy();
+    }
 
     auto v = getMaximumDegreeNode();
     if (graph->degree(v) >= 3) {
@@ -411,9 +430,13 @@ std::vector<NetworKit::node> Mis4IndependentSet::recursive() {
 }
 
 std::vector<NetworKit::node> Mis5IndependentSet::recursive() {
+    SearchArena::Frame frame(arena);
     if (graph->isEmpty()) {
         return {};
     }
+    if (pollStopRequested()) {
+        return runIndependentSetGreedy();
+    }
 
     auto v = getMaximumDegreeNode();
     if (graph->degree(v) >= 3) {
@@ -436,9 +459,13 @@ std::vector<NetworKit::node> Mis5IndependentSet::recursive() {
 }
 
 std::vector<NetworKit::node> MeasureAndConquerIndependentSet::recursive() {
+    SearchArena::Frame frame(arena);
     if (graph->isEmpty()) {
         return {};
     }
+    if (pollStopRequested()) {
+        return runIndependentSetGreedy();
+    }
     std::vector<bool> visited(graph->upperNodeIdBound(), false);
     Koala::Traversal::DFSFrom(
         *graph, *graph->nodeRange().begin(),
@@ -472,12 +499,13 @@ std::vector<NetworKit::node> MeasureAndConquerIndependentSet::recursive() {
 
     struct NodeNeighbors {
         NetworKit::node index;
-        std::set<NetworKit::node> neighbors;
+        std::pmr::set<NetworKit::node> neighbors;
     };
-    std::vector<NodeNeighbors> nodeNeighbors;
+    std::pmr::vector<NodeNeighbors> nodeNeighbors(arena.resource());
     graph->forNodes([&](NetworKit::node v) {
         std::vector<NetworKit::node> vec = getNeighborsPlus(v);
-        nodeNeighbors.push_back({v, std::set<NetworKit::node>(vec.begin(), vec.end())});
+        nodeNeighbors.push_back(
+            {v, std::pmr::set<NetworKit::node>(vec.begin(), vec.end(), arena.resource())});
     });
 
     for (auto &nodeV : nodeNeighbors) {
@@ -599,15 +627,16 @@ std::vector<NetworKit::node> MeasureAndConquerIndependentSet::recursive() {
                     NetworKit::node oldU1, oldU2, u12;
                 };
                 std::vector<FoldingNode> foldingNodes;  // create one for each antiedge
-                std::vector<std::set<NetworKit::node>> vNeighborsNeighbors(
-                    graph->upperNodeIdBound());
-                std::set<NetworKit::node> vNeighborsPlusSet(vNeighbors.begin(), vNeighbors.end());
+                std::pmr::vector<std::pmr::set<NetworKit::node>> vNeighborsNeighbors(
+                    graph->upperNodeIdBound(), arena.resource());
+                std::pmr::set<NetworKit::node> vNeighborsPlusSet(
+                    vNeighbors.begin(), vNeighbors.end(), arena.resource());
                 vNeighborsPlusSet.insert(v);
 
                 for (auto u : vNeighbors) {
                     std::vector<NetworKit::node> uNeighborsVect = getNeighbors(u);
-                    std::set<NetworKit::node> uNeighborsSet(
-                        uNeighborsVect.begin(), uNeighborsVect.end());
+                    std::pmr::set<NetworKit::node> uNeighborsSet(
+                        uNeighborsVect.begin(), uNeighborsVect.end(), arena.resource());
                     std::set_difference(
                         uNeighborsSet.begin(), uNeighborsSet.end(),
                         vNeighborsPlusSet.begin(), vNeighborsPlusSet.end(),
@@ -14,6 +14,9 @@ namespace Koala {
 IndependentSet::IndependentSet(const NetworKit::Graph &graph)
     : graph(std::make_optional(graph)) { }
 
+IndependentSet::IndependentSet(std::shared_ptr<const NetworKit::Graph> graph)
+    : IndependentSet(*graph) { }
+
 bool IndependentSet::edgeComparator(const NetworKit::Edge& a, const NetworKit::Edge& b) {
     return a.u < b.u || (a.u == b.u && a.v < b.v);
 }
@@ -23,6 +26,10 @@ const std::set<NetworKit::node>& IndependentSet::getIndependentSet() const {
     return independentSet;
 }
 
+void IndependentSet::setMemoryResource(std::pmr::memory_resource *resource) {
+    arena = SearchArena(resource);
+}
+
 void IndependentSet::check() const {
     assureFinished();
     graph->forEdges([&](NetworKit::node u, NetworKit::node v) {
@@ -65,7 +72,7 @@ std::vector<NetworKit::node> IndependentSet::getNeighbors2(NetworKit::node v) co
 
 IndependentSet::EdgeSet IndependentSet::getConnectedEdges(
         std::vector<NetworKit::node>& nodes) const {
-    EdgeSet connectedEdges(edgeComparator);
+    EdgeSet connectedEdges(edgeComparator, arena.resource());
     for (auto u : nodes) {
         graph->forNeighborsOf(u, [&](NetworKit::node v) {
             connectedEdges.insert(NetworKit::Edge(u, v, true));
@@ -76,8 +83,8 @@ IndependentSet::EdgeSet IndependentSet::getConnectedEdges(
 
 IndependentSet::EdgeSet IndependentSet::getInducedEdges(
         std::vector<NetworKit::node>& nodes) const {
-    EdgeSet connectedEdges(edgeComparator);
-    std::set<NetworKit::node> nodeSet(nodes.begin(), nodes.end());
+    EdgeSet connectedEdges(edgeComparator, arena.resource());
+    std::pmr::set<NetworKit::node> nodeSet(nodes.begin(), nodes.end(), arena.resource());
     for (auto u : nodes) {
         graph->forNeighborsOf(u, [&](NetworKit::node v) {
             if (nodeSet.contains(v)) {
@@ -92,7 +99,8 @@ std::vector<NetworKit::node> IndependentSet::getMirrors(NetworKit::node v) const
     std::vector<NetworKit::node> mirrors, neighborsV = getNeighbors(v);
     for (auto w : getNeighbors2(v)) {
         std::vector<NetworKit::node> neighborsW = getNeighbors(w);
-        std::set<NetworKit::node> potentialClique(neighborsV.begin(), neighborsV.end());
+        std::pmr::set<NetworKit::node> potentialClique(
+            neighborsV.begin(), neighborsV.end(), arena.resource());
         for (auto node : neighborsW) {
             potentialClique.erase(node);
         }
@@ -123,7 +131,7 @@ NetworKit::node IndependentSet::getMaximumDegreeNode() const {
         [&](NetworKit::node v, NetworKit::node u) {return graph->degree(v) < graph->degree(u);});
 }
 
-void IndependentSet::removeElements(std::vector<NetworKit::node> nodes) {
+void IndependentSet::removeElements(const std::vector<NetworKit::node> &nodes) {
     for (auto v : nodes) {
         graph->removeNode(v);
     }
@@ -171,7 +179,25 @@ std::vector<NetworKit::node> IndependentSet::runIndependentSetDegree2() const {
     return independentSet;
 }
 
+std::vector<NetworKit::node> IndependentSet::runIndependentSetGreedy() const {
+    std::vector<NetworKit::node> nodes(graph->nodeRange().begin(), graph->nodeRange().end());
+    std::stable_sort(nodes.begin(), nodes.end(), [&](NetworKit::node v, NetworKit::node u) {
+        return graph->degree(v) < graph->degree(u);
+    });
+    std::vector<bool> blocked(graph->upperNodeIdBound());
+    std::vector<NetworKit::node> independentSet;
+    for (auto v : nodes) {
+        if (!blocked[v]) {
+            independentSet.push_back(v);
+            graph->forNeighborsOf(v, [&](NetworKit::node u) { blocked[u] = true; });
+        }
+    }
+    return independentSet;
+}
+
 void BruteForceIndependentSet::run() {
+    interrupted = false;
+    optimal = true;
     if (graph->isEmpty()) {
         return;
     }
@@ -182,6 +208,9 @@ void BruteForceIndependentSet::run() {
     int best = 0;
     uint64_t max = (1 << graph->numberOfNodes());
     for (unsigned long long binary = 1; binary != max; ++binary) {
+        if (pollStopRequested()) {
+            break;
+        }
         std::bitset<8 * sizeof(uint64_t)> testSet(binary);
         size_t testSetSize = testSet.count();
         if (testSetSize <= best) {
@@ -204,6 +233,7 @@ void BruteForceIndependentSet::run() {
             best = testSetSize;
         }
     }
+    optimal = !interrupted;
     hasRun = true;
 }
 
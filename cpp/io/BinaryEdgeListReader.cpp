@@ -0,0 +1,69 @@
+/*
+ * BinaryEdgeListReader.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <io/BinaryEdgeListReader.hpp>
+
+namespace Koala {
+
+MappedBinaryEdgeList::MappedBinaryEdgeList(const std::string &path) {
+    int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        throw std::runtime_error("Unable to open file: " + path);
+    }
+    struct stat status;
+    if (fstat(descriptor, &status) != 0) {
+        close(descriptor);
+        throw std::runtime_error("Unable to open file: " + path);
+    }
+    size = status.st_size;
+    if (size < sizeof(BinaryEdgeListHeader)) {
+        close(descriptor);
+        throw std::runtime_error("Not a binary edge list: " + path);
+    }
+    data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+    if (data == MAP_FAILED) {
+        throw std::runtime_error("Unable to map file: " + path);
+    }
+    madvise(data, size, MADV_SEQUENTIAL);
+    header = static_cast<const BinaryEdgeListHeader*>(data);
+    edges = reinterpret_cast<const BinaryEdge*>(header + 1);
+    // the number of edges is compared without multiplying it, so that it cannot overflow
+    if (!std::equal(header->magic, header->magic + 8, BinaryEdgeListHeader::MAGIC)
+            || header->edges > (size - sizeof(BinaryEdgeListHeader)) / sizeof(BinaryEdge)) {
+        munmap(data, size);
+        throw std::runtime_error("Not a binary edge list: " + path);
+    }
+    if (std::any_of(begin(), end(), [&](const BinaryEdge &e) {
+            return e.u >= header->nodes || e.v >= header->nodes; })) {
+        munmap(data, size);
+        throw std::runtime_error("Edge endpoint out of range in binary edge list: " + path);
+    }
+}
+
+MappedBinaryEdgeList::~MappedBinaryEdgeList() {
+    munmap(data, size);
+}
+
+NetworKit::Graph BinaryEdgeListReader::read(const std::string &path) {
+    MappedBinaryEdgeList edges(path);
+    NetworKit::Graph graph(edges.numberOfNodes(), true, false);
+    for (const auto &e : edges) {
+        graph.addEdge(e.u, e.v, e.weight);
+    }
+    graph.shrinkToFit();
+    return graph;
+}
+
+}  /* namespace Koala */
@@ -0,0 +1,72 @@
+/*
+ * BinaryEdgeListWriter.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include <networkit/auxiliary/Enforce.hpp>
+
+#include <io/BinaryEdgeListWriter.hpp>
+
+namespace Koala {
+
+void BinaryEdgeListWriter::write(const NetworKit::Graph &G, const std::string &path) {
+    write(G.upperNodeIdBound(), [&](const EdgeCallback &callback) {
+        G.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+            callback(u, v, w);
+        });
+    }, path);
+}
+
+void BinaryEdgeListWriter::write(const GraphGenerator &generator, const std::string &path) {
+    write(generator.numberOfNodes(), [&](const EdgeCallback &callback) {
+        generator.forEdges(callback);
+    }, path);
+}
+
+void BinaryEdgeListWriter::write(
+        NetworKit::count n, const std::function<void(const EdgeCallback&)> &edges,
+        const std::string &path) {
+    std::ofstream graphFile(path, std::ios::binary);
+    Aux::enforceOpened(graphFile);
+    auto enforceWritten = [&]() {
+        if (!graphFile) {
+            throw std::runtime_error("Unable to write file: " + path);
+        }
+    };
+
+    BinaryEdgeListHeader header;
+    std::copy_n(BinaryEdgeListHeader::MAGIC, 8, header.magic);
+    header.nodes = n, header.edges = 0;
+    graphFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    enforceWritten();
+
+    const NetworKit::count BUFFER_SIZE = 1 << 16;
+    std::vector<BinaryEdge> buffer;
+    buffer.reserve(BUFFER_SIZE);
+    auto flush = [&]() {
+        graphFile.write(
+            reinterpret_cast<const char*>(buffer.data()), buffer.size() * sizeof(BinaryEdge));
+        enforceWritten();
+        header.edges += buffer.size();
+        buffer.clear();
+    };
+    edges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        buffer.push_back({u, v, w});
+        if (buffer.size() == BUFFER_SIZE) {
+            flush();
+        }
+    });
+    flush();
+    graphFile.seekp(0);
+    graphFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    graphFile.close();
+    enforceWritten();
+}
+
+}  /* namespace Koala */
@@ -5,16 +5,17 @@
  *      Author: Krzysztof Turowski (krzysztof.szymon.turowski@gmail.com)
  */
 
-#include <fstream>
+#include <string>
 
 #include <networkit/auxiliary/Enforce.hpp>
 
 #include <io/D6GraphReader.hpp>
+#include <io/DecompressingStream.hpp>
 
 namespace Koala {
 
 NetworKit::Graph D6GraphReader::read(const std::string &path) {
-    std::ifstream graphFile(path);
+    InputFileStream graphFile(path);
     Aux::enforceOpened(graphFile);
     std::string line;
     std::getline(graphFile, line);
@@ -0,0 +1,216 @@
+/*
+ * DecompressingStream.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <io/DecompressingStream.hpp>
+
+#include <array>
+#include <stdexcept>
+#include <utility>
+
+#include <zlib.h>
+#ifdef KOALA_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace Koala {
+
+Compression detectCompression(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    std::array<unsigned char, 4> magic = { 0, 0, 0, 0 };
+    file.read(reinterpret_cast<char*>(magic.data()), magic.size());
+    if (file.gcount() >= 2 && magic[0] == 0x1f && magic[1] == 0x8b) {
+        return Compression::GZIP;
+    }
+    if (file.gcount() == 4
+            && magic[0] == 0x28 && magic[1] == 0xb5 && magic[2] == 0x2f && magic[3] == 0xfd) {
+        return Compression::ZSTD;
+    }
+    return Compression::NONE;
+}
+
+DecompressingStreamBuf::DecompressingStreamBuf(
+        std::unique_ptr<std::ifstream> file, Compression compression, NetworKit::count block_size,
+        NetworKit::count blocks)
+    : file(std::move(file)), compression(compression), block_size(block_size), blocks(blocks) {
+    worker = std::jthread([this](std::stop_token token) { decompress(token); });
+}
+
+DecompressingStreamBuf::int_type DecompressingStreamBuf::underflow() {
+    if (gptr() < egptr()) {
+        return traits_type::to_int_type(*gptr());
+    }
+    std::unique_lock lock(mutex);
+    changed.wait(lock, [this] { return !queue.empty() || finished; });
+    if (queue.empty()) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return traits_type::eof();
+    }
+    current = std::move(queue.front());
+    queue.pop_front();
+    changed.notify_all();
+    setg(current.data(), current.data(), current.data() + current.size());
+    return traits_type::to_int_type(*gptr());
+}
+
+void DecompressingStreamBuf::decompress(std::stop_token token) {
+    try {
+        if (compression == Compression::GZIP) {
+            inflate_gzip(token);
+        } else {
+            inflate_zstd(token);
+        }
+    } catch (...) {
+        std::lock_guard lock(mutex);
+        error = std::current_exception();
+    }
+    std::lock_guard lock(mutex);
+    finished = true;
+    changed.notify_all();
+}
+
+bool DecompressingStreamBuf::push(std::string &block, const std::stop_token &token) {
+    std::unique_lock lock(mutex);
+    if (!changed.wait(lock, token, [this] { return queue.size() < blocks; })) {
+        return false;
+    }
+    queue.push_back(std::move(block));
+    changed.notify_all();
+    block.assign(block_size, 0);
+    return true;
+}
+
+void DecompressingStreamBuf::inflate_gzip(const std::stop_token &token) {
+    z_stream stream{};
+    // 32 added to the window size enables the detection of the gzip header
+    if (inflateInit2(&stream, MAX_WBITS + 32) != Z_OK) {
+        throw std::runtime_error("Cannot initialize gzip decompression");
+    }
+    std::unique_ptr<z_stream, decltype(&inflateEnd)> guard(&stream, inflateEnd);
+    std::string input(block_size, 0), output(block_size, 0);
+    stream.next_out = reinterpret_cast<Bytef*>(output.data());
+    stream.avail_out = static_cast<uInt>(block_size);
+    // whether the input consumed so far ends with a complete member, so that the file may end here
+    bool member_ended = false, pending = false;
+    while (!token.stop_requested()) {
+        if (stream.avail_in == 0 && !pending) {
+            file->read(input.data(), static_cast<std::streamsize>(block_size));
+            if (file->gcount() == 0) {
+                break;
+            }
+            stream.next_in = reinterpret_cast<Bytef*>(input.data());
+            stream.avail_in = static_cast<uInt>(file->gcount());
+        }
+        auto available = stream.avail_in;
+        int result = inflate(&stream, Z_NO_FLUSH);
+        if (result == Z_STREAM_END) {
+            // the file may consist of several concatenated gzip members
+            inflateReset(&stream);
+            member_ended = true;
+        } else if (result != Z_OK && result != Z_BUF_ERROR) {
+            throw std::runtime_error("Corrupted gzip data");
+        } else if (stream.avail_in != available) {
+            member_ended = false;
+        }
+        pending = stream.avail_out == 0;
+        if (pending) {
+            if (!push(output, token)) {
+                return;
+            }
+            stream.next_out = reinterpret_cast<Bytef*>(output.data());
+            stream.avail_out = static_cast<uInt>(block_size);
+        }
+    }
+    if (token.stop_requested()) {
+        return;
+    }
+    if (!member_ended) {
+        throw std::runtime_error("Truncated gzip data");
+    }
+    output.resize(block_size - stream.avail_out);
+    if (!output.empty()) {
+        push(output, token);
+    }
+}
+
+void DecompressingStreamBuf::inflate_zstd([[maybe_unused]] const std::stop_token &token) {
+#ifdef KOALA_HAVE_ZSTD
+    std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> context(
+        ZSTD_createDCtx(), ZSTD_freeDCtx);
+    if (!context) {
+        throw std::runtime_error("Cannot initialize zstd decompression");
+    }
+    std::string input(block_size, 0), output(block_size, 0);
+    ZSTD_inBuffer in{input.data(), 0, 0};
+    ZSTD_outBuffer out{output.data(), block_size, 0};
+    // whether the input consumed so far ends with a complete frame, so that the file may end here
+    bool frame_ended = false, pending = false;
+    while (!token.stop_requested()) {
+        if (in.pos == in.size && !pending) {
+            file->read(input.data(), static_cast<std::streamsize>(block_size));
+            if (file->gcount() == 0) {
+                break;
+            }
+            in = ZSTD_inBuffer{input.data(), static_cast<size_t>(file->gcount()), 0};
+        }
+        auto position = in.pos;
+        size_t result = ZSTD_decompressStream(context.get(), &out, &in);
+        if (ZSTD_isError(result)) {
+            throw std::runtime_error(ZSTD_getErrorName(result));
+        }
+        if (result == 0) {
+            frame_ended = true;
+        } else if (in.pos != position) {
+            frame_ended = false;
+        }
+        pending = out.pos == out.size;
+        if (pending) {
+            if (!push(output, token)) {
+                return;
+            }
+            out = ZSTD_outBuffer{output.data(), block_size, 0};
+        }
+    }
+    if (token.stop_requested()) {
+        return;
+    }
+    if (!frame_ended) {
+        throw std::runtime_error("Truncated zstd data");
+    }
+    output.resize(out.pos);
+    if (!output.empty()) {
+        push(output, token);
+    }
+#else
+    throw std::runtime_error("Reading zstd files requires building with zstd");
+#endif
+}
+
+InputFileStream::InputFileStream(const std::string &path, std::ios::openmode mode)
+    : std::istream(nullptr) {
+    auto compression = detectCompression(path);
+    if (compression == Compression::NONE) {
+        auto file = std::make_unique<std::filebuf>();
+        opened = file->open(path, mode | std::ios::in) != nullptr;
+        buffer = std::move(file);
+    } else {
+        auto file = std::make_unique<std::ifstream>(path, std::ios::binary);
+        opened = file->is_open();
+        buffer = std::make_unique<DecompressingStreamBuf>(std::move(file), compression);
+    }
+    rdbuf(buffer.get());
+    if (compression != Compression::NONE) {
+        // the decompression errors are rethrown to the reader instead of silently ending the input
+        exceptions(std::ios::badbit);
+    }
+}
+
+bool InputFileStream::is_open() const {
+    return opened;
+}
+
+}  /* namespace Koala */
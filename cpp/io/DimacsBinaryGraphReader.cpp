@@ -5,17 +5,18 @@
  *      Author: Krzysztof Turowski (krzysztof.szymon.turowski@gmail.com)
  */
 
-#include <fstream>
+#include <istream>
 #include <sstream>
 
 #include <networkit/auxiliary/Enforce.hpp>
 
+#include <io/DecompressingStream.hpp>
 #include <io/DimacsBinaryGraphReader.hpp>
 
 namespace Koala {
 
 NetworKit::Graph DimacsBinaryGraphReader::read(const std::string &path) {
-    std::ifstream graphFile(path, std::ios::binary);
+    InputFileStream graphFile(path, std::ios::binary);
     Aux::enforceOpened(graphFile);
 
     int preamble_size = 0;
@@ -5,13 +5,14 @@
  *      Author: Krzysztof Turowski (krzysztof.szymon.turowski@gmail.com)
  */
 
-#include <fstream>
+#include <istream>
 #include <map>
 #include <tuple>
 
 #include <networkit/auxiliary/Enforce.hpp>
 #include <networkit/graph/GraphTools.hpp>
 
+#include <io/DecompressingStream.hpp>
 #include <io/DimacsGraphReader.hpp>
 
 namespace Koala {
@@ -45,7 +46,7 @@ NetworKit::Graph create_graph(const std::string &format) {
     return graph;
 }
 
-void read_edge(std::ifstream &graphFile, NetworKit::Graph &graph, const std::string &format) {
+void read_edge(std::istream &graphFile, NetworKit::Graph &graph, const std::string &format) {
     NetworKit::node u = 0, v = 0;
     NetworKit::edgeweight w = 0;
     switch (convert[format]) {
@@ -70,7 +71,7 @@ NetworKit::Graph DimacsGraphReader::read(const std::string &path) {
 
 std::tuple<NetworKit::Graph, NetworKit::node, NetworKit::node> DimacsGraphReader::read_all(
         const std::string &path) {
-    std::ifstream graphFile(path);
+    InputFileStream graphFile(path);
     Aux::enforceOpened(graphFile);
 
     NetworKit::Graph graph;
@@ -24,4 +24,27 @@ void DimacsGraphWriter::write(const NetworKit::Graph &G, const std::string &path
     });
 }
 
+void DimacsGraphWriter::write(const GraphGenerator &generator, const std::string &path) {
+    std::ofstream graphFile(path);
+    Aux::enforceOpened(graphFile);
+
+    graphFile.precision(17);
+    auto flow_network = dynamic_cast<const FlowNetworkGenerator*>(&generator);
+    std::string format = flow_network ? "max" : (generator.isWeighted() ? "sp" : "edge");
+    graphFile << "p " << format << ' ' << generator.numberOfNodes() << ' '
+        << generator.numberOfEdges() << '\n';
+    if (flow_network) {
+        graphFile << "n " << flow_network->getSource() + 1 << " s\n";
+        graphFile << "n " << flow_network->getTarget() + 1 << " t\n";
+    }
+    std::string edge_type = generator.isDirected() || generator.isWeighted() ? "a" : "e";
+    generator.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        graphFile << edge_type << ' ' << u + 1 << ' ' << v + 1;
+        if (generator.isWeighted()) {
+            graphFile << ' ' << w;
+        }
+        graphFile << '\n';
+    });
+}
+
 } /* namespace Koala */
@@ -22,7 +22,11 @@ void G6GraphWriter::write(const NetworKit::Graph &G, const std::string &path) {
 
 std::string G6GraphWriter::writeline(const NetworKit::Graph &G) {
     std::string output;
+    writeline(G, output);
+    return output;
+}
 
+void G6GraphWriter::writeline(const NetworKit::Graph &G, std::string &output) {
     const char LOW = 0x3f, HIGH = 0x7e;
     const NetworKit::count SHORT_N = 1, MEDIUM_N = 3, LONG_N = 6, LENGTH = 6;
     const NetworKit::count SHORT_NODES = 63, LONG_NODES = 258048;
@@ -34,16 +38,15 @@ std::string G6GraphWriter::writeline(const NetworKit::Graph &G) {
         }
     }
 
-    NetworKit::count nodes = G.numberOfNodes();
-    std::string nodes_string(nodes_length, LOW);
+    NetworKit::count nodes = G.numberOfNodes(), nodes_start = output.size();
+    output.append(nodes_length, LOW);
     for (int i = nodes_length - 1; i >= 0; i--) {
-        nodes_string[i] += (nodes & LOW), nodes >>= LENGTH;
+        output[nodes_start + i] += (nodes & LOW), nodes >>= LENGTH;
     }
-    output += nodes_string;
 
     NetworKit::count start = output.size(), index = 0, shift = 0;
-    int length = (G.numberOfNodes() * (G.numberOfNodes() - 1) / 2) / LENGTH + 1;
-    output.append(length, 0x0);
+    NetworKit::count n = G.numberOfNodes(), bits = n > 0 ? n * (n - 1) / 2 : 0;
+    output.append((bits + LENGTH - 1) / LENGTH, 0x0);
     const char MASKS[] = { 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 };
     for (const NetworKit::node v : G.nodeRange()) {
         for (const NetworKit::node u : G.neighborRange(v)) {
@@ -57,7 +60,6 @@ std::string G6GraphWriter::writeline(const NetworKit::Graph &G) {
     for (unsigned i = start; i < output.size(); i++) {
         output[i] += LOW;
     }
-    return output;
 }
 
 } /* namespace Koala */
@@ -0,0 +1,123 @@
+/*
+ * GraphCorpusWriter.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <io/GraphCorpusWriter.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include <omp.h>
+
+#include <networkit/auxiliary/Enforce.hpp>
+
+#include <io/G6GraphWriter.hpp>
+#include <io/S6GraphWriter.hpp>
+
+namespace Koala {
+
+GraphCorpusWriter::GraphCorpusWriter(
+        const std::string &path, Format format, NetworKit::count buffer_size)
+    : file(std::make_unique<std::ofstream>(path, std::ios::binary)), out(*file), format(format),
+      buffer_size(buffer_size) {
+    Aux::enforceOpened(*file);
+    buffer.reserve(buffer_size);
+}
+
+GraphCorpusWriter::GraphCorpusWriter(
+        std::ostream &out, Format format, NetworKit::count buffer_size)
+    : out(out), format(format), buffer_size(buffer_size) {
+    buffer.reserve(buffer_size);
+}
+
+GraphCorpusWriter::~GraphCorpusWriter() {
+    flush();
+}
+
+void GraphCorpusWriter::write(const NetworKit::Graph &G) {
+    encode(G, previous, buffer);
+    graphs++;
+    if (buffer.size() >= buffer_size) {
+        flush();
+    }
+}
+
+void GraphCorpusWriter::write(const std::vector<NetworKit::Graph> &batch) {
+    const NetworKit::count chunks = 4 * static_cast<NetworKit::count>(omp_get_max_threads());
+    const NetworKit::count chunk_size = (batch.size() + chunks - 1) / chunks;
+    std::vector<std::string> buffers(chunks);
+    std::optional<Snapshot> tail;
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (int64_t chunk = 0; chunk < static_cast<int64_t>(chunks); chunk++) {
+        const auto first = static_cast<NetworKit::index>(chunk) * chunk_size;
+        const auto last = std::min(batch.size(), first + chunk_size);
+        if (first >= last) {
+            continue;
+        }
+        // every chunk but the first one starts from the snapshot of the graph preceding it
+        std::optional<Snapshot> before;
+        if (format == Format::INCREMENTAL_SPARSE6) {
+            if (first > 0) {
+                const auto &G = batch[first - 1];
+                before.emplace(Snapshot{G.numberOfNodes(), S6GraphWriter::sortedEdges(G)});
+            } else {
+                before = previous;
+            }
+        }
+        for (NetworKit::index i = first; i < last; i++) {
+            encode(batch[i], before, buffers[chunk]);
+        }
+        if (last == batch.size()) {
+            tail = std::move(before);
+        }
+    }
+    flush();
+    for (const auto &chunk : buffers) {
+        out.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    }
+    if (tail) {
+        previous = std::move(tail);
+    }
+    graphs += batch.size();
+}
+
+void GraphCorpusWriter::flush() {
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    out.flush();
+    buffer.clear();
+}
+
+NetworKit::count GraphCorpusWriter::numberOfGraphs() const {
+    return graphs;
+}
+
+void GraphCorpusWriter::encode(
+        const NetworKit::Graph &G, std::optional<Snapshot> &last, std::string &output) const {
+    if (format == Format::GRAPH6) {
+        G6GraphWriter().writeline(G, output);
+    } else if (format == Format::SPARSE6) {
+        S6GraphWriter().writeline(G, output);
+    } else {
+        auto edges = S6GraphWriter::sortedEdges(G);
+        if (last && last->nodes == G.numberOfNodes()) {
+            thread_local std::string full;
+            full.clear();
+            S6GraphWriter().writeline(G, full);
+            const auto start = output.size();
+            S6GraphWriter().writeline(G.numberOfNodes(), edges, last->edges, output);
+            if (output.size() - start > full.size()) {
+                output.resize(start);
+                output.append(full);
+            }
+        } else {
+            S6GraphWriter().writeline(G, output);
+        }
+        last.emplace(Snapshot{G.numberOfNodes(), std::move(edges)});
+    }
+    output.push_back('\n');
+}
+
+}  /* namespace Koala */
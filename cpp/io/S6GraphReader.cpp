@@ -5,10 +5,12 @@
  *      Author: Krzysztof Turowski (krzysztof.szymon.turowski@gmail.com)
  */
 
-#include <fstream>
+#include <cassert>
+#include <string>
 
 #include <networkit/auxiliary/Enforce.hpp>
 
+#include <io/DecompressingStream.hpp>
 #include <io/S6GraphReader.hpp>
 
 namespace Koala {
@@ -17,21 +19,13 @@ constexpr NetworKit::count log2(NetworKit::count n) {
     return n > 1 ? 1 + log2(n >> 1) : n;
 }
 
-NetworKit::Graph S6GraphReader::read(const std::string &path) {
-    std::ifstream graphFile(path);
-    Aux::enforceOpened(graphFile);
-    std::string line;
-    std::getline(graphFile, line);
-    return readline(line);
-}
+namespace {
 
-NetworKit::Graph S6GraphReader::readline(const std::string &line) {
-    auto it = line.cbegin();
-    assert(*it == ':');
-    ++it;
+const char LOW = 0x3f, HIGH = 0x7e;
+const int LENGTH = 6;
 
-    const char LOW = 0x3f, HIGH = 0x7e;
-    const int SHORT_N = 1, MEDIUM_N = 3, LONG_N = 6, LENGTH = 6;
+NetworKit::count read_nodes(std::string::const_iterator &it) {
+    const int SHORT_N = 1, MEDIUM_N = 3, LONG_N = 6;
     NetworKit::count nodes_length = SHORT_N;
     if (*it >= HIGH) {
         nodes_length = MEDIUM_N, ++it;
@@ -44,14 +38,20 @@ NetworKit::Graph S6GraphReader::readline(const std::string &line) {
     for (NetworKit::count i = 0; i < nodes_length; i++, ++it) {
         nodes = (nodes << LENGTH) | (*it - LOW);
     }
+    return nodes;
+}
 
-    NetworKit::Graph graph(nodes, false, false);
+// Call on_edge(u, v) for all the edges encoded in [it, end) of a sparse6 line with n nodes.
+template <typename OnEdge>
+void read_edges(
+        std::string::const_iterator it, std::string::const_iterator end, NetworKit::count nodes,
+        OnEdge on_edge) {
     const char MASKS[] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40 };
     NetworKit::count lognodes = log2(nodes - 1), length = 0, bits = 0;
     NetworKit::node u = 0, v = 0;
     while (true) {
         if (length == 0) {
-            if (it == line.cend()) {
+            if (it == end) {
                 break;
             }
             assert(*it >= LOW && *it <= HIGH);
@@ -62,13 +62,16 @@ NetworKit::Graph S6GraphReader::readline(const std::string &line) {
             v++, bits &= ~MASKS[length];
         }
         while (length < lognodes) {
-            if (it == line.cend()) {
+            if (it == end) {
                 break;
             }
             assert(*it >= LOW && *it <= HIGH);
             bits = (bits << LENGTH) | (*it - LOW);
             length += LENGTH, ++it;
         }
+        if (length < lognodes) {
+            break;
+        }
         length -= lognodes, u = bits >> length, bits ^= (u << length);
         if (u >= nodes) {
             break;
@@ -76,11 +79,54 @@ NetworKit::Graph S6GraphReader::readline(const std::string &line) {
         if (u > v) {
             v = u;
         } else {
-            graph.addEdge(u, v);
+            on_edge(u, v);
         }
     }
+}
+
+}  // namespace
+
+NetworKit::Graph S6GraphReader::read(const std::string &path) {
+    InputFileStream graphFile(path);
+    Aux::enforceOpened(graphFile);
+    std::string line;
+    std::getline(graphFile, line);
+    return readline(line);
+}
+
+NetworKit::Graph S6GraphReader::readline(const std::string &line) {
+    auto it = line.cbegin();
+    assert(*it == ':');
+    ++it;
+
+    NetworKit::count nodes = read_nodes(it);
+    NetworKit::Graph graph(nodes, false, false);
+    read_edges(it, line.cend(), nodes, [&](NetworKit::node u, NetworKit::node v) {
+        graph.addEdge(u, v);
+    });
     graph.shrinkToFit();
     return graph;
 }
 
+NetworKit::Graph S6GraphReader::readline(
+        const std::string &line, const NetworKit::Graph &previous) {
+    auto it = line.cbegin();
+    if (*it != ';') {
+        return readline(line);
+    }
+    ++it;
+
+    NetworKit::count nodes = read_nodes(it);
+    assert(nodes == previous.numberOfNodes());
+    NetworKit::Graph graph(previous);
+    read_edges(it, line.cend(), nodes, [&](NetworKit::node u, NetworKit::node v) {
+        if (graph.hasEdge(u, v)) {
+            graph.removeEdge(u, v);
+        } else {
+            graph.addEdge(u, v);
+        }
+    });
+    return graph;
+}
+
 } /* namespace Koala */
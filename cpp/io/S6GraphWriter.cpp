@@ -5,7 +5,10 @@
  *      Author: Krzysztof Turowski (krzysztof.szymon.turowski@gmail.com)
  */
 
+#include <algorithm>
+#include <cassert>
 #include <fstream>
+#include <vector>
 
 #include <networkit/auxiliary/Enforce.hpp>
 
@@ -17,70 +20,137 @@ constexpr NetworKit::count log2(NetworKit::count n) {
     return n > 1 ? 1 + log2(n >> 1) : n;
 }
 
-void S6GraphWriter::write(const NetworKit::Graph &G, const std::string &path) {
-    std::ofstream graphFile(path);
-    Aux::enforceOpened(graphFile);
-    std::string s6String = writeline(G);
-    graphFile << s6String << std::endl;
-}
+namespace {
 
-std::string S6GraphWriter::writeline(const NetworKit::Graph &G) {
-    std::string output = ":";
+const char LOW = 0x3f, HIGH = 0x7e;
+const NetworKit::count LENGTH = 6;
 
-    const char LOW = 0x3f, HIGH = 0x7e;
-    const NetworKit::count SHORT_N = 1, MEDIUM_N = 2, LONG_N = 6, LENGTH = 6;
+void write_nodes(NetworKit::count n, std::string &output) {
+    const NetworKit::count SHORT_N = 1, MEDIUM_N = 3, LONG_N = 6;
     const NetworKit::count SHORT_NODES = 63, LONG_NODES = 258048;
     NetworKit::count nodes_length = SHORT_N;
-    if (G.numberOfNodes() >= SHORT_NODES) {
+    if (n >= SHORT_NODES) {
         output.push_back(HIGH), nodes_length = MEDIUM_N;
-        if (G.numberOfNodes() >= LONG_NODES) {
+        if (n >= LONG_NODES) {
             output.push_back(HIGH), nodes_length = LONG_N;
         }
     }
 
-    NetworKit::count nodes = G.numberOfNodes();
-    std::string nodes_string(nodes_length, LOW);
+    NetworKit::count nodes = n, start = output.size();
+    output.append(nodes_length, LOW);
     for (int i = nodes_length - 1; i >= 0; i--) {
-        nodes_string[i] += (nodes & LOW), nodes >>= LENGTH;
+        output[start + i] += (nodes & LOW), nodes >>= LENGTH;
     }
-    output += nodes_string;
+}
 
-    NetworKit::count lognodes = log2(G.numberOfNodes() - 1) + 1, flag = 1 << (lognodes - 1);
+// Append the edges uv with u <= v, passed by for_edges in the non-decreasing order of v.
+template <typename ForEdges>
+void write_edges(NetworKit::count n, ForEdges for_edges, std::string &output) {
+    NetworKit::count lognodes = log2(n - 1) + 1, flag = 1 << (lognodes - 1);
     NetworKit::count bits = 0, length = 0;
     NetworKit::index v_previous = 0;
     const int MASKS[] = {
         0x0, 0x1, 0x3, 0x7, 0xf, 0x1f, 0x3f, 0x7f, 0xff, 0x1ff, 0x3ff, 0x7ff, 0xfff };
-    for (const NetworKit::node v : G.nodeRange()) {
-        for (const NetworKit::node u : G.neighborRange(v)) {
-            if (u > v) {
-                continue;
-            }
-            if (v == v_previous) {
-                bits = (bits << lognodes) | u, length += lognodes;
-            } else if (v == v_previous + 1) {
-                bits = (bits << lognodes) | flag | u, length += lognodes;
-            } else {
-                bits = (bits << lognodes) | flag | v, length += lognodes;
-                while (length >= LENGTH) {
-                    length -= LENGTH, output.push_back((bits >> length) + LOW);
-                    bits &= MASKS[length];
-                }
-                bits = (bits << lognodes) | u, length += lognodes;
-            }
-            v_previous = v;
+    for_edges([&](NetworKit::node u, NetworKit::node v) {
+        if (v == v_previous) {
+            bits = (bits << lognodes) | u, length += lognodes;
+        } else if (v == v_previous + 1) {
+            bits = (bits << lognodes) | flag | u, length += lognodes;
+        } else {
+            bits = (bits << lognodes) | flag | v, length += lognodes;
             while (length >= LENGTH) {
                 length -= LENGTH, output.push_back((bits >> length) + LOW);
                 bits &= MASKS[length];
             }
+            bits = (bits << lognodes) | u, length += lognodes;
         }
-    }
+        v_previous = v;
+        while (length >= LENGTH) {
+            length -= LENGTH, output.push_back((bits >> length) + LOW);
+            bits &= MASKS[length];
+        }
+    });
     if (length > 0) {
-        int special_case = static_cast<int>(
-            G.upperNodeIdBound() == flag && v_previous == G.upperNodeIdBound() - 2);
+        int special_case = static_cast<int>(n == flag && v_previous == n - 2);
         char padding = (bits << (LENGTH - length)) + MASKS[LENGTH - length - special_case];
         output.push_back(padding + LOW);
     }
+}
+
+}  // namespace
+
+void S6GraphWriter::write(const NetworKit::Graph &G, const std::string &path) {
+    std::ofstream graphFile(path);
+    Aux::enforceOpened(graphFile);
+    std::string s6String = writeline(G);
+    graphFile << s6String << std::endl;
+}
+
+std::string S6GraphWriter::writeline(const NetworKit::Graph &G) {
+    std::string output;
+    writeline(G, output);
+    return output;
+}
+
+void S6GraphWriter::writeline(const NetworKit::Graph &G, std::string &output) {
+    output.push_back(':');
+    write_nodes(G.numberOfNodes(), output);
+    write_edges(G.numberOfNodes(), [&](auto callback) {
+        for (const NetworKit::node v : G.nodeRange()) {
+            for (const NetworKit::node u : G.neighborRange(v)) {
+                if (u <= v) {
+                    callback(u, v);
+                }
+            }
+        }
+    }, output);
+}
+
+std::string S6GraphWriter::writeline(
+        const NetworKit::Graph &G, const NetworKit::Graph &previous) {
+    std::string output;
+    writeline(G, previous, output);
     return output;
 }
 
+void S6GraphWriter::writeline(
+        const NetworKit::Graph &G, const NetworKit::Graph &previous, std::string &output) {
+    assert(G.numberOfNodes() == previous.numberOfNodes());
+    writeline(G.numberOfNodes(), sortedEdges(G), sortedEdges(previous), output);
+}
+
+void S6GraphWriter::writeline(
+        NetworKit::count n, const Edges &edges, const Edges &previous, std::string &output) {
+    output.push_back(';');
+    write_nodes(n, output);
+    // the symmetric difference of the edge sets, merged in the sparse6 order
+    write_edges(n, [&](auto callback) {
+        auto a = edges.begin(), b = previous.begin();
+        while (a != edges.end() || b != previous.end()) {
+            if (b == previous.end() || (a != edges.end() && *a < *b)) {
+                callback(a->second, a->first), ++a;
+            } else if (a == edges.end() || *b < *a) {
+                callback(b->second, b->first), ++b;
+            } else {
+                ++a, ++b;
+            }
+        }
+    }, output);
+}
+
+S6GraphWriter::Edges S6GraphWriter::sortedEdges(const NetworKit::Graph &G) {
+    Edges edges;
+    edges.reserve(G.numberOfEdges());
+    for (const NetworKit::node v : G.nodeRange()) {
+        const auto start = edges.size();
+        G.forNeighborsOf(v, [&](NetworKit::node u) {
+            if (u <= v) {
+                edges.emplace_back(v, u);
+            }
+        });
+        std::sort(edges.begin() + start, edges.end());
+    }
+    return edges;
+}
+
 } /* namespace Koala */
@@ -0,0 +1,101 @@
+/*
+ * KruskalReconstructionTree.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <mst/KruskalReconstructionTree.hpp>
+
+#include <algorithm>
+#include <limits>
+
+#include <networkit/structures/UnionFind.hpp>
+
+namespace Koala {
+
+KruskalReconstructionTree::KruskalReconstructionTree(
+        NetworKit::count n, const std::vector<NetworKit::WeightedEdge> &edges) : n(n) {
+    assert(std::is_sorted(edges.begin(), edges.end(), [](const auto &e, const auto &f) {
+        return e.weight < f.weight;
+    }));
+    build(edges);
+}
+
+KruskalReconstructionTree::KruskalReconstructionTree(const NetworKit::Graph &forest)
+        : n(forest.upperNodeIdBound()) {
+    std::vector<NetworKit::WeightedEdge> edges(
+        forest.edgeWeightRange().begin(), forest.edgeWeightRange().end());
+    std::sort(edges.begin(), edges.end(), [](const auto &e, const auto &f) {
+        return e.weight < f.weight;
+    });
+    build(edges);
+}
+
+void KruskalReconstructionTree::build(const std::vector<NetworKit::WeightedEdge> &edges) {
+    // cluster[r] is the vertex of the tree corresponding to the component with representative r
+    NetworKit::UnionFind union_find(n);
+    std::vector<NetworKit::node> cluster(n);
+    std::vector<NetworKit::count> size(n, 1);
+    for (NetworKit::node v = 0; v < n; v++) {
+        cluster[v] = v;
+    }
+    merges.reserve(edges.size());
+    for (const auto &e : edges) {
+        auto u = union_find.find(e.u), v = union_find.find(e.v);
+        assert(u != v);
+        auto total = size[u] + size[v];
+        merges.push_back(Merge{cluster[u], cluster[v], e.weight, total});
+        union_find.merge(u, v);
+        auto r = union_find.find(u);
+        cluster[r] = n + merges.size() - 1, size[r] = total;
+    }
+
+    const NetworKit::node root = n + merges.size();
+    tree = RootedTree(root + 1);
+    for (NetworKit::index i = 0; i < merges.size(); i++) {
+        tree.setParent(merges[i].left, n + i, merges[i].height);
+        tree.setParent(merges[i].right, n + i, merges[i].height);
+    }
+    for (NetworKit::node v = 0; v < root; v++) {
+        if (!tree.getParent(v)) {
+            tree.setParent(v, root, std::numeric_limits<double>::infinity());
+        }
+    }
+    tree.setRoot(root);
+    lca = std::make_unique<OptimalLCA<RootedTree>>(tree);
+}
+
+const std::vector<KruskalReconstructionTree::Merge>&
+        KruskalReconstructionTree::getDendrogram() const {
+    return merges;
+}
+
+std::vector<NetworKit::index> KruskalReconstructionTree::getClusters(
+        NetworKit::edgeweight threshold) const {
+    // the parents have larger indices than their children, so a single sweep downwards suffices
+    std::vector<NetworKit::index> label(n + merges.size(), NetworKit::none);
+    NetworKit::count count = 0;
+    for (NetworKit::index v = n + merges.size(); v-- > 0; ) {
+        if (v >= n && merges[v - n].height > threshold) {
+            continue;
+        }
+        auto p = *tree.getParent(v);
+        label[v] = p != tree.getRoot() && tree.getWeight(v) <= threshold ? label[p] : count++;
+    }
+    return std::vector<NetworKit::index>(label.begin(), label.begin() + n);
+}
+
+NetworKit::edgeweight KruskalReconstructionTree::getBottleneckDistance(
+        NetworKit::node u, NetworKit::node v) const {
+    if (u == v) {
+        return 0;
+    }
+    auto w = lca->query(u, v);
+    return w != tree.getRoot() ? merges[w - n].height : std::numeric_limits<double>::infinity();
+}
+
+const RootedTree& KruskalReconstructionTree::getTree() const {
+    return tree;
+}
+
+}  /* namespace Koala */
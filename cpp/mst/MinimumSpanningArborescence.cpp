@@ -0,0 +1,292 @@
+/*
+ * MinimumSpanningArborescence.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <mst/MinimumSpanningArborescence.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <networkit/graph/GraphTools.hpp>
+
+#include <structures/Heap.hpp>
+
+namespace Koala {
+
+namespace {
+
+/**
+ * Union-find structure with union by size and without path compression, so that the unions can be
+ * undone in the reverse order when the contracted cycles are expanded.
+ */
+class RollbackUnionFind {
+ public:
+    explicit RollbackUnionFind(NetworKit::count n) : parent(n), size(n, 1) {
+        for (NetworKit::index i = 0; i < n; i++) {
+            parent[i] = i;
+        }
+    }
+
+    NetworKit::index find(NetworKit::index u) const {
+        while (parent[u] != u) {
+            u = parent[u];
+        }
+        return u;
+    }
+
+    bool join(NetworKit::index u, NetworKit::index v) {
+        u = find(u), v = find(v);
+        if (u == v) {
+            return false;
+        }
+        if (size[u] < size[v]) {
+            std::swap(u, v);
+        }
+        parent[v] = u, size[u] += size[v], history.push_back(v);
+        return true;
+    }
+
+    NetworKit::count time() const {
+        return history.size();
+    }
+
+    void rollback(NetworKit::count t) {
+        while (history.size() > t) {
+            auto v = history.back();
+            size[parent[v]] -= size[v], parent[v] = v, history.pop_back();
+        }
+    }
+
+ private:
+    std::vector<NetworKit::index> parent;
+    std::vector<NetworKit::count> size;
+    std::vector<NetworKit::index> history;
+};
+
+std::vector<bool> reachable_from(const NetworKit::Graph &graph, NetworKit::node root) {
+    std::vector<bool> reachable(graph.upperNodeIdBound(), false);
+    std::vector<NetworKit::node> stack{root};
+    reachable[root] = true;
+    while (!stack.empty()) {
+        auto u = stack.back();
+        stack.pop_back();
+        graph.forNeighborsOf(u, [&](NetworKit::node v) {
+            if (!reachable[v]) {
+                reachable[v] = true, stack.push_back(v);
+            }
+        });
+    }
+    return reachable;
+}
+
+}  // namespace
+
+MinimumSpanningArborescence::MinimumSpanningArborescence(
+        const NetworKit::Graph &graph, NetworKit::node root)
+    : MinimumSpanningArborescence(std::make_shared<const NetworKit::Graph>(graph), root) { }
+
+MinimumSpanningArborescence::MinimumSpanningArborescence(
+        std::shared_ptr<const NetworKit::Graph> graph, NetworKit::node root)
+        : graph(std::move(graph)), root(root), weight(0) {
+    if (!this->graph->isDirected()) {
+        throw std::invalid_argument("The minimum spanning arborescence requires a directed graph");
+    }
+    if (!this->graph->hasNode(root)) {
+        throw std::invalid_argument("The root is not a vertex of the graph");
+    }
+}
+
+const NetworKit::Graph& MinimumSpanningArborescence::getArborescence() const {
+    assureFinished();
+    return *arborescence;
+}
+
+NetworKit::edgeweight MinimumSpanningArborescence::getWeight() const {
+    assureFinished();
+    return weight;
+}
+
+void MinimumSpanningArborescence::run() {
+    KOALA_PROFILE_RUN();
+    hasRun = true;
+    optimal = true;
+    using Key = std::pair<NetworKit::edgeweight, NetworKit::index>;
+    const NetworKit::count n = graph->upperNodeIdBound();
+    auto reachable = reachable_from(*graph, root);
+
+    std::vector<NetworKit::node> tail, head;
+    std::vector<NetworKit::edgeweight> weights;
+    std::vector<PairingHeap<Key, std::greater<Key>>> heaps(n);
+    graph->forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        if (u != v && v != root && reachable[u]) {
+            heaps[v].push({w, tail.size()});
+            tail.push_back(u), head.push_back(v), weights.push_back(w);
+        }
+    });
+
+    // the keys of the heap of a contracted vertex u are off by offset[u] from the reduced weights
+    std::vector<NetworKit::edgeweight> offset(n, 0);
+    RollbackUnionFind union_find(n);
+    std::vector<NetworKit::index> seen(n, NetworKit::none), path(n), in(n, NetworKit::none);
+    std::vector<NetworKit::index> chosen(n);
+    std::vector<std::tuple<NetworKit::node, NetworKit::count, std::vector<NetworKit::index>>>
+        cycles;
+    seen[root] = root;
+    {
+        KOALA_PROFILE_REGION("contraction");
+        graph->forNodes([&](NetworKit::node s) {
+            if (!reachable[s]) {
+                return;
+            }
+            NetworKit::node u = s;
+            NetworKit::count q = 0;
+            while (seen[u] == NetworKit::none) {
+                assert(!heaps[u].empty());
+                auto e = heaps[u].top().second;
+                auto w = heaps[u].top().first + offset[u];
+                offset[u] -= w, heaps[u].pop();
+                chosen[q] = e, path[q++] = u, seen[u] = s;
+                u = union_find.find(tail[e]);
+                if (seen[u] != s) {
+                    continue;
+                }
+                auto start = q, time = union_find.time();
+                do {
+                    --start;
+                } while (path[start] != u);
+                // merging copies all the slots, so the heaps are merged into the largest allocated
+                auto target = u;
+                for (auto i = start; i < q; i++) {
+                    if (heaps[path[i]].capacity() > heaps[target].capacity()) {
+                        target = path[i];
+                    }
+                }
+                for (auto i = start; i < q; i++) {
+                    auto v = path[i];
+                    if (v != target) {
+                        auto shift = offset[v] - offset[target];
+                        heaps[target].merge(heaps[v], [shift](const Key &key) {
+                            return Key(key.first + shift, key.second);
+                        });
+                    }
+                    union_find.join(u, v);
+                }
+                u = union_find.find(u);
+                std::swap(heaps[u], heaps[target]), offset[u] = offset[target];
+                seen[u] = NetworKit::none;
+                cycles.emplace_back(u, time, std::vector<NetworKit::index>(
+                    chosen.begin() + start, chosen.begin() + q));
+                q = start;
+            }
+            for (NetworKit::index i = 0; i < q; i++) {
+                in[union_find.find(head[chosen[i]])] = chosen[i];
+            }
+        });
+    }
+
+    KOALA_PROFILE_REGION("expansion");
+    for (auto it = cycles.rbegin(); it != cycles.rend(); ++it) {
+        const auto &[u, time, cycle] = *it;
+        union_find.rollback(time);
+        auto e = in[u];
+        for (auto f : cycle) {
+            in[union_find.find(head[f])] = f;
+        }
+        in[union_find.find(head[e])] = e;
+    }
+    arborescence = std::make_optional(NetworKit::GraphTools::copyNodes(*graph));
+    weight = 0;
+    graph->forNodes([&](NetworKit::node v) {
+        if (v != root && reachable[v]) {
+            arborescence->addEdge(tail[in[v]], v, weights[in[v]]);
+            weight += weights[in[v]];
+        }
+    });
+}
+
+void MinimumSpanningArborescence::check() const {
+    assureFinished();
+    KOALA_PROFILE_ATTACH();
+    KOALA_PROFILE_REGION("verification");
+    auto reachable = reachable_from(*graph, root);
+    auto spanned = reachable_from(*arborescence, root);
+    NetworKit::edgeweight total = 0;
+    arborescence->forNodes([&](NetworKit::node v) {
+        assert(spanned[v] == reachable[v]);
+        assert(arborescence->degreeIn(v) == (v != root && reachable[v] ? 1 : 0));
+    });
+    arborescence->forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        assert(graph->hasEdge(u, v));
+        total += w;
+    });
+    assert(std::abs(total - weight) <= 1e-9 * std::max(1.0, std::abs(total)));
+
+    // Chu-Liu-Edmonds: pick the lightest incoming edges, contract their cycles and reduce weights
+    std::vector<NetworKit::index> id(graph->upperNodeIdBound(), NetworKit::none);
+    NetworKit::count n = 0;
+    graph->forNodes([&](NetworKit::node v) {
+        if (reachable[v]) {
+            id[v] = n++;
+        }
+    });
+    std::vector<std::tuple<NetworKit::index, NetworKit::index, NetworKit::edgeweight>> E;
+    graph->forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        if (reachable[u] && u != v) {
+            E.emplace_back(id[u], id[v], w);
+        }
+    });
+    NetworKit::index r = id[root];
+    NetworKit::edgeweight expected = 0;
+    while (true) {
+        std::vector<NetworKit::edgeweight> minimum(n, std::numeric_limits<double>::infinity());
+        std::vector<NetworKit::index> previous(n, NetworKit::none);
+        for (const auto &[u, v, w] : E) {
+            if (v != r && w < minimum[v]) {
+                minimum[v] = w, previous[v] = u;
+            }
+        }
+        minimum[r] = 0;
+        std::vector<NetworKit::index> label(n, NetworKit::none), visited(n, NetworKit::none);
+        NetworKit::count count = 0;
+        for (NetworKit::index v = 0; v < n; v++) {
+            assert(v == r || previous[v] != NetworKit::none);
+            expected += minimum[v];
+            auto x = v;
+            while (visited[x] != v && label[x] == NetworKit::none && x != r) {
+                visited[x] = v, x = previous[x];
+            }
+            if (x != r && label[x] == NetworKit::none) {
+                for (auto y = previous[x]; y != x; y = previous[y]) {
+                    label[y] = count;
+                }
+                label[x] = count++;
+            }
+        }
+        if (count == 0) {
+            break;
+        }
+        for (NetworKit::index v = 0; v < n; v++) {
+            if (label[v] == NetworKit::none) {
+                label[v] = count++;
+            }
+        }
+        std::vector<std::tuple<NetworKit::index, NetworKit::index, NetworKit::edgeweight>> F;
+        for (const auto &[u, v, w] : E) {
+            if (label[u] != label[v]) {
+                F.emplace_back(label[u], label[v], w - minimum[v]);
+            }
+        }
+        E.swap(F), n = count, r = label[r];
+    }
+    assert(std::abs(expected - weight) <= 1e-9 * std::max(1.0, std::abs(expected)));
+}
+
+}  /* namespace Koala */
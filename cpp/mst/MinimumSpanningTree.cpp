@@ -7,8 +7,9 @@
 
 #include <mst/MinimumSpanningTree.hpp>
 
-#include <random>
+#include <numeric>
 #include <ranges>
+#include <tuple>
 
 #include <networkit/auxiliary/Parallel.hpp>
 #include <networkit/components/ConnectedComponents.hpp>
@@ -16,50 +17,50 @@
 
 #include <structures/Heap.hpp>
 #include <structures/LCA.hpp>
-
-std::random_device device;
-std::default_random_engine generator{device()};
-std::uniform_int_distribution<int> distribution(0, 1);
+#include <structures/RadixSort.hpp>
+#include <structures/Random.hpp>
 
 class BranchingTree {
  private:
-    NetworKit::Graph B;
-    std::unordered_map<NetworKit::node, NetworKit::node> V_B;
-    std::unordered_map<NetworKit::node, NetworKit::edgeweight> B_edges;
+    Koala::RootedTree B;
+    std::vector<NetworKit::node> V_B;
+    std::vector<std::pair<NetworKit::node, NetworKit::edgeweight>> B_edges;
 
  public:
     void initialize(const NetworKit::Graph &G) {
-        B = NetworKit::Graph(G.upperNodeIdBound(), true, true);
+        B = Koala::RootedTree(G.upperNodeIdBound());
+        V_B.resize(G.upperNodeIdBound());
         for (const auto &v : G.nodeRange()) {
             V_B[v] = v;
         }
     }
 
     inline void addEdge(NetworKit::node v, NetworKit::edgeweight w) {
-        B_edges[v] = w;
+        B_edges.emplace_back(v, w);
     }
 
     void update(const NetworKit::Graph &G, const NetworKit::UnionFind &union_find) {
-        std::unordered_map<NetworKit::node, NetworKit::node> V_B_next;
+        std::vector<NetworKit::node> V_B_next(V_B.size(), NetworKit::none);
         for (const auto &v : G.nodeRange()) {
             V_B_next[v] = B.addNode();
         }
         for (const auto &[v, w] : B_edges) {
-            B.addEdge(V_B_next[union_find.find(v)], V_B[v], w);
+            B.setParent(V_B[v], V_B_next[union_find.find(v)], w);
         }
         std::swap(V_B, V_B_next);
         B_edges.clear();
     }
 
-    NetworKit::Graph getTree() {
-        return B;
+    Koala::RootedTree getTree() {
+        B.setRoot(B.upperNodeIdBound() - 1);
+        return std::move(B);
     }
 };
 
 class AugmentedGraph {
     using h_set = uint64_t;  // bitset of depths. i-th bit corresponds to i-th depth.
 
-    NetworKit::Graph graph;
+    const Koala::RootedTree &tree;
 
     NetworKit::count n, height;
     // median: h_set -> element of h_set. Example: 0b1011 denotes {0,1,3} so median[0b1011] = 1
@@ -74,28 +75,18 @@ class AugmentedGraph {
     std::vector<NetworKit::index> L, Lnext;
 
  public:
-    explicit AugmentedGraph(NetworKit::Graph &G) : graph(G), n(G.numberOfNodes()) { }
-
-    std::optional<NetworKit::node> getParent(NetworKit::node v) {
-        if (graph.inNeighborRange(v).begin() == graph.inNeighborRange(v).end()) {
-            return std::nullopt;
-        }
-        return *(graph.inNeighborRange(v).begin());
-    }
+    explicit AugmentedGraph(const Koala::RootedTree &tree)
+        : tree(tree), n(tree.numberOfNodes()) { }
 
     NetworKit::node getRoot() {
-        return graph.upperNodeIdBound() - 1;
-    }
-
-    NetworKit::Graph& getTree() {
-        return graph;
+        return tree.getRoot();
     }
 
     NetworKit::edgeweight getWeight(NetworKit::node u) {
         if (u == getRoot()) {
             return 0;
         }
-        auto w = getTree().weight(getParent(u).value(), u);
+        auto w = tree.getWeight(u);
         assert(w > 0);
         return w;
     }
@@ -130,7 +121,7 @@ class AugmentedGraph {
         for (auto i = L[u]; i != NetworKit::none; i = Lnext[i]) {
             D[u] |= 1 << depth[upper[i]];  // this is executed only for leaves of `fbt`.
         }
-        getTree().forNeighborsOf(u, [&](NetworKit::node child) {
+        tree.forChildrenOf(u, [&](NetworKit::node child) {
             initialize(child, u_depth + 1, upper);
             // exclude `u`. no-op for leaves and works recursively up to the root.
             D[u] |= (D[child] & ~(1 << u_depth));
@@ -204,7 +195,7 @@ class AugmentedGraph {
         for (auto i = L[v]; i != NetworKit::none; i = Lnext[i]) {
             answer[i] = P[median[down(1 << depth[upper[i]], S)]];
         }
-        getTree().forNeighborsOf(v, [&](NetworKit::node child) {
+        tree.forChildrenOf(v, [&](NetworKit::node child) {
             visit(child, S, upper, answer);
         });
     }
@@ -232,9 +223,12 @@ class AugmentedGraph {
 
 namespace Koala {
 
-MinimumSpanningTree::MinimumSpanningTree(
-        NetworKit::Graph &graph) : graph(std::make_optional(graph)) {
-    tree = std::make_optional(NetworKit::GraphTools::copyNodes(graph));
+MinimumSpanningTree::MinimumSpanningTree(NetworKit::Graph &graph)
+    : MinimumSpanningTree(std::make_shared<const NetworKit::Graph>(graph)) { }
+
+MinimumSpanningTree::MinimumSpanningTree(std::shared_ptr<const NetworKit::Graph> graph)
+        : graph(std::move(graph)) {
+    tree = std::make_optional(NetworKit::GraphTools::copyNodes(*this->graph));
 }
 
 const NetworKit::Graph& MinimumSpanningTree::getForest() const {
@@ -242,22 +236,83 @@ const NetworKit::Graph& MinimumSpanningTree::getForest() const {
     return *tree;
 }
 
+KruskalReconstructionTree MinimumSpanningTree::getReconstructionTree() const {
+    assureFinished();
+    if (merges.size() == tree->numberOfEdges()) {
+        return KruskalReconstructionTree(tree->upperNodeIdBound(), merges);
+    }
+    return KruskalReconstructionTree(*tree);
+}
+
+KruskalMinimumSpanningTree::KruskalMinimumSpanningTree(NetworKit::Graph &graph, Sorting sorting)
+    : MinimumSpanningTree(graph), sorting(sorting) { }
+
+KruskalMinimumSpanningTree::KruskalMinimumSpanningTree(
+    std::shared_ptr<const NetworKit::Graph> graph, Sorting sorting)
+    : MinimumSpanningTree(std::move(graph)), sorting(sorting) { }
+
 void KruskalMinimumSpanningTree::run() {
+    KOALA_PROFILE_RUN();
     hasRun = true;
+    optimal = true;
+    if (sorting == Sorting::RADIX) {
+        run_radix();
+    } else {
+        run_comparison();
+    }
+}
+
+void KruskalMinimumSpanningTree::run_comparison() {
     std::vector<NetworKit::WeightedEdge> sorted_edges(
         graph->edgeWeightRange().begin(), graph->edgeWeightRange().end());
-    Aux::Parallel::sort(sorted_edges.begin(), sorted_edges.end());
+    {
+        KOALA_PROFILE_REGION("sorting");
+        Aux::Parallel::sort(sorted_edges.begin(), sorted_edges.end());
+    }
+    KOALA_PROFILE_REGION("union-find");
     NetworKit::UnionFind union_find(graph->upperNodeIdBound());
     for (const auto &e : sorted_edges) {
         if (union_find.find(e.u) != union_find.find(e.v)) {
-            tree->addEdge(e.u, e.v, e.weight);
+            tree->addEdge(e.u, e.v, e.weight), merges.push_back(e);
             union_find.merge(e.u, e.v);
         }
     }
 }
 
+void KruskalMinimumSpanningTree::run_radix() {
+    NetworKit::count m = graph->numberOfEdges();
+    std::vector<NetworKit::node> tail(m), head(m);
+    std::vector<NetworKit::edgeweight> weight(m);
+    std::vector<std::pair<uint64_t, NetworKit::index>> keys(m);
+    {
+        KOALA_PROFILE_REGION("sorting");
+        NetworKit::index i = 0;
+        graph->forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+            tail[i] = u, head[i] = v, weight[i] = w, i++;
+        });
+        #pragma omp parallel for
+        for (int64_t i = 0; i < static_cast<int64_t>(m); i++) {
+            keys[i] = std::make_pair(order_preserving_key(weight[i]), i);
+        }
+        radix_sort(keys);
+    }
+    KOALA_PROFILE_REGION("union-find");
+    NetworKit::UnionFind union_find(graph->upperNodeIdBound());
+    NetworKit::count remaining = graph->numberOfNodes() - 1;
+    for (NetworKit::index i = 0; i < m && remaining > 0; i++) {
+        auto e = keys[i].second;
+        if (union_find.find(tail[e]) != union_find.find(head[e])) {
+            tree->addEdge(tail[e], head[e], weight[e]);
+            merges.emplace_back(tail[e], head[e], weight[e]);
+            union_find.merge(tail[e], head[e]);
+            remaining--;
+        }
+    }
+}
+
 void PrimMinimumSpanningTree::run() {
     hasRun = true;
+    optimal = true;
     Heap<std::pair<NetworKit::edgeweight, NetworKit::node>> queue;
     queue.push(std::make_pair(0, *(graph->nodeRange().begin())));
     std::unordered_map<NetworKit::node, NetworKit::WeightedEdge> previous;
@@ -282,8 +337,141 @@ void PrimMinimumSpanningTree::run() {
     }
 }
 
+void FredmanTarjanMinimumSpanningTree::run() {
+    KOALA_PROFILE_RUN();
+    hasRun = true;
+    optimal = true;
+    std::vector<NetworKit::WeightedEdge> edges;
+    edges.reserve(graph->numberOfEdges());
+    graph->forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        if (u != v) {
+            edges.emplace_back(u, v, w);
+        }
+    });
+
+    // the contracted multigraph in CSR format, every arc refers to its original edge
+    std::vector<NetworKit::index> first(graph->upperNodeIdBound() + 1, 0), arc_edge;
+    std::vector<NetworKit::node> arc_head;
+    for (const auto &e : edges) {
+        first[e.u + 1]++, first[e.v + 1]++;
+    }
+    std::inclusive_scan(first.begin(), first.end(), first.begin());
+    arc_edge.resize(2 * edges.size()), arc_head.resize(2 * edges.size());
+    {
+        std::vector<NetworKit::index> position(first.begin(), first.end() - 1);
+        for (NetworKit::index i = 0; i < edges.size(); i++) {
+            arc_edge[position[edges[i].u]] = i, arc_head[position[edges[i].u]++] = edges[i].v;
+            arc_edge[position[edges[i].v]] = i, arc_head[position[edges[i].v]++] = edges[i].u;
+        }
+    }
+
+    using Key = std::tuple<NetworKit::edgeweight, NetworKit::index, NetworKit::node>;
+    FibonacciHeap<Key, std::greater<Key>> heap;
+    std::vector<FibonacciHeap<Key, std::greater<Key>>::iterator> handle;
+    std::vector<NetworKit::index> owner, in_heap;
+    std::vector<Key> best;
+    while (!arc_head.empty()) {
+        KOALA_PROFILE_REGION("phase");
+        NetworKit::count n = first.size() - 1, density = arc_head.size() / n;
+        NetworKit::count k = density < 8 * sizeof(NetworKit::count) - 1 ? 1ULL << density : n;
+        owner.assign(n, NetworKit::none), in_heap.assign(n, NetworKit::none);
+        handle.resize(n), best.resize(n);
+        NetworKit::UnionFind union_find(n);
+        auto scan = [&](NetworKit::node r, NetworKit::node v) {
+            for (NetworKit::index a = first[v]; a < first[v + 1]; a++) {
+                NetworKit::node w = arc_head[a];
+                if (owner[w] == r) {
+                    continue;
+                }
+                Key key(edges[arc_edge[a]].weight, arc_edge[a], w);
+                if (in_heap[w] != r) {
+                    in_heap[w] = r, best[w] = key, handle[w] = heap.push(key);
+                } else if (key < best[w]) {
+                    best[w] = key, heap.update(handle[w], key);
+                }
+            }
+        };
+        for (NetworKit::node r = 0; r < n; r++) {
+            if (owner[r] != NetworKit::none || first[r] == first[r + 1]) {
+                continue;
+            }
+            heap.clear();
+            owner[r] = r, scan(r, r);
+            while (!heap.empty() && heap.size() <= k) {
+                auto [weight, e, v] = heap.top();
+                heap.pop();
+                tree->addEdge(edges[e].u, edges[e].v, weight);
+                union_find.merge(r, v);
+                if (owner[v] != NetworKit::none) {
+                    break;
+                }
+                owner[v] = r, scan(r, v);
+            }
+        }
+
+        // contract the trees, dropping the ones without outgoing edges, and keep only the lightest
+        // edge between every pair of them
+        std::vector<NetworKit::node> root(n), label(n, NetworKit::none);
+        std::vector<NetworKit::count> degree(n, 0);
+        for (NetworKit::node v = 0; v < n; v++) {
+            root[v] = union_find.find(v);
+        }
+        for (NetworKit::node v = 0; v < n; v++) {
+            for (NetworKit::index a = first[v]; a < first[v + 1]; a++) {
+                degree[root[v]] += root[v] != root[arc_head[a]];
+            }
+        }
+        NetworKit::count n_next = 0;
+        for (NetworKit::node v = 0; v < n; v++) {
+            if (degree[v] > 0) {
+                label[v] = n_next++;
+            }
+        }
+        std::vector<NetworKit::index> first_next(n_next + 1, 0);
+        for (NetworKit::node v = 0; v < n; v++) {
+            label[v] = label[root[v]];
+            if (v == root[v] && label[v] != NetworKit::none) {
+                first_next[label[v] + 1] = degree[v];
+            }
+        }
+        std::inclusive_scan(first_next.begin(), first_next.end(), first_next.begin());
+        std::vector<NetworKit::index> arc_order(first_next[n_next]);
+        {
+            std::vector<NetworKit::index> position(first_next.begin(), first_next.end() - 1);
+            for (NetworKit::node v = 0; v < n; v++) {
+                for (NetworKit::index a = first[v]; a < first[v + 1]; a++) {
+                    if (root[v] != root[arc_head[a]]) {
+                        arc_order[position[label[v]]++] = a;
+                    }
+                }
+            }
+        }
+        std::vector<NetworKit::index> slot(n_next, NetworKit::none), edge_next;
+        std::vector<NetworKit::node> head_next;
+        NetworKit::index begin = 0;
+        for (NetworKit::node c = 0; c < n_next; c++) {
+            for (NetworKit::index i = first_next[c]; i < first_next[c + 1]; i++) {
+                NetworKit::index a = arc_order[i];
+                NetworKit::node d = label[arc_head[a]];
+                if (slot[d] == NetworKit::none || slot[d] < begin) {
+                    slot[d] = head_next.size(), head_next.push_back(d);
+                    edge_next.push_back(arc_edge[a]);
+                } else if (std::make_pair(edges[arc_edge[a]].weight, arc_edge[a])
+                        < std::make_pair(edges[edge_next[slot[d]]].weight, edge_next[slot[d]])) {
+                    edge_next[slot[d]] = arc_edge[a];
+                }
+            }
+            first_next[c] = begin, begin = head_next.size();
+        }
+        first_next[n_next] = begin;
+        first.swap(first_next), arc_head.swap(head_next), arc_edge.swap(edge_next);
+    }
+}
+
 void BoruvkaMinimumSpanningTree::run() {
+    KOALA_PROFILE_RUN();
     hasRun = true;
+    optimal = true;
     NetworKit::UnionFind union_find(graph->upperNodeIdBound());
     NetworKit::Graph G(*graph);
     std::map<NodePair, NodePair> E;
@@ -293,7 +481,7 @@ void BoruvkaMinimumSpanningTree::run() {
     iterate(G, *tree, union_find, E, std::numeric_limits<NetworKit::count>::max(), false);
 }
 
-std::optional<NetworKit::Graph> BoruvkaMinimumSpanningTree::iterate(
+std::optional<Koala::RootedTree> BoruvkaMinimumSpanningTree::iterate(
         NetworKit::Graph &G, NetworKit::Graph &F,
         NetworKit::UnionFind &union_find, std::map<NodePair, NodePair> &E,
         NetworKit::count steps, bool get_branching_tree) {
@@ -303,6 +491,7 @@ std::optional<NetworKit::Graph> BoruvkaMinimumSpanningTree::iterate(
         B.initialize(G);
     }
     while (G.numberOfNodes() > 1 && G.numberOfEdges() > 0 && steps-- > 0) {
+        KOALA_PROFILE_REGION("contraction");
         std::unordered_map<NetworKit::node, NetworKit::edgeweight> B_edges;
         G.forNodes([&](NetworKit::node x) {
             const auto &[y, w] = *std::min_element(
@@ -363,16 +552,27 @@ std::optional<NetworKit::Graph> BoruvkaMinimumSpanningTree::iterate(
         }
         std::swap(G, G_prim);
     }
-    return get_branching_tree ? std::make_optional(std::move(B.getTree())) : std::nullopt;
+    return get_branching_tree ? std::make_optional(B.getTree()) : std::nullopt;
 }
 
+KargerKleinTarjanMinimumSpanningTree::KargerKleinTarjanMinimumSpanningTree(
+    NetworKit::Graph &graph, uint64_t seed) : BoruvkaMinimumSpanningTree(graph), seed(seed) { }
+
+KargerKleinTarjanMinimumSpanningTree::KargerKleinTarjanMinimumSpanningTree(
+    std::shared_ptr<const NetworKit::Graph> graph, uint64_t seed)
+    : BoruvkaMinimumSpanningTree(std::move(graph)), seed(seed) { }
+
 void KargerKleinTarjanMinimumSpanningTree::run() {
+    KOALA_PROFILE_RUN();
     hasRun = true;
+    optimal = true;
     NetworKit::Graph G(*graph);
-    recurse(G, *tree);
+    Philox generator(seed);
+    recurse(G, *tree, generator);
 }
 
-void KargerKleinTarjanMinimumSpanningTree::recurse(NetworKit::Graph &G, NetworKit::Graph &F) {
+void KargerKleinTarjanMinimumSpanningTree::recurse(
+        NetworKit::Graph &G, NetworKit::Graph &F, Philox &generator) {
     NetworKit::UnionFind union_find(G.upperNodeIdBound());
     std::map<NodePair, NodePair> E;
     G.forEdges([&](NetworKit::node u, NetworKit::node v) {
@@ -384,17 +584,18 @@ void KargerKleinTarjanMinimumSpanningTree::recurse(NetworKit::Graph &G, NetworKi
             return;
         }
         auto subgraph(NetworKit::GraphTools::copyNodes(G));
-        discard_random_edges(G, subgraph);
+        discard_random_edges(G, subgraph, generator);
         auto subforest(NetworKit::GraphTools::copyNodes(subgraph));
-        recurse(subgraph, subforest);
+        recurse(subgraph, subforest, generator);
         remove_heavy_edges(G, subforest);
     }
 }
 
 void KargerKleinTarjanMinimumSpanningTree::discard_random_edges(
-        NetworKit::Graph &G, NetworKit::Graph &subgraph) {
+        NetworKit::Graph &G, NetworKit::Graph &subgraph, Philox &generator) {
+    KOALA_PROFILE_REGION("random sampling");
     G.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
-        if (distribution(generator)) {
+        if (generator() & 1) {
             subgraph.addEdge(u, v, w);
         }
     });
@@ -409,15 +610,16 @@ void KargerKleinTarjanMinimumSpanningTree::discard_random_edges(
 
 void KargerKleinTarjanMinimumSpanningTree::remove_heavy_edges(
         NetworKit::Graph &G, NetworKit::Graph &subforest) {
+    KOALA_PROFILE_REGION("heavy edge removal");
     NetworKit::UnionFind union_find(G.upperNodeIdBound());
     std::map<NodePair, NodePair> E;
     subforest.forEdges([&](NetworKit::node u, NetworKit::node v) {
         E.insert({std::minmax(u, v), {u, v}});
     });
-    NetworKit::Graph branching_tree = *iterate(
+    auto branching_tree = *iterate(
         subforest, subforest, union_find, E, std::numeric_limits<NetworKit::count>::max(), true);
     auto branching_tree_augmented = AugmentedGraph(branching_tree);
-    Koala::LCA<AugmentedGraph> lca(branching_tree_augmented);
+    Koala::LCA<> lca(branching_tree);
     std::vector<NetworKit::node> upper, lower;
     std::vector<std::tuple<NetworKit::node, NetworKit::node, NetworKit::edgeweight>> edges;
     G.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
@@ -438,6 +640,8 @@ void KargerKleinTarjanMinimumSpanningTree::remove_heavy_edges(
 
 void MinimumSpanningTree::check() const {
     assureFinished();
+    KOALA_PROFILE_ATTACH();
+    KOALA_PROFILE_REGION("verification");
     assert(tree->numberOfNodes() == tree->numberOfEdges() + 1);
     auto connected_components = NetworKit::ConnectedComponents(*tree);
     connected_components.run();
@@ -450,7 +654,7 @@ void MinimumSpanningTree::check() const {
         E.insert({std::minmax(u, v), {u, v}});
     });
     // Note: Boruvka runs in linear time on trees
-    NetworKit::Graph branching_tree = *BoruvkaMinimumSpanningTree::iterate(
+    auto branching_tree = *BoruvkaMinimumSpanningTree::iterate(
         tree_copy, tree_copy, union_find, E, std::numeric_limits<NetworKit::count>::max(), true);
     std::vector<std::tuple<NetworKit::node, NetworKit::node, NetworKit::edgeweight>> G_minus_M;
     G_minus_M.reserve(graph->numberOfEdges() - tree->numberOfEdges());
@@ -460,7 +664,7 @@ void MinimumSpanningTree::check() const {
          }
     });
     auto branching_tree_augmented = AugmentedGraph(branching_tree);
-    auto lca = Koala::LCA(branching_tree_augmented);
+    auto lca = Koala::LCA<>(branching_tree);
     std::vector<NetworKit::node> lower, upper;
     lower.reserve(2 * G_minus_M.size()), upper.reserve(2 * G_minus_M.size());
     for (const auto &[u, v, w] : G_minus_M) {
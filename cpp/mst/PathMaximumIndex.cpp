@@ -0,0 +1,36 @@
+/*
+ * PathMaximumIndex.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <mst/PathMaximumIndex.hpp>
+
+namespace Koala {
+
+PathMaximumIndex::PathMaximumIndex(const NetworKit::Graph &forest) : tree(forest) { }
+
+NetworKit::edgeweight PathMaximumIndex::query(NetworKit::node u, NetworKit::node v) const {
+    return tree.getBottleneckDistance(u, v);
+}
+
+std::vector<NetworKit::edgeweight> PathMaximumIndex::query(
+        const std::vector<std::pair<NetworKit::node, NetworKit::node>> &queries) const {
+    std::vector<NetworKit::edgeweight> answers(queries.size());
+    #pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < static_cast<int64_t>(queries.size()); i++) {
+        answers[i] = query(queries[i].first, queries[i].second);
+    }
+    return answers;
+}
+
+bool PathMaximumIndex::isHeavier(
+        NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) const {
+    // a self-loop closes an empty cycle, so it never enters a spanning forest, whatever its weight
+    if (u == v) {
+        return true;
+    }
+    return w > query(u, v);
+}
+
+}  /* namespace Koala */
@@ -0,0 +1,121 @@
+/*
+ * SemiExternalMinimumSpanningTree.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <mst/SemiExternalMinimumSpanningTree.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <networkit/structures/UnionFind.hpp>
+
+#include <io/BinaryEdgeListWriter.hpp>
+#include <structures/RadixSort.hpp>
+
+namespace Koala {
+
+SemiExternalMinimumSpanningTree::SemiExternalMinimumSpanningTree(
+        const std::string &input, const std::string &output, NetworKit::count run_size)
+        : input(input), output(output), run_size(run_size), forest_size(0), forest_weight(0) {
+    if (run_size == 0) {
+        throw std::invalid_argument("The run size has to be positive");
+    }
+}
+
+NetworKit::count SemiExternalMinimumSpanningTree::getForestSize() const {
+    assureFinished();
+    return forest_size;
+}
+
+NetworKit::edgeweight SemiExternalMinimumSpanningTree::getForestWeight() const {
+    assureFinished();
+    return forest_weight;
+}
+
+void SemiExternalMinimumSpanningTree::run() {
+    KOALA_PROFILE_RUN();
+    MappedBinaryEdgeList edges(input);
+    NetworKit::count n = edges.numberOfNodes(), m = edges.numberOfEdges();
+    NetworKit::UnionFind union_find(n);
+    BinaryEdgeListWriter writer;
+    forest_size = 0, forest_weight = 0, interrupted = false;
+    auto accept = [&](const BinaryEdge &e, const BinaryEdgeListWriter::EdgeCallback &callback) {
+        if (union_find.find(e.u) != union_find.find(e.v)) {
+            union_find.merge(e.u, e.v);
+            callback(e.u, e.v, e.weight);
+            return true;
+        }
+        return false;
+    };
+
+    // a single run is reduced directly to the answer, otherwise the runs are merged
+    bool single = m <= run_size;
+    std::vector<std::string> runs;
+    for (NetworKit::index begin = 0; begin == 0 || begin < m; begin += run_size) {
+        if (isStopRequested()) {
+            break;
+        }
+        KOALA_PROFILE_REGION("runs");
+        NetworKit::index end = std::min(begin + run_size, m);
+        std::vector<std::pair<uint64_t, NetworKit::index>> keys(end - begin);
+        #pragma omp parallel for
+        for (int64_t i = begin; i < static_cast<int64_t>(end); i++) {
+            keys[i - begin] = std::make_pair(order_preserving_key(edges[i].weight), i);
+        }
+        radix_sort(keys);
+        runs.push_back(single ? output : output + ".run" + std::to_string(runs.size()));
+        union_find.allToSingletons();
+        writer.write(n, [&](const BinaryEdgeListWriter::EdgeCallback &callback) {
+            for (const auto &[key, i] : keys) {
+                if (accept(edges[i], callback) && single) {
+                    forest_size++, forest_weight += edges[i].weight;
+                }
+            }
+        }, runs.back());
+    }
+
+    // an interrupted run still writes the forest of the runs sorted so far, possibly empty
+    if (!single || interrupted) {
+        KOALA_PROFILE_REGION("merge");
+        std::vector<std::unique_ptr<MappedBinaryEdgeList>> sorted;
+        std::vector<NetworKit::index> position(runs.size(), 0);
+        using Entry = std::tuple<uint64_t, NetworKit::index>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+        for (const auto &path : runs) {
+            sorted.push_back(std::make_unique<MappedBinaryEdgeList>(path));
+            if (sorted.back()->numberOfEdges() > 0) {
+                queue.emplace(order_preserving_key((*sorted.back())[0].weight), sorted.size() - 1);
+            }
+        }
+        union_find.allToSingletons();
+        writer.write(n, [&](const BinaryEdgeListWriter::EdgeCallback &callback) {
+            // the ties are broken by the run index, consistently with the order within the runs
+            while (!queue.empty() && forest_size + 1 < n) {
+                auto [key, r] = queue.top();
+                queue.pop();
+                const auto &e = (*sorted[r])[position[r]++];
+                if (accept(e, callback)) {
+                    forest_size++, forest_weight += e.weight;
+                }
+                if (position[r] < sorted[r]->numberOfEdges()) {
+                    queue.emplace(order_preserving_key((*sorted[r])[position[r]].weight), r);
+                }
+            }
+        }, output);
+    }
+    for (NetworKit::index i = 0; !single && i < runs.size(); i++) {
+        std::remove(runs[i].c_str());
+    }
+    hasRun = true;
+    optimal = !interrupted;
+}
+
+}  /* namespace Koala */
@@ -0,0 +1,172 @@
+/*
+ * Profiler.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <profiling/Profiler.hpp>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Koala {
+
+namespace Profiling {
+
+namespace {
+
+thread_local Profile *current_profile = nullptr;
+
+// Hardware counters of the current thread, opened on the first use and kept open afterwards.
+class PerfCounters {
+ public:
+    PerfCounters() {
+        descriptors.fill(-1);
+#ifdef __linux__
+        const std::array<std::pair<uint32_t, uint64_t>, NUMBER_OF_COUNTERS> EVENTS = {{
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL
+                | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}
+        }};
+        available = true;
+        for (std::size_t i = 0; i < NUMBER_OF_COUNTERS; i++) {
+            struct perf_event_attr attributes{};
+            attributes.size = sizeof(attributes);
+            attributes.type = EVENTS[i].first;
+            attributes.config = EVENTS[i].second;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            descriptors[i] = static_cast<int>(
+                syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+            available = available && descriptors[i] >= 0;
+        }
+        if (!available) {
+            close_all();
+        }
+#endif
+    }
+
+    ~PerfCounters() {
+        close_all();
+    }
+
+    bool read(std::array<uint64_t, NUMBER_OF_COUNTERS> &values) const {
+        if (!available) {
+            return false;
+        }
+#ifdef __linux__
+        for (std::size_t i = 0; i < NUMBER_OF_COUNTERS; i++) {
+            if (::read(descriptors[i], &values[i], sizeof(uint64_t)) != sizeof(uint64_t)) {
+                return false;
+            }
+        }
+#endif
+        return true;
+    }
+
+ private:
+    void close_all() {
+#ifdef __linux__
+        for (auto &descriptor : descriptors) {
+            if (descriptor >= 0) {
+                close(descriptor);
+            }
+            descriptor = -1;
+        }
+#endif
+    }
+
+    std::array<int, NUMBER_OF_COUNTERS> descriptors;
+    bool available = false;
+};
+
+const PerfCounters& get_counters() {
+    thread_local PerfCounters counters;
+    return counters;
+}
+
+}  // namespace
+
+const std::map<std::string, RegionStatistics>& Profile::getRegions() const {
+    return regions;
+}
+
+void Profile::add(const std::string &name, const RegionStatistics &statistics) {
+    auto &total = regions[name];
+    total.has_counters = total.calls == 0 ? statistics.has_counters
+        : total.has_counters && statistics.has_counters;
+    total.calls += statistics.calls;
+    total.seconds += statistics.seconds;
+    for (std::size_t i = 0; i < NUMBER_OF_COUNTERS; i++) {
+        total.counters[i] += statistics.counters[i];
+    }
+}
+
+void Profile::clear() {
+    regions.clear();
+}
+
+bool Profile::empty() const {
+    return regions.empty();
+}
+
+std::ostream& operator<<(std::ostream &out, const Profile &profile) {
+    for (const auto &[name, statistics] : profile.getRegions()) {
+        out << name << ": calls=" << statistics.calls << " seconds=" << statistics.seconds;
+        if (statistics.has_counters) {
+            out << " cycles=" << statistics.get(Counter::CYCLES)
+                << " instructions=" << statistics.get(Counter::INSTRUCTIONS)
+                << " llc_misses=" << statistics.get(Counter::LLC_MISSES)
+                << " branch_misses=" << statistics.get(Counter::BRANCH_MISSES);
+        }
+        out << '\n';
+    }
+    return out;
+}
+
+ProfileScope::ProfileScope(Profile &profile, bool reset) : previous(current_profile) {
+    if (reset) {
+        profile.clear();
+    }
+    current_profile = &profile;
+}
+
+ProfileScope::~ProfileScope() {
+    current_profile = previous;
+}
+
+ScopedRegion::ScopedRegion(const char *name)
+        : name(name), profile(current_profile), has_counters(false), counters{} {
+    if (profile) {
+        has_counters = get_counters().read(counters);
+        start = std::chrono::steady_clock::now();
+    }
+}
+
+ScopedRegion::~ScopedRegion() {
+    if (!profile) {
+        return;
+    }
+    auto finish = std::chrono::steady_clock::now();
+    RegionStatistics statistics;
+    statistics.calls = 1;
+    statistics.seconds = std::chrono::duration<double>(finish - start).count();
+    std::array<uint64_t, NUMBER_OF_COUNTERS> values;
+    statistics.has_counters = has_counters && get_counters().read(values);
+    if (statistics.has_counters) {
+        for (std::size_t i = 0; i < NUMBER_OF_COUNTERS; i++) {
+            statistics.counters[i] = values[i] - counters[i];
+        }
+    }
+    profile->add(name, statistics);
+}
+
+}  // namespace Profiling
+
+}  // namespace Koala
@@ -15,7 +15,10 @@
 namespace Koala {
 
 PerfectGraphRecognition::PerfectGraphRecognition(NetworKit::Graph &graph)
-    : graph(std::make_optional(graph)), is_perfect(State::UNKNOWN) { }
+    : PerfectGraphRecognition(std::make_shared<const NetworKit::Graph>(graph)) { }
+
+PerfectGraphRecognition::PerfectGraphRecognition(std::shared_ptr<const NetworKit::Graph> graph)
+    : graph(std::move(graph)), is_perfect(State::UNKNOWN) { }
 
 bool PerfectGraphRecognition::isPerfect() const {
     assureFinished();
@@ -28,6 +31,7 @@ PerfectGraphRecognition::State PerfectGraphRecognition::getState() const {
 }
 
 void PerfectGraphRecognition::run() {
+    KOALA_PROFILE_RUN();
     hasRun = true;
     if (graph->numberOfNodes() <= 4) {
         is_perfect = State::PERFECT;
@@ -55,6 +59,8 @@ void PerfectGraphRecognition::run() {
 
 void PerfectGraphRecognition::check() const {
     assureFinished();
+    KOALA_PROFILE_ATTACH();
+    KOALA_PROFILE_REGION("verification");
     auto graph_complement = Koala::GraphTools::toComplement(*graph);
     assert((!contains_odd_hole(*graph) && !contains_odd_hole(graph_complement)) == isPerfect());
 }
@@ -89,6 +95,7 @@ std::vector<std::vector<NetworKit::node>> PerfectGraphRecognition::getAuxiliaryC
 
 PerfectGraphRecognition::State PerfectGraphRecognition::contains_simple_prohibited(
         const NetworKit::Graph &graph) {
+    KOALA_PROFILE_REGION("simple prohibited structures");
     if (contains_jewel(graph)) {
         return State::HAS_JEWEL;
     }
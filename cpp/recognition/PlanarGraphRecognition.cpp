@@ -0,0 +1,493 @@
+/*
+ * PlanarGraphRecognition.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <recognition/PlanarGraphRecognition.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace Koala {
+
+NetworKit::count PlanarEmbedding::upperNodeIdBound() const {
+    return offsets.size() - 1;
+}
+
+NetworKit::count PlanarEmbedding::degree(NetworKit::node u) const {
+    return offsets[u + 1] - offsets[u];
+}
+
+std::span<const NetworKit::node> PlanarEmbedding::rotation(NetworKit::node u) const {
+    return std::span<const NetworKit::node>(targets.data() + offsets[u], degree(u));
+}
+
+NetworKit::index PlanarEmbedding::twin(NetworKit::index i) const {
+    return twins[i];
+}
+
+NetworKit::count PlanarEmbedding::numberOfFaces() const {
+    // the face to the left of the entry uv continues with the entry following vu clockwise at v
+    std::vector<bool> visited(targets.size(), false);
+    NetworKit::count faces = 0;
+    for (NetworKit::index start = 0; start < targets.size(); start++) {
+        if (visited[start]) {
+            continue;
+        }
+        faces++;
+        for (NetworKit::index i = start; !visited[i]; ) {
+            visited[i] = true;
+            NetworKit::node v = targets[i];
+            NetworKit::index j = twins[i] + 1;
+            i = j == offsets[v + 1] ? offsets[v] : j;
+        }
+    }
+    return faces;
+}
+
+PlanarGraphRecognition::PlanarGraphRecognition(const NetworKit::Graph &graph)
+    : PlanarGraphRecognition(std::make_shared<const NetworKit::Graph>(graph)) { }
+
+PlanarGraphRecognition::PlanarGraphRecognition(std::shared_ptr<const NetworKit::Graph> graph)
+    : graph(std::move(graph)) { }
+
+bool PlanarGraphRecognition::isPlanar() const {
+    assureFinished();
+    return is_planar;
+}
+
+const PlanarEmbedding& PlanarGraphRecognition::getEmbedding() const {
+    assureFinished();
+    return embedding;
+}
+
+void PlanarGraphRecognition::run() {
+    KOALA_PROFILE_RUN();
+    hasRun = false, is_planar = false;
+    embedding = PlanarEmbedding(), roots.clear(), S.clear();
+    const NetworKit::count n = graph->numberOfNodes(), bound = graph->upperNodeIdBound();
+    std::vector<std::pair<NetworKit::node, NetworKit::node>> edges;
+    graph->forEdges([&](NetworKit::node u, NetworKit::node v) {
+        if (u != v) {
+            edges.emplace_back(std::min(u, v), std::max(u, v));
+        }
+    });
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    const NetworKit::count m = edges.size();
+    if (n > 2 && m > 3 * n - 6) {
+        hasRun = true;
+        return;
+    }
+
+    source.resize(m), target.resize(m);
+    adjacency_offsets.assign(bound + 1, 0);
+    for (NetworKit::index e = 0; e < m; e++) {
+        std::tie(source[e], target[e]) = edges[e];
+        adjacency_offsets[source[e] + 1]++, adjacency_offsets[target[e] + 1]++;
+    }
+    edges.clear(), edges.shrink_to_fit();
+    for (NetworKit::node v = 0; v < bound; v++) {
+        adjacency_offsets[v + 1] += adjacency_offsets[v];
+    }
+    adjacency.resize(2 * m);
+    {
+        std::vector<NetworKit::index> position(adjacency_offsets.begin(), adjacency_offsets.end());
+        for (NetworKit::index e = 0; e < m; e++) {
+            adjacency[position[source[e]]++] = e, adjacency[position[target[e]]++] = e;
+        }
+    }
+
+    height.assign(bound, NONE), parent_edge.assign(bound, NONE);
+    lowpt.assign(m, 0), lowpt2.assign(m, 0), nesting_depth.assign(m, 0);
+    orient();
+    adjacency_offsets.clear(), adjacency.clear();
+    adjacency_offsets.shrink_to_fit(), adjacency.shrink_to_fit();
+    lowpt2.clear(), lowpt2.shrink_to_fit();
+
+    sort_out_edges();
+    ref.assign(m, NONE), lowpt_edge.assign(m, NONE), stack_bottom.assign(m, 0), side.assign(m, 1);
+    is_planar = test();
+    if (!is_planar) {
+        hasRun = true;
+        return;
+    }
+    height.clear(), lowpt.clear(), lowpt_edge.clear(), stack_bottom.clear(), S.clear();
+
+    for (NetworKit::index e = 0; e < m; e++) {
+        nesting_depth[e] *= sign(e);
+    }
+    sort_out_edges();
+    embed();
+    hasRun = true;
+}
+
+void PlanarGraphRecognition::orient() {
+    std::vector<NetworKit::index> position(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+    std::vector<bool> oriented(source.size(), false), skip(source.size(), false);
+    std::vector<NetworKit::node> stack;
+    graph->forNodes([&](NetworKit::node root) {
+        if (height[root] != NONE) {
+            return;
+        }
+        height[root] = 0;
+        roots.push_back(root);
+        stack.push_back(root);
+        while (!stack.empty()) {
+            NetworKit::node v = stack.back();
+            stack.pop_back();
+            NetworKit::index e = parent_edge[v];
+            for (; position[v] < adjacency_offsets[v + 1]; position[v]++) {
+                NetworKit::index vw = adjacency[position[v]];
+                if (vw == e) {
+                    // the tree edge to the parent is finalized once, when the parent is revisited
+                    continue;
+                }
+                if (!skip[vw]) {
+                    if (oriented[vw]) {
+                        continue;
+                    }
+                    NetworKit::node w = source[vw] ^ target[vw] ^ v;
+                    oriented[vw] = true, source[vw] = v, target[vw] = w;
+                    lowpt[vw] = lowpt2[vw] = height[v];
+                    if (height[w] == NONE) {
+                        // tree edge, v is revisited after the subtree of w
+                        parent_edge[w] = vw, height[w] = height[v] + 1;
+                        stack.push_back(v), stack.push_back(w);
+                        skip[vw] = true;
+                        break;
+                    }
+                    // back edge
+                    lowpt[vw] = height[w];
+                }
+                nesting_depth[vw] = 2 * static_cast<int64_t>(lowpt[vw]);
+                if (lowpt2[vw] < height[v]) {
+                    // chordal edge
+                    nesting_depth[vw]++;
+                }
+                if (e != NONE) {
+                    if (lowpt[vw] < lowpt[e]) {
+                        lowpt2[e] = std::min(lowpt[e], lowpt2[vw]);
+                        lowpt[e] = lowpt[vw];
+                    } else if (lowpt[vw] > lowpt[e]) {
+                        lowpt2[e] = std::min(lowpt2[e], lowpt[vw]);
+                    } else {
+                        lowpt2[e] = std::min(lowpt2[e], lowpt2[vw]);
+                    }
+                }
+            }
+        }
+    });
+}
+
+void PlanarGraphRecognition::sort_out_edges() {
+    const NetworKit::count bound = graph->upperNodeIdBound(), m = source.size();
+    // the nesting depths lie in [-(2n + 1), 2n + 1], so all edges are bucket sorted by them at once
+    // and then distributed stably to their sources, in linear time
+    const int64_t shift = 2 * static_cast<int64_t>(graph->numberOfNodes()) + 1;
+    std::vector<NetworKit::index> bucket_offsets(2 * shift + 2, 0);
+    for (NetworKit::index e = 0; e < m; e++) {
+        bucket_offsets[nesting_depth[e] + shift + 1]++;
+    }
+    for (NetworKit::index i = 0; i + 1 < bucket_offsets.size(); i++) {
+        bucket_offsets[i + 1] += bucket_offsets[i];
+    }
+    std::vector<NetworKit::index> sorted(m);
+    for (NetworKit::index e = 0; e < m; e++) {
+        sorted[bucket_offsets[nesting_depth[e] + shift]++] = e;
+    }
+
+    out_offsets.assign(bound + 1, 0);
+    for (NetworKit::index e = 0; e < m; e++) {
+        out_offsets[source[e] + 1]++;
+    }
+    for (NetworKit::node v = 0; v < bound; v++) {
+        out_offsets[v + 1] += out_offsets[v];
+    }
+    out_edges.resize(m);
+    std::vector<NetworKit::index> position(out_offsets.begin(), out_offsets.end() - 1);
+    for (NetworKit::index e : sorted) {
+        out_edges[position[source[e]]++] = e;
+    }
+}
+
+bool PlanarGraphRecognition::test() {
+    std::vector<NetworKit::index> position(out_offsets.begin(), out_offsets.end() - 1);
+    std::vector<bool> skip(source.size(), false);
+    std::vector<NetworKit::node> stack;
+    for (NetworKit::node root : roots) {
+        stack.push_back(root);
+        while (!stack.empty()) {
+            NetworKit::node v = stack.back();
+            stack.pop_back();
+            NetworKit::index e = parent_edge[v];
+            bool skip_final = false;
+            for (; position[v] < out_offsets[v + 1]; position[v]++) {
+                NetworKit::index ei = out_edges[position[v]];
+                if (!skip[ei]) {
+                    stack_bottom[ei] = S.size();
+                    if (ei == parent_edge[target[ei]]) {
+                        // tree edge, v is revisited after the subtree of its target
+                        stack.push_back(v), stack.push_back(target[ei]);
+                        skip[ei] = true, skip_final = true;
+                        break;
+                    }
+                    // back edge
+                    lowpt_edge[ei] = ei;
+                    S.push_back(ConflictPair{Interval(), Interval{ei, ei}});
+                }
+                // integrate the new return edges
+                if (lowpt[ei] < height[v]) {
+                    if (ei == out_edges[out_offsets[v]]) {
+                        lowpt_edge[e] = lowpt_edge[ei];
+                    } else if (!add_constraints(ei, e)) {
+                        return false;
+                    }
+                }
+            }
+            if (!skip_final && e != NONE) {
+                remove_back_edges(e);
+            }
+        }
+    }
+    return true;
+}
+
+bool PlanarGraphRecognition::add_constraints(NetworKit::index ei, NetworKit::index e) {
+    ConflictPair P;
+    // merge the return edges of ei into P.right
+    do {
+        ConflictPair Q = S.back();
+        S.pop_back();
+        if (!Q.left.empty()) {
+            std::swap(Q.left, Q.right);
+        }
+        if (!Q.left.empty()) {
+            return false;
+        }
+        if (lowpt[Q.right.low] > lowpt[e]) {
+            if (P.right.empty()) {
+                P.right.high = Q.right.high;
+            } else {
+                ref[P.right.low] = Q.right.high;
+            }
+            P.right.low = Q.right.low;
+        } else {
+            ref[Q.right.low] = lowpt_edge[e];
+        }
+    } while (S.size() != stack_bottom[ei]);
+
+    // merge the conflicting return edges of the previous out-edges into P.left
+    while (!S.empty() && (conflicting(S.back().left, ei) || conflicting(S.back().right, ei))) {
+        ConflictPair Q = S.back();
+        S.pop_back();
+        if (conflicting(Q.right, ei)) {
+            std::swap(Q.left, Q.right);
+        }
+        if (conflicting(Q.right, ei)) {
+            return false;
+        }
+        // merge the interval below lowpt[ei] into P.right
+        if (P.right.low != NONE) {
+            ref[P.right.low] = Q.right.high;
+        }
+        if (Q.right.low != NONE) {
+            P.right.low = Q.right.low;
+        }
+        if (P.left.empty()) {
+            P.left.high = Q.left.high;
+        } else if (P.left.low != NONE) {
+            ref[P.left.low] = Q.left.high;
+        }
+        P.left.low = Q.left.low;
+    }
+    if (!P.left.empty() || !P.right.empty()) {
+        S.push_back(P);
+    }
+    return true;
+}
+
+void PlanarGraphRecognition::remove_back_edges(NetworKit::index e) {
+    NetworKit::node u = source[e];
+    // drop the entire conflict pairs of the back edges ending at u
+    while (!S.empty() && lowest(S.back()) == height[u]) {
+        if (S.back().left.low != NONE) {
+            side[S.back().left.low] = -1;
+        }
+        S.pop_back();
+    }
+    if (!S.empty()) {
+        // trim the remaining conflict pair
+        ConflictPair &P = S.back();
+        while (P.left.high != NONE && target[P.left.high] == u) {
+            P.left.high = ref[P.left.high];
+        }
+        if (P.left.high == NONE && P.left.low != NONE) {
+            ref[P.left.low] = P.right.low, side[P.left.low] = -1;
+            P.left.low = NONE;
+        }
+        while (P.right.high != NONE && target[P.right.high] == u) {
+            P.right.high = ref[P.right.high];
+        }
+        if (P.right.high == NONE && P.right.low != NONE) {
+            ref[P.right.low] = P.left.low, side[P.right.low] = -1;
+            P.right.low = NONE;
+        }
+    }
+    // the side of e is the side of a highest return edge
+    if (lowpt[e] < height[u]) {
+        NetworKit::index hl = S.back().left.high, hr = S.back().right.high;
+        ref[e] = hl != NONE && (hr == NONE || lowpt[hl] > lowpt[hr]) ? hl : hr;
+    }
+}
+
+int PlanarGraphRecognition::sign(NetworKit::index e) {
+    std::vector<NetworKit::index> path{e};
+    while (ref[path.back()] != NONE) {
+        path.push_back(ref[path.back()]);
+    }
+    for (NetworKit::index i = path.size() - 1; i > 0; i--) {
+        side[path[i - 1]] *= side[path[i]];
+        ref[path[i - 1]] = NONE;
+    }
+    return side[e];
+}
+
+void PlanarGraphRecognition::embed() {
+    // the half-edges 2e and 2e + 1 leave the source and the target of e, respectively, and
+    // the rotations are kept as circular lists, starting from first[v]
+    const NetworKit::count bound = graph->upperNodeIdBound(), m = source.size();
+    std::vector<NetworKit::index> cw(2 * m), ccw(2 * m), first(bound, NONE);
+    auto add_cw = [&](NetworKit::node v, NetworKit::index h, NetworKit::index reference) {
+        if (reference == NONE) {
+            cw[h] = ccw[h] = h, first[v] = h;
+            return;
+        }
+        NetworKit::index next = cw[reference];
+        cw[reference] = h, ccw[h] = reference, cw[h] = next, ccw[next] = h;
+    };
+    auto add_ccw = [&](NetworKit::node v, NetworKit::index h, NetworKit::index reference) {
+        if (reference == NONE) {
+            add_cw(v, h, NONE);
+            return;
+        }
+        add_cw(v, h, ccw[reference]);
+        if (first[v] == reference) {
+            first[v] = h;
+        }
+    };
+
+    for (NetworKit::node v = 0; v < bound; v++) {
+        NetworKit::index previous = NONE;
+        for (NetworKit::index i = out_offsets[v]; i < out_offsets[v + 1]; i++) {
+            add_cw(v, 2 * out_edges[i], previous);
+            previous = 2 * out_edges[i];
+        }
+    }
+
+    std::vector<NetworKit::index> left_ref(bound, NONE), right_ref(bound, NONE);
+    std::vector<NetworKit::index> position(out_offsets.begin(), out_offsets.end() - 1);
+    std::vector<NetworKit::node> stack;
+    for (NetworKit::node root : roots) {
+        stack.push_back(root);
+        while (!stack.empty()) {
+            NetworKit::node v = stack.back();
+            stack.pop_back();
+            while (position[v] < out_offsets[v + 1]) {
+                NetworKit::index ei = out_edges[position[v]++];
+                NetworKit::node w = target[ei];
+                if (ei == parent_edge[w]) {
+                    add_ccw(w, 2 * ei + 1, first[w]);
+                    left_ref[v] = right_ref[v] = 2 * ei;
+                    stack.push_back(v), stack.push_back(w);
+                    break;
+                }
+                if (side[ei] == 1) {
+                    add_cw(w, 2 * ei + 1, right_ref[w]);
+                } else {
+                    add_ccw(w, 2 * ei + 1, left_ref[w]);
+                    left_ref[w] = 2 * ei + 1;
+                }
+            }
+        }
+    }
+
+    embedding.offsets.assign(bound + 1, 0);
+    embedding.targets.resize(2 * m), embedding.twins.resize(2 * m);
+    std::vector<NetworKit::index> location(2 * m);
+    NetworKit::index i = 0;
+    for (NetworKit::node v = 0; v < bound; v++) {
+        if (first[v] != NONE) {
+            NetworKit::index h = first[v];
+            do {
+                location[h] = i;
+                embedding.targets[i++] = h % 2 == 0 ? target[h / 2] : source[h / 2];
+                h = cw[h];
+            } while (h != first[v]);
+        }
+        embedding.offsets[v + 1] = i;
+    }
+    for (NetworKit::index h = 0; h < 2 * m; h++) {
+        embedding.twins[location[h]] = location[h ^ 1];
+    }
+}
+
+bool PlanarGraphRecognition::conflicting(const Interval &I, NetworKit::index b) const {
+    return !I.empty() && I.high != NONE && lowpt[I.high] > lowpt[b];
+}
+
+NetworKit::index PlanarGraphRecognition::lowest(const ConflictPair &P) const {
+    if (P.left.empty()) {
+        return lowpt[P.right.low];
+    }
+    if (P.right.empty()) {
+        return lowpt[P.left.low];
+    }
+    return std::min(lowpt[P.left.low], lowpt[P.right.low]);
+}
+
+void PlanarGraphRecognition::check() const {
+    assureFinished();
+    KOALA_PROFILE_ATTACH();
+    KOALA_PROFILE_REGION("verification");
+    if (!is_planar) {
+        return;
+    }
+    assert(embedding.upperNodeIdBound() == graph->upperNodeIdBound());
+    NetworKit::count vertices = 0, edges = 0, components = 0;
+    std::vector<bool> visited(graph->upperNodeIdBound(), false);
+    std::vector<NetworKit::node> stack;
+    graph->forNodes([&](NetworKit::node v) {
+        auto rotation = embedding.rotation(v);
+        for (NetworKit::index i = 0; i < rotation.size(); i++) {
+            NetworKit::index j = embedding.twin(embedding.offsets[v] + i);
+            assert(graph->hasEdge(v, rotation[i]) || graph->hasEdge(rotation[i], v));
+            assert(embedding.targets[j] == v && embedding.twin(j) == embedding.offsets[v] + i);
+        }
+        edges += rotation.size();
+        if (rotation.empty() || visited[v]) {
+            return;
+        }
+        components++;
+        visited[v] = true;
+        stack.push_back(v);
+        while (!stack.empty()) {
+            NetworKit::node u = stack.back();
+            stack.pop_back();
+            vertices++;
+            for (NetworKit::node w : embedding.rotation(u)) {
+                if (!visited[w]) {
+                    visited[w] = true;
+                    stack.push_back(w);
+                }
+            }
+        }
+    });
+    // the Euler formula holds for every connected component with at least one edge
+    assert(edges == 2 * source.size());
+    assert(embedding.numberOfFaces() + vertices == edges / 2 + 2 * components);
+}
+
+}  /* namespace Koala */
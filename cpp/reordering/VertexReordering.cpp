@@ -0,0 +1,293 @@
+/*
+ * VertexReordering.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <reordering/VertexReordering.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <queue>
+
+#include <networkit/graph/GraphTools.hpp>
+
+namespace Koala {
+
+VertexReordering::VertexReordering(const NetworKit::Graph &graph)
+    : VertexReordering(std::make_shared<const NetworKit::Graph>(graph)) { }
+
+VertexReordering::VertexReordering(std::shared_ptr<const NetworKit::Graph> graph)
+    : graph(std::move(graph)) { }
+
+const std::vector<NetworKit::node>& VertexReordering::getPermutation() const {
+    assureFinished();
+    return permutation;
+}
+
+const std::vector<NetworKit::node>& VertexReordering::getInversePermutation() const {
+    assureFinished();
+    return inverse;
+}
+
+const NetworKit::Graph& VertexReordering::getReorderedGraph() const {
+    assureFinished();
+    return *reordered;
+}
+
+NetworKit::node VertexReordering::mapBack(NetworKit::node v) const {
+    assureFinished();
+    return inverse[v];
+}
+
+std::set<NetworKit::node> VertexReordering::mapBack(
+        const std::set<NetworKit::node> &vertices) const {
+    assureFinished();
+    std::set<NetworKit::node> result;
+    for (auto v : vertices) {
+        result.insert(inverse[v]);
+    }
+    return result;
+}
+
+NetworKit::Graph VertexReordering::mapBack(const NetworKit::Graph &subgraph) const {
+    assureFinished();
+    auto result = NetworKit::GraphTools::copyNodes(*graph);
+    subgraph.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        result.addEdge(inverse[u], inverse[v], w);
+    });
+    return result;
+}
+
+void VertexReordering::build() {
+    permutation.assign(graph->upperNodeIdBound(), NetworKit::none);
+    for (NetworKit::node v = 0; v < inverse.size(); v++) {
+        permutation[inverse[v]] = v;
+    }
+    // adding the edges from the smaller endpoints in the increasing order appends every endpoint to
+    // the adjacency lists in the increasing order, so all the lists end up sorted
+    reordered = NetworKit::Graph(inverse.size(), graph->isWeighted(), graph->isDirected());
+    std::vector<std::pair<NetworKit::node, NetworKit::edgeweight>> adjacency;
+    for (NetworKit::node u = 0; u < inverse.size(); u++) {
+        adjacency.clear();
+        graph->forNeighborsOf(inverse[u], [&](NetworKit::node v, NetworKit::edgeweight w) {
+            if (graph->isDirected() || permutation[v] >= u) {
+                adjacency.emplace_back(permutation[v], w);
+            }
+        });
+        std::sort(adjacency.begin(), adjacency.end());
+        for (const auto &[v, w] : adjacency) {
+            reordered->addEdge(u, v, w);
+        }
+    }
+}
+
+void VertexReordering::check() const {
+    assureFinished();
+    KOALA_PROFILE_ATTACH();
+    KOALA_PROFILE_REGION("verification");
+    assert(inverse.size() == graph->numberOfNodes());
+    for (NetworKit::node v = 0; v < inverse.size(); v++) {
+        assert(graph->hasNode(inverse[v]));
+        assert(permutation[inverse[v]] == v);
+    }
+    assert(reordered->numberOfEdges() == graph->numberOfEdges());
+    reordered->forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        assert(graph->hasEdge(inverse[u], inverse[v]));
+        assert(graph->weight(inverse[u], inverse[v]) == w);
+    });
+}
+
+void DegreeSortReordering::run() {
+    KOALA_PROFILE_RUN();
+    inverse.clear();
+    graph->forNodes([&](NetworKit::node v) {
+        inverse.push_back(v);
+    });
+    std::stable_sort(inverse.begin(), inverse.end(), [&](NetworKit::node u, NetworKit::node v) {
+        return graph->degree(u) > graph->degree(v);
+    });
+    build();
+    hasRun = true;
+}
+
+void BFSReordering::run() {
+    KOALA_PROFILE_RUN();
+    inverse.clear();
+    std::vector<bool> visited(graph->upperNodeIdBound(), false);
+    graph->forNodes([&](NetworKit::node s) {
+        if (visited[s]) {
+            return;
+        }
+        visited[s] = true;
+        inverse.push_back(s);
+        for (NetworKit::index i = inverse.size() - 1; i < inverse.size(); i++) {
+            graph->forNeighborsOf(inverse[i], [&](NetworKit::node v) {
+                if (!visited[v]) {
+                    visited[v] = true;
+                    inverse.push_back(v);
+                }
+            });
+        }
+    });
+    build();
+    hasRun = true;
+}
+
+void ReverseCuthillMcKeeReordering::run() {
+    KOALA_PROFILE_RUN();
+    inverse.clear();
+    std::vector<NetworKit::node> starts;
+    graph->forNodes([&](NetworKit::node v) {
+        starts.push_back(v);
+    });
+    std::stable_sort(starts.begin(), starts.end(), [&](NetworKit::node u, NetworKit::node v) {
+        return graph->degree(u) < graph->degree(v);
+    });
+
+    std::vector<NetworKit::count> distance(graph->upperNodeIdBound(), NetworKit::none);
+    std::vector<NetworKit::node> level_order;
+    std::vector<bool> visited(graph->upperNodeIdBound(), false);
+    // the breadth-first search from s over the unvisited vertices, returning the eccentricity of s;
+    // the distances are left set for the vertices in level_order
+    auto search = [&](NetworKit::node s) {
+        level_order.assign(1, s);
+        distance[s] = 0;
+        for (NetworKit::index i = 0; i < level_order.size(); i++) {
+            auto u = level_order[i];
+            graph->forNeighborsOf(u, [&](NetworKit::node v) {
+                if (!visited[v] && distance[v] == NetworKit::none) {
+                    distance[v] = distance[u] + 1;
+                    level_order.push_back(v);
+                }
+            });
+        }
+        return distance[level_order.back()];
+    };
+    auto reset = [&]() {
+        for (auto v : level_order) {
+            distance[v] = NetworKit::none;
+        }
+    };
+
+    std::vector<NetworKit::node> neighbors;
+    for (auto start : starts) {
+        if (visited[start]) {
+            continue;
+        }
+        // George-Liu: move to a vertex of the smallest degree in the last level while the
+        // eccentricity grows
+        NetworKit::node root = start;
+        for (auto eccentricity = search(root);;) {
+            NetworKit::node candidate = level_order.back();
+            for (auto v : level_order) {
+                if (distance[v] == eccentricity && graph->degree(v) < graph->degree(candidate)) {
+                    candidate = v;
+                }
+            }
+            reset();
+            auto candidate_eccentricity = search(candidate);
+            if (candidate_eccentricity <= eccentricity) {
+                reset();
+                break;
+            }
+            root = candidate, eccentricity = candidate_eccentricity;
+        }
+
+        visited[root] = true;
+        inverse.push_back(root);
+        for (NetworKit::index i = inverse.size() - 1; i < inverse.size(); i++) {
+            neighbors.clear();
+            graph->forNeighborsOf(inverse[i], [&](NetworKit::node v) {
+                if (!visited[v]) {
+                    visited[v] = true;
+                    neighbors.push_back(v);
+                }
+            });
+            std::stable_sort(
+                neighbors.begin(), neighbors.end(), [&](NetworKit::node u, NetworKit::node v) {
+                    return graph->degree(u) < graph->degree(v);
+                });
+            inverse.insert(inverse.end(), neighbors.begin(), neighbors.end());
+        }
+    }
+    std::reverse(inverse.begin(), inverse.end());
+    build();
+    hasRun = true;
+}
+
+GorderReordering::GorderReordering(const NetworKit::Graph &graph, NetworKit::count window)
+    : VertexReordering(graph), window(window) { }
+
+GorderReordering::GorderReordering(
+        std::shared_ptr<const NetworKit::Graph> graph, NetworKit::count window)
+    : VertexReordering(std::move(graph)), window(window) { }
+
+void GorderReordering::run() {
+    KOALA_PROFILE_RUN();
+    inverse.clear();
+    if (graph->numberOfNodes() == 0) {
+        build();
+        hasRun = true;
+        return;
+    }
+    auto hub_degree = static_cast<NetworKit::count>(
+        std::sqrt(static_cast<double>(graph->numberOfNodes())));
+    std::vector<int64_t> score(graph->upperNodeIdBound(), 0);
+    std::vector<bool> placed(graph->upperNodeIdBound(), false);
+    std::priority_queue<std::pair<int64_t, NetworKit::node>> heap;
+    NetworKit::node first = NetworKit::none;
+    graph->forNodes([&](NetworKit::node v) {
+        heap.emplace(0, v);
+        if (first == NetworKit::none || graph->degreeIn(v) > graph->degreeIn(first)) {
+            first = v;
+        }
+    });
+
+    // the scores are changed by delta for all the unplaced vertices sharing an edge or a non-hub
+    // in-neighbor with v, and the stale entries of the heap are skipped when popped
+    auto update = [&](NetworKit::node v, int64_t delta) {
+        auto bump = [&](NetworKit::node u) {
+            if (!placed[u]) {
+                score[u] += delta;
+                heap.emplace(score[u], u);
+            }
+        };
+        graph->forNeighborsOf(v, bump);
+        if (graph->isDirected()) {
+            graph->forInNeighborsOf(v, bump);
+        }
+        graph->forInNeighborsOf(v, [&](NetworKit::node u) {
+            if (graph->degree(u) <= hub_degree) {
+                graph->forNeighborsOf(u, [&](NetworKit::node w) {
+                    if (w != v) {
+                        bump(w);
+                    }
+                });
+            }
+        });
+    };
+    auto place = [&](NetworKit::node v) {
+        placed[v] = true;
+        inverse.push_back(v);
+        update(v, 1);
+        if (inverse.size() > window) {
+            update(inverse[inverse.size() - 1 - window], -1);
+        }
+    };
+
+    place(first);
+    while (inverse.size() < graph->numberOfNodes()) {
+        auto [key, v] = heap.top();
+        heap.pop();
+        if (!placed[v] && key == score[v]) {
+            place(v);
+        }
+    }
+    build();
+    hasRun = true;
+}
+
+}  /* namespace Koala */
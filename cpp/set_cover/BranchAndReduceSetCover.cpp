@@ -78,13 +78,25 @@ void BranchAndReduceSetCover::check() const {
 
 void BranchAndReduceSetCover::run() {
     hasRun = true;
+    interrupted = false;
     recurse().swap(set_cover);
+    optimal = !interrupted;
 }
 
 std::vector<bool> BranchAndReduceSetCover::recurse() {
     if (std::all_of(family.begin(), family.end(), [](const auto& e) { return e.empty(); })) {
         return std::vector<bool>(family.size());
     }
+    if (pollStopRequested()) {
+        // once cancelled, every element left is covered by any set containing it
+        std::vector<bool> cover(family.size());
+        for (const auto &occurence : occurences) {
+            if (!occurence.empty()) {
+                cover[*occurence.begin()] = true;
+            }
+        }
+        return cover;
+    }
     if (reduce()) {
         return set_cover;
     }
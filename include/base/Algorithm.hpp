@@ -0,0 +1,129 @@
+/*
+ * Algorithm.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <stop_token>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/Graph.hpp>
+
+#include <profiling/Profiler.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup base
+ * The base class for all Koala algorithms, extending the NetworKit one with cooperative
+ * cancellation and with the profile of the annotated phases of the last run.
+ *
+ * Long-running algorithms poll the stop token and the deadline in their search loops. Once either
+ * fires, they stop early and report the best solution found so far, which is always feasible, but
+ * not proven optimal.
+ *
+ */
+class Algorithm : public NetworKit::Algorithm {
+ public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Set the token used to request the cancellation of subsequent runs.
+     *
+     * @param token The stop token, e.g. obtained from a std::stop_source.
+     */
+    void setStopToken(std::stop_token token);
+
+    /**
+     * Set the point in time after which subsequent runs are cancelled.
+     *
+     * @param deadline The deadline.
+     */
+    void setDeadline(Clock::time_point deadline);
+
+    /**
+     * Set the deadline of subsequent runs to the given amount of time from now.
+     *
+     * @param limit The time limit.
+     */
+    void setTimeLimit(std::chrono::duration<double> limit);
+
+    /**
+     * Return whether the last run stopped early due to a cancellation or a deadline.
+     *
+     * @return true if the last run was interrupted.
+     */
+    bool isInterrupted() const;
+
+    /**
+     * Return whether the result of the last run is proven optimal, i.e. whether the algorithm is
+     * exact and its last run was not interrupted.
+     *
+     * @return true if the result is optimal.
+     */
+    bool isOptimal() const;
+
+    /**
+     * Return the per-phase profile of the last run and of the checks performed after it. The
+     * profile is always empty unless the library is built with KOALA_ENABLE_PROFILING.
+     *
+     * @return the profile of the algorithm.
+     */
+    const Profiling::Profile& getProfile() const;
+
+ protected:
+    /**
+     * Check the stop token and the deadline. Once it returns true, the run is marked as
+     * interrupted and it keeps returning true until interrupted is reset by the next run.
+     *
+     * @return true if the run should stop.
+     */
+    bool isStopRequested();
+
+    /**
+     * A cheaper version of isStopRequested() for the innermost search loops, reading the clock
+     * only once every POLL_INTERVAL calls.
+     *
+     * @return true if the run should stop.
+     */
+    bool pollStopRequested();
+
+    /**
+     * Return the stop token set for the runs, e.g. to pass it on to the nested algorithms.
+     */
+    const std::stop_token& getStopToken() const;
+
+    /**
+     * Return the deadline set for the runs, if any.
+     */
+    const std::optional<Clock::time_point>& getDeadline() const;
+
+    static constexpr unsigned POLL_INTERVAL = 64;
+
+    bool interrupted = false, optimal = false;
+    mutable Profiling::Profile profile;
+
+ private:
+    std::stop_token stop_token;
+    std::optional<Clock::time_point> deadline;
+    unsigned polls = 0;
+};
+
+/**
+ * Wrap the graph in a non-owning pointer, so that it can be passed to the algorithms that accept
+ * a std::shared_ptr<const NetworKit::Graph> without being copied. The caller has to keep the graph
+ * alive and unchanged for the lifetime of the algorithm.
+ *
+ * @param graph The input graph.
+ * @return a pointer to the graph that does not delete it.
+ */
+inline std::shared_ptr<const NetworKit::Graph> borrow(const NetworKit::Graph &graph) {
+    return std::shared_ptr<const NetworKit::Graph>(&graph, [](const NetworKit::Graph*) { });
+}
+
+} /* namespace Koala */
@@ -0,0 +1,162 @@
+/*
+ * Portfolio.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <stop_token>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+#include <base/Algorithm.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup base
+ * The class for racing several algorithms for the same problem on the same graph, e.g. the exact
+ * maximum independent set algorithms. All of them run concurrently, each on its own thread, and the
+ * first one to finish with a proven optimal result becomes the winner, after which the others are
+ * cancelled through their stop tokens. Hence, the portfolio takes about as long as the fastest of
+ * the algorithms on the given instance. The cancellation is cooperative: run() returns only after
+ * all the algorithms stop, so the ones that never poll the stop token run to completion.
+ *
+ * The stop token and the deadline of the portfolio are passed on to all the algorithms. If all of
+ * them are interrupted, the winner is the one that stopped first, and its result is feasible, but
+ * not proven optimal.
+ */
+template <class... Algorithms>
+class Portfolio final : public Algorithm {
+ public:
+    /**
+     * Given an input graph, set up all the algorithms on a single shared copy of the graph.
+     *
+     * @param graph The input graph.
+     */
+    explicit Portfolio(const NetworKit::Graph &graph)
+        : Portfolio(std::make_shared<const NetworKit::Graph>(graph)) { }
+
+    /**
+     * Given a shared input graph, set up all the algorithms without copying the graph.
+     *
+     * @param graph The input graph, e.g. obtained from Koala::borrow().
+     */
+    explicit Portfolio(std::shared_ptr<const NetworKit::Graph> graph)
+        : algorithms(std::make_unique<Algorithms>(graph)...) { }
+
+    /**
+     * Execute all the algorithms concurrently until one of them finds a proven optimal result.
+     * If none of them finishes, the exception thrown by the first one is rethrown.
+     */
+    void run() {
+        KOALA_PROFILE_RUN();
+        std::stop_source source;
+        std::stop_callback forward(getStopToken(), [&source] { source.request_stop(); });
+        std::atomic<std::size_t> first(NONE), first_optimal(NONE);
+        std::vector<std::exception_ptr> errors(sizeof...(Algorithms));
+        {
+            std::vector<std::jthread> threads;
+            for_each([&](auto &algorithm, std::size_t i) {
+                algorithm.setStopToken(source.get_token());
+                if (getDeadline()) {
+                    algorithm.setDeadline(*getDeadline());
+                }
+                threads.emplace_back([&, i] {
+                    try {
+                        algorithm.run();
+                    } catch (...) {
+                        errors[i] = std::current_exception();
+                        return;
+                    }
+                    auto expected = NONE;
+                    first.compare_exchange_strong(expected, i);
+                    expected = NONE;
+                    if (algorithm.isOptimal()
+                            && first_optimal.compare_exchange_strong(expected, i)) {
+                        source.request_stop();
+                    }
+                });
+            });
+        }
+        if (first == NONE) {
+            for (const auto &error : errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+        }
+        winner = first_optimal != NONE ? first_optimal.load() : first.load();
+        optimal = first_optimal != NONE;
+        // none of the results may be proven optimal without any cancellation, e.g. for heuristics
+        interrupted = !optimal && isStopRequested();
+        hasRun = true;
+    }
+
+    /**
+     * Return the index of the algorithm whose result is reported by the portfolio.
+     */
+    std::size_t getWinner() const {
+        assureFinished();
+        return winner;
+    }
+
+    /**
+     * Return the I-th algorithm, e.g. to configure it before the run or to inspect it after.
+     */
+    template <std::size_t I>
+    auto& get() {
+        return *std::get<I>(algorithms);
+    }
+
+    template <std::size_t I>
+    const auto& get() const {
+        return *std::get<I>(algorithms);
+    }
+
+    /**
+     * Call the function on the winning algorithm and return its result, e.g.
+     * visit([](const auto &algorithm) { return algorithm.getIndependentSet(); }).
+     */
+    template <class Function>
+    decltype(auto) visit(Function function) const {
+        assureFinished();
+        return visit_at<0>(function);
+    }
+
+ private:
+    static constexpr std::size_t NONE = sizeof...(Algorithms);
+
+    std::tuple<std::unique_ptr<Algorithms>...> algorithms;
+    std::size_t winner = NONE;
+
+    template <class Function>
+    void for_each(Function function) {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (function(*std::get<I>(algorithms), I), ...);
+        }(std::index_sequence_for<Algorithms...>());
+    }
+
+    template <std::size_t I, class Function>
+    decltype(auto) visit_at(Function &function) const {
+        if constexpr (I + 1 == sizeof...(Algorithms)) {
+            return function(*std::get<I>(algorithms));
+        } else {
+            if (winner == I) {
+                return function(*std::get<I>(algorithms));
+            }
+            return visit_at<I + 1>(function);
+        }
+    }
+};
+
+}  /* namespace Koala */
@@ -8,17 +8,21 @@
 #pragma once
 
 #include <map>
+#include <memory>
+#include <memory_resource>
 #include <optional>
 #include <set>
 #include <unordered_map>
 #include <vector>
 
-#include <networkit/base/Algorithm.hpp>
 #include <networkit/graph/Graph.hpp>
 
+#include <base/Algorithm.hpp>
+#include <structures/SearchArena.hpp>
+
 namespace Koala {
 
-class EnumerationVertexColoring : public NetworKit::Algorithm {
+class EnumerationVertexColoring : public Algorithm {
  public:
     /**
      * Given an input graph, set up the enumeration vertex coloring procedure.
@@ -27,6 +31,14 @@ class EnumerationVertexColoring : public NetworKit::Algorithm {
      */
     explicit EnumerationVertexColoring(const NetworKit::Graph& graph);
 
+    /**
+     * Given a shared input graph, set up the enumeration vertex coloring procedure without copying
+     * the graph.
+     *
+     * @param graph The input graph, e.g. obtained from Koala::borrow().
+     */
+    explicit EnumerationVertexColoring(std::shared_ptr<const NetworKit::Graph> graph);
+
     /**
      * Return the coloring found by the algorithm.
      *
@@ -34,12 +46,21 @@ class EnumerationVertexColoring : public NetworKit::Algorithm {
      */
     const std::map<NetworKit::node, int> getColoring() const;
 
+    /**
+     * Set the resource providing the memory for the sets of feasible colors. By default, the
+     * algorithm keeps its own pool on top of the default resource.
+     *
+     * @param resource The upstream memory resource.
+     */
+    void setMemoryResource(std::pmr::memory_resource *resource);
+
  protected:
-    const std::optional<NetworKit::Graph> graph;
+    const std::shared_ptr<const NetworKit::Graph> graph;
     std::vector<NetworKit::node> ordering;
     std::unordered_map<NetworKit::node, int> position;
     std::vector<int> current_solution, best_solution;
-    std::vector<std::set<int>> feasible_colors;
+    SearchArena arena;
+    std::vector<std::pmr::set<int>> feasible_colors;
     std::set<int, std::greater<int>> current_predecessors;
     int lower_bound, upper_bound, current_bound;
     int r;
@@ -47,6 +68,7 @@ class EnumerationVertexColoring : public NetworKit::Algorithm {
     void forwards();
     void backwards();
     void determine_feasible_colors(int i);
+    void resize_feasible_colors();
     virtual void determine_current_predecessors(int r) = 0;
 };
 
@@ -105,7 +127,7 @@ class KormanEnumerationVertexColoring : public BrownEnumerationVertexColoring {
     void dynamic_rearrangement(int i);
     void forwards();
     void backwards();
-    void determine_feasible_colors(int i, std::unordered_set<int> blocked_colors);
+    void determine_feasible_colors(int i, const std::unordered_set<int> &blocked_colors);
 };
 
 } /* namespace Koala */
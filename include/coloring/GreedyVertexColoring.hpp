@@ -7,6 +7,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
+#include <networkit/auxiliary/BucketPQ.hpp>
+
+#include <graph/GraphConcept.hpp>
+
 #include "VertexColoring.hpp"
 
 namespace Koala {
@@ -100,4 +107,58 @@ class GreedyIndependentSetVertexColoring final : public GreedyVertexColoring {
     void run();
 };
 
+/**
+ * @ingroup coloring
+ * Color greedily the vertices of a read-only graph, e.g. of a StaticGraph, in the given order,
+ * each with the smallest color not used by its neighbors.
+ *
+ * @param G        The input graph.
+ * @param ordering The order of the vertices.
+ * @return the colors 1, 2, ... indexed by the vertices, and 0 for the ones not in the ordering.
+ */
+template <ReadOnlyGraph Graph>
+std::vector<int> greedyColoring(const Graph &G, const std::vector<NetworKit::node> &ordering) {
+    std::vector<int> colors(G.upperNodeIdBound(), 0);
+    // forbidden[c] == v + 1 iff the color c is used by a neighbor of v
+    std::vector<NetworKit::node> forbidden(ordering.size() + 2, 0);
+    for (auto v : ordering) {
+        G.forNeighborsOf(v, [&](NetworKit::node u) {
+            forbidden[colors[u]] = v + 1;
+        });
+        int color = 1;
+        while (forbidden[color] == v + 1) {
+            color++;
+        }
+        colors[v] = color;
+    }
+    return colors;
+}
+
+/**
+ * @ingroup coloring
+ * Return the smallest last ordering of the vertices of a read-only graph, i.e. the reverse of the
+ * order of the repeated removals of a vertex of the minimum degree.
+ *
+ * @param G The input undirected graph.
+ * @return the ordering of the vertices.
+ */
+template <ReadOnlyGraph Graph>
+std::vector<NetworKit::node> smallestLastOrdering(const Graph &G) {
+    NetworKit::count max_degree = 0;
+    G.forNodes([&](NetworKit::node v) { max_degree = std::max(max_degree, G.degree(v)); });
+    Aux::BucketPQ queue(G.upperNodeIdBound(), 0, max_degree);
+    G.forNodes([&](NetworKit::node v) { queue.insert(G.degree(v), v); });
+    std::vector<NetworKit::node> vertices(queue.size());
+    while (!queue.empty()) {
+        auto v = queue.extractMin().second;
+        vertices[queue.size()] = v;
+        G.forNeighborsOf(v, [&](NetworKit::node u) {
+            if (queue.contains(u)) {
+                queue.changeKey(queue.getKey(u) - 1, u);
+            }
+        });
+    }
+    return vertices;
+}
+
 }  /* namespace Koala */
@@ -36,7 +36,8 @@ class PerfectGraphVertexColoring : public VertexColoring {
  private:
     int omega;
 
-    std::vector<int> get_stable_set_intersecting_all_maximum_cliques();
+    static std::vector<int> get_stable_set_intersecting_all_maximum_cliques(
+        const NetworKit::Graph&);
 
     static int get_theta(const NetworKit::Graph&, const std::vector<int>&);
     static int get_omega(const NetworKit::Graph&);
@@ -8,11 +8,13 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <optional>
 
-#include <networkit/base/Algorithm.hpp>
 #include <networkit/graph/Graph.hpp>
 
+#include <base/Algorithm.hpp>
+
 namespace Koala {
 
 /**
@@ -20,7 +22,7 @@ namespace Koala {
  * The base class for the vertex coloring algorithms.
  *
  */
-class VertexColoring : public NetworKit::Algorithm {
+class VertexColoring : public Algorithm {
  public:
     /**
      * Given an input graph, set up the vertex coloring procedure.
@@ -29,6 +31,13 @@ class VertexColoring : public NetworKit::Algorithm {
      */
     explicit VertexColoring(NetworKit::Graph &graph);
 
+    /**
+     * Given a shared input graph, set up the vertex coloring procedure without copying the graph.
+     *
+     * @param graph The input graph, e.g. obtained from Koala::borrow().
+     */
+    explicit VertexColoring(std::shared_ptr<const NetworKit::Graph> graph);
+
     /**
      * Return the coloring found by the algorithm.
      *
@@ -37,7 +46,7 @@ class VertexColoring : public NetworKit::Algorithm {
     const std::map<NetworKit::node, int>& getColoring() const;
 
  protected:
-    std::optional<NetworKit::Graph> graph;
+    std::shared_ptr<const NetworKit::Graph> graph;
     std::map<NetworKit::node, int> colors;
 };
 
@@ -7,12 +7,14 @@
 
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <set>
 
-#include <networkit/base/Algorithm.hpp>
 #include <networkit/graph/Graph.hpp>
 
+#include <base/Algorithm.hpp>
+
 namespace Koala {
 
 /**
@@ -20,7 +22,7 @@ namespace Koala {
  * The base class for the dominating set algorithms.
  *
  */
-class DominatingSet : public NetworKit::Algorithm {
+class DominatingSet : public Algorithm {
  public:
     /**
      * Given an input graph, set up the vertex coloring procedure.
@@ -29,6 +31,13 @@ class DominatingSet : public NetworKit::Algorithm {
      */
     explicit DominatingSet(NetworKit::Graph &graph);
 
+    /**
+     * Given a shared input graph, set up the dominating set procedure without copying the graph.
+     *
+     * @param graph The input graph, e.g. obtained from Koala::borrow().
+     */
+    explicit DominatingSet(std::shared_ptr<const NetworKit::Graph> graph);
+
     /**
      * Return the dominating set found by the algorithm.
      *
@@ -42,7 +51,7 @@ class DominatingSet : public NetworKit::Algorithm {
     void check() const;
 
  protected:
-    std::optional<NetworKit::Graph> graph;
+    std::shared_ptr<const NetworKit::Graph> graph;
     std::set<NetworKit::node> dominating_set;
 };
 
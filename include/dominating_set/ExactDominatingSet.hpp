@@ -7,9 +7,11 @@
 
 #pragma once
 
+#include <memory_resource>
 #include <set>
 
 #include <dominating_set/DominatingSet.hpp>
+#include <structures/SearchArena.hpp>
 
 namespace Koala {
 
@@ -24,10 +26,13 @@ class BranchAndReduceDominatingSet : public DominatingSet {
     using DominatingSet::DominatingSet;
 
     /**
-     * Execute the exact dominating set procedure via set covering.
+     * Execute the exact dominating set procedure via set covering. The stop token and the deadline
+     * are passed on to the set cover algorithm.
      */
     void run() {
         hasRun = true;
+        interrupted = false;
+        dominating_set.clear();
         std::vector<std::set<NetworKit::node>> family;
         for (const auto &u : graph->nodeRange()) {
             std::set<NetworKit::node> neighborhood(
@@ -37,7 +42,13 @@ class BranchAndReduceDominatingSet : public DominatingSet {
         }
         std::vector<std::set<NetworKit::index>> occurences(family);
         auto set_cover_algorithm = SetCoverAlgorithm(family, occurences);
+        set_cover_algorithm.setStopToken(getStopToken());
+        if (getDeadline()) {
+            set_cover_algorithm.setDeadline(*getDeadline());
+        }
         set_cover_algorithm.run();
+        interrupted = set_cover_algorithm.isInterrupted();
+        optimal = !interrupted;
         auto set_cover = set_cover_algorithm.getSetCover();
         for (int i = 0; i < set_cover.size(); i++) {
             if (set_cover[i]) {
@@ -56,8 +67,17 @@ class ExactDominatingSet : public DominatingSet {
  public:
     using DominatingSet::DominatingSet;
 
+    /**
+     * Set the resource providing the memory for the temporary sets of the search. By default, the
+     * algorithm keeps its own pool on top of the default resource.
+     *
+     * @param resource The upstream memory resource.
+     */
+    void setMemoryResource(std::pmr::memory_resource *resource);
+
  protected:
     std::set<NetworKit::node> free, bound, required;
+    SearchArena arena;
 
     // TODO(kturowski): return solution or empty set
     bool find_small_MODS_recursive(
@@ -0,0 +1,57 @@
+/*
+ * Connectivity.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <networkit/graph/Graph.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup flow
+ * Return the maximum number of edge-disjoint paths from s to t, computed by the unit-capacity
+ * Dinic maximum flow. Parallel edges count separately, edge weights are ignored.
+ *
+ * @param graph The input graph, directed or undirected.
+ * @param s     The source vertex.
+ * @param t     The sink vertex, different from s.
+ */
+NetworKit::count edgeConnectivity(
+    const NetworKit::Graph &graph, NetworKit::node s, NetworKit::node t);
+
+/**
+ * @ingroup flow
+ * Return the edge connectivity of the graph, i.e. the minimum number of edges whose removal makes
+ * the graph disconnected (not strongly connected for directed graphs), using n - 1 (or 2n - 2)
+ * unit-capacity flow computations from a fixed vertex.
+ *
+ * @param graph The input graph with at least two vertices.
+ */
+NetworKit::count edgeConnectivity(const NetworKit::Graph &graph);
+
+/**
+ * @ingroup flow
+ * Return the maximum number of internally vertex-disjoint paths from s to t, computed by the
+ * unit-capacity Dinic maximum flow on the split graph.
+ *
+ * @param graph The input undirected graph.
+ * @param s     The source vertex.
+ * @param t     The sink vertex, different from s and not adjacent to s.
+ */
+NetworKit::count vertexConnectivity(
+    const NetworKit::Graph &graph, NetworKit::node s, NetworKit::node t);
+
+/**
+ * @ingroup flow
+ * Return the vertex connectivity of the graph, i.e. the minimum number of vertices whose removal
+ * makes the graph disconnected or trivial, with the algorithm from Even, An Algorithm for
+ * Determining Whether the Connectivity of a Graph is at Least k.
+ *
+ * @param graph The input undirected graph.
+ */
+NetworKit::count vertexConnectivity(const NetworKit::Graph &graph);
+
+}  /* namespace Koala */
@@ -0,0 +1,129 @@
+/*
+ * DinicMaximumFlow.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+#include <base/Algorithm.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup flow
+ * The capacity tag for the networks in which every edge has capacity 1, regardless of its weight
+ * (the edges with zero weight in weighted graphs are skipped).
+ */
+struct UnitCapacity { };
+
+/**
+ * @ingroup flow
+ * The class for the Dinic maximum flow algorithm, specialized at compile time on the capacity
+ * type: UnitCapacity, int32_t or int64_t. The network is stored as a CSR array of arcs, each paired
+ * with its reverse. Every undirected edge yields two arcs with the capacity given by its weight.
+ * For UnitCapacity the residual capacities are packed into bits, and the algorithm is the one of
+ * Even, Tarjan, Network Flow and Testing Graph Connectivity, running in O(m sqrt(m)) time and in
+ * O(m sqrt(n)) time for the unit networks (e.g. bipartite matching or vertex-disjoint paths).
+ * For int32_t and int64_t the weights have to be integers representable in the capacity type, and
+ * the total capacity of the arcs leaving the source has to be representable as well, so that the
+ * flow size cannot overflow. The network is built on the first run and reused by the later ones,
+ * e.g. after setTerminals().
+ */
+template <class Capacity>
+class DinicMaximumFlow final : public Algorithm {
+    static_assert(
+        std::is_same_v<Capacity, UnitCapacity> || std::is_same_v<Capacity, int32_t>
+            || std::is_same_v<Capacity, int64_t>,
+        "DinicMaximumFlow supports UnitCapacity, int32_t and int64_t capacities");
+
+ public:
+    static constexpr bool UNIT = std::is_same_v<Capacity, UnitCapacity>;
+    using flow_type = std::conditional_t<UNIT, int64_t, Capacity>;
+
+    /**
+     * Given an input graph, set up the Dinic maximum flow procedure.
+     *
+     * @param graph The input graph, with the edge weights used as capacities.
+     * @param s     The source vertex.
+     * @param t     The sink vertex.
+     */
+    DinicMaximumFlow(const NetworKit::Graph &graph, NetworKit::node s, NetworKit::node t);
+
+    /**
+     * Given a shared input graph, set up the Dinic maximum flow procedure without copying the
+     * graph.
+     *
+     * @param graph The input graph, e.g. obtained from Koala::borrow().
+     * @param s     The source vertex.
+     * @param t     The sink vertex.
+     */
+    DinicMaximumFlow(
+        std::shared_ptr<const NetworKit::Graph> graph, NetworKit::node s, NetworKit::node t);
+
+    /**
+     * Change the source and the sink for the next run, which reuses the network built before.
+     *
+     * @param s The source vertex.
+     * @param t The sink vertex.
+     */
+    void setTerminals(NetworKit::node s, NetworKit::node t);
+
+    /**
+     * Execute the Dinic maximum flow algorithm.
+     *
+     * @throws std::invalid_argument if a weight is not a valid capacity or the total capacity of
+     * the arcs leaving the source overflows the capacity type.
+     */
+    void run();
+
+    /**
+     * Return the flow size found by the algorithm.
+     *
+     * @return a total flow value.
+     */
+    flow_type getFlowSize() const;
+
+    /**
+     * Return the source side of the minimum cut, i.e. the vertices reachable from the source in the
+     * final residual network.
+     *
+     * @return a vector indexed by nodes, true for the nodes on the source side.
+     */
+    const std::vector<bool>& getSourceSide() const;
+
+    /**
+     * Verify the result found by the algorithm.
+     */
+    void check() const;
+
+ private:
+    std::shared_ptr<const NetworKit::Graph> graph;
+    NetworKit::node source, target;
+    flow_type flow_size;
+    std::vector<bool> source_side;
+
+    std::vector<NetworKit::index> first, current;
+    std::vector<NetworKit::node> head;
+    std::vector<NetworKit::index> reverse;
+    std::conditional_t<UNIT, std::vector<uint64_t>, std::vector<Capacity>> capacity, residual;
+    std::vector<NetworKit::count> level;
+
+    void build();
+    void initialize();
+    flow_type get_capacity(NetworKit::index) const;
+    bool has_residual(NetworKit::index) const;
+    flow_type get_residual(NetworKit::index) const;
+    void push(NetworKit::index, flow_type);
+    bool find_levels();
+    flow_type find_blocking_flow();
+};
+
+}  /* namespace Koala */
@@ -0,0 +1,160 @@
+/*
+ * GlobalMinimumCut.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+#include <base/Algorithm.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup flow
+ * The base class for the global minimum cut algorithms on undirected graphs with nonnegative
+ * edge weights (unweighted graphs are treated as having all weights equal to 1).
+ *
+ */
+class GlobalMinimumCut : public Algorithm {
+ public:
+    /**
+     * Given an input graph, set up the global minimum cut procedure.
+     *
+     * @param graph The input undirected graph with at least two vertices.
+     */
+    explicit GlobalMinimumCut(const NetworKit::Graph &graph);
+
+    /**
+     * Given a shared input graph, set up the global minimum cut procedure without copying the
+     * graph.
+     *
+     * @param graph The input undirected graph, e.g. obtained from Koala::borrow().
+     */
+    explicit GlobalMinimumCut(std::shared_ptr<const NetworKit::Graph> graph);
+
+    /**
+     * Return the weight of the minimum cut found by the algorithm.
+     *
+     * @return the total weight of the edges crossing the cut.
+     */
+    NetworKit::edgeweight getCutSize() const;
+
+    /**
+     * Return the cut found by the algorithm.
+     *
+     * @return a vector indexed by nodes, true for the nodes on one side of the cut.
+     */
+    const std::vector<bool>& getCut() const;
+
+    /**
+     * Verify the result found by the algorithm.
+     */
+    void check() const;
+
+ protected:
+    using Edges = std::vector<NetworKit::WeightedEdge>;
+
+    /**
+     * Relabel the nodes to 0, ..., n - 1 and collect the edges with the new labels, skipping
+     * self-loops. If the graph is disconnected, set the empty cut around a connected component.
+     *
+     * @return the edges, or std::nullopt if the graph is disconnected.
+     */
+    std::optional<Edges> initialize();
+
+    /**
+     * Set the cut, given the side of every relabeled node.
+     */
+    void set_cut(NetworKit::edgeweight size, const std::vector<bool> &side);
+
+    std::shared_ptr<const NetworKit::Graph> graph;
+    std::vector<NetworKit::node> nodes;
+    NetworKit::edgeweight cut_size;
+    std::vector<bool> cut;
+};
+
+/**
+ * @ingroup flow
+ * The class for the Stoer-Wagner global minimum cut algorithm from Stoer, Wagner, A Simple Min-Cut
+ * Algorithm, using the maximum adjacency orderings maintained on the pairing heap.
+ */
+class StoerWagnerGlobalMinimumCut final : public GlobalMinimumCut {
+ public:
+    using GlobalMinimumCut::GlobalMinimumCut;
+
+    /**
+     * Execute the Stoer-Wagner global minimum cut algorithm.
+     */
+    void run();
+};
+
+/**
+ * @ingroup flow
+ * The class for the Nagamochi-Ibaraki global minimum cut algorithm from Nagamochi, Ibaraki,
+ * Computing Edge-Connectivity in Multigraphs and Capacitated Graphs. Every maximum adjacency
+ * ordering yields a sparse certificate, so that all edges certified to be at least as strongly
+ * connected as the best cut so far are contracted at once.
+ */
+class NagamochiIbarakiGlobalMinimumCut final : public GlobalMinimumCut {
+ public:
+    using GlobalMinimumCut::GlobalMinimumCut;
+
+    /**
+     * Execute the Nagamochi-Ibaraki global minimum cut algorithm.
+     */
+    void run();
+};
+
+/**
+ * @ingroup flow
+ * The class for the randomized recursive contraction algorithm from Karger, Stein, A New Approach
+ * to the Minimum Cut Problem. Contractions are performed on flat edge arrays, by contracting the
+ * edges in the order of exponentially distributed keys with rates equal to their weights, and
+ * the independent trials run in parallel. The result is correct with high probability, thus it
+ * is never reported as proven optimal. The stop request is checked before every trial except the
+ * first, and an interrupted run reports the best cut among the finished trials.
+ */
+class KargerSteinGlobalMinimumCut final : public GlobalMinimumCut {
+ public:
+    /**
+     * Given an input graph, set up the Karger-Stein global minimum cut procedure.
+     *
+     * @param graph The input undirected graph with at least two vertices.
+     * @param trials The number of independent trials, with 0 yielding ceil(log2 n)^2 trials.
+     * @param seed The random seed.
+     */
+    explicit KargerSteinGlobalMinimumCut(
+        const NetworKit::Graph &graph, NetworKit::count trials = 0, uint64_t seed = 0);
+
+    /**
+     * Given a shared input graph, set up the Karger-Stein global minimum cut procedure without
+     * copying the graph.
+     *
+     * @param graph The input undirected graph, e.g. obtained from Koala::borrow().
+     * @param trials The number of independent trials, with 0 yielding ceil(log2 n)^2 trials.
+     * @param seed The random seed.
+     */
+    explicit KargerSteinGlobalMinimumCut(
+        std::shared_ptr<const NetworKit::Graph> graph, NetworKit::count trials = 0,
+        uint64_t seed = 0);
+
+    /**
+     * Execute the Karger-Stein global minimum cut algorithm.
+     */
+    void run();
+
+ private:
+    NetworKit::count trials;
+    uint64_t seed;
+};
+
+}  /* namespace Koala */
@@ -0,0 +1,209 @@
+/*
+ * GridMaximumFlow.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+#include <base/Algorithm.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup flow
+ * The flow network on a width x height x depth grid of cells, with the arcs between the cells
+ * adjacent along an axis and the arcs from the source and to the sink, as in the image segmentation
+ * problems. The neighbors are implicit and the capacities are stored in per-direction arrays.
+ *
+ * As in the flow network generators, the nodes are numbered with the source 0, the sink 1 and the
+ * cell (x, y, z) at 2 + (z * height + y) * width + x.
+ */
+class GridNetwork {
+ public:
+    /** The directions +x, -x, +y, -y, +z, -z, so that d ^ 1 is the opposite direction of d. */
+    static constexpr int DIRECTIONS = 6;
+
+    /**
+     * Set up a grid network with all capacities equal to 0.
+     *
+     * @param width  The size of the grid along the x axis.
+     * @param height The size of the grid along the y axis.
+     * @param depth  The size of the grid along the z axis.
+     */
+    GridNetwork(NetworKit::count width, NetworKit::count height, NetworKit::count depth = 1);
+
+    NetworKit::count getWidth() const;
+    NetworKit::count getHeight() const;
+    NetworKit::count getDepth() const;
+    NetworKit::count numberOfCells() const;
+
+    /**
+     * Return the index of the cell, in 0, ..., numberOfCells() - 1.
+     */
+    NetworKit::index getCell(NetworKit::index x, NetworKit::index y, NetworKit::index z = 0) const;
+
+    /**
+     * Return the neighbor of the cell in the given direction, or NetworKit::none at the boundary.
+     */
+    NetworKit::index getNeighbor(NetworKit::index cell, int direction) const;
+
+    /**
+     * Increase the capacity of the arc between the nodes, numbered as in the class description.
+     * Only the arcs from the source, to the sink and between adjacent cells are allowed.
+     */
+    void addArc(NetworKit::node u, NetworKit::node v, int64_t capacity);
+
+    int64_t getSourceCapacity(NetworKit::index cell) const;
+    int64_t getSinkCapacity(NetworKit::index cell) const;
+    int64_t getCapacity(NetworKit::index cell, int direction) const;
+
+    /**
+     * Return the cut capacity, given the source side of the cut.
+     *
+     * @param side A vector indexed by cells, true for the cells on the source side.
+     */
+    int64_t getCutCapacity(const std::vector<bool> &side) const;
+
+    /**
+     * Build the network as a graph, with the reverse arcs of zero capacity, like the DIMACS reader.
+     */
+    NetworKit::Graph toGraph() const;
+
+ private:
+    friend class GridMaximumFlow;
+
+    NetworKit::count width, height, depth;
+    std::array<int64_t, DIRECTIONS> offset;
+    std::vector<uint8_t> neighbors;
+    std::array<std::vector<int64_t>, DIRECTIONS> capacity;
+    std::vector<int64_t> source_capacity, sink_capacity;
+};
+
+/**
+ * @ingroup flow
+ * The base class for the maximum flow algorithms on grid networks.
+ */
+class GridMaximumFlow : public Algorithm {
+ public:
+    /**
+     * Given a grid network, set up the maximum flow procedure. The network is not copied, so it
+     * has to outlive the algorithm, and the temporary networks are rejected.
+     *
+     * @param network The input grid network.
+     */
+    explicit GridMaximumFlow(const GridNetwork &network);
+    explicit GridMaximumFlow(GridNetwork &&network) = delete;
+
+    /**
+     * Return the flow size found by the algorithm.
+     *
+     * @return a total flow value.
+     */
+    int64_t getFlowSize() const;
+
+    /**
+     * Return the source side of the minimum cut found by the algorithm.
+     *
+     * @return a vector indexed by cells, true for the cells on the source side.
+     */
+    const std::vector<bool>& getSourceSide() const;
+
+    /**
+     * Verify the result found by the algorithm.
+     */
+    void check() const;
+
+ protected:
+    const GridNetwork &network;
+    std::array<std::vector<int64_t>, GridNetwork::DIRECTIONS> residual;
+    std::vector<int64_t> source_residual, sink_residual;
+    int64_t flow_size;
+    std::vector<bool> source_side;
+
+    NetworKit::index neighbor(NetworKit::index v, int d) const {
+        return (network.neighbors[v] >> d) & 1 ? v + network.offset[d] : NetworKit::none;
+    }
+
+    void push(NetworKit::index v, int d, int64_t delta) {
+        residual[d][v] -= delta, residual[d ^ 1][v + network.offset[d]] += delta;
+    }
+
+    // Reset the residual capacities to the capacities of the network, before every run.
+    void initialize();
+};
+
+/**
+ * @ingroup flow
+ * The class for the Boykov-Kolmogorov maximum flow algorithm from Boykov, Kolmogorov, An
+ * Experimental Comparison of Min-Cut/Max-Flow Algorithms for Energy Minimization in Vision, growing
+ * the search trees from both terminals and reusing them after every augmentation.
+ */
+class BoykovKolmogorovGridMaximumFlow final : public GridMaximumFlow {
+ public:
+    using GridMaximumFlow::GridMaximumFlow;
+
+    /**
+     * Execute the Boykov-Kolmogorov maximum flow algorithm.
+     */
+    void run();
+
+ private:
+    enum Tree : uint8_t { FREE, SOURCE_TREE, SINK_TREE };
+    static constexpr int8_t TERMINAL = GridNetwork::DIRECTIONS, ORPHAN = TERMINAL + 1;
+
+    std::vector<uint8_t> tree;
+    std::vector<int8_t> parent;
+    std::vector<NetworKit::count> timestamp, distance;
+    std::vector<NetworKit::index> active, orphans;
+    std::vector<bool> is_active;
+    NetworKit::index active_head;
+    NetworKit::count time;
+
+    void activate(NetworKit::index);
+    bool grow(NetworKit::index&, int&);
+    void augment(NetworKit::index, int);
+    void adopt(NetworKit::index);
+};
+
+/**
+ * @ingroup flow
+ * The class for the block-parallel push-relabel maximum flow algorithm on grid networks. The grid
+ * is split into blocks colored like a checkerboard, and the blocks of the same color, which share
+ * no arcs, are discharged in parallel, with global relabeling between the rounds.
+ */
+class PushRelabelGridMaximumFlow final : public GridMaximumFlow {
+ public:
+    /**
+     * Given a grid network, set up the block-parallel push-relabel procedure. The network is not
+     * copied, so it has to outlive the algorithm.
+     *
+     * @param network    The input grid network.
+     * @param block_size The size of a block along every axis.
+     */
+    explicit PushRelabelGridMaximumFlow(
+        const GridNetwork &network, NetworKit::count block_size = 32);
+    explicit PushRelabelGridMaximumFlow(
+        GridNetwork &&network, NetworKit::count block_size = 32) = delete;
+
+    /**
+     * Execute the block-parallel push-relabel maximum flow algorithm.
+     */
+    void run();
+
+ private:
+    NetworKit::count block_size, limit;
+    std::vector<int64_t> excess;
+    std::vector<NetworKit::count> label;
+
+    NetworKit::count global_relabel();
+    int64_t discharge_block(NetworKit::index, NetworKit::index, NetworKit::index);
+};
+
+}  /* namespace Koala */
@@ -8,13 +8,14 @@
 
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <map>
 #include <set>
 
-#include <networkit/base/Algorithm.hpp>
 #include <networkit/graph/Graph.hpp>
 
+#include <base/Algorithm.hpp>
 #include <flow/maximum_flow/DynamicTree.hpp>
 #include <flow/maximum_flow/KrtEdgeDesignator.hpp>
 
@@ -25,7 +26,7 @@ namespace Koala {
  * The base class for the max flow algorithms.
  *
  */
-class MaximumFlow : public NetworKit::Algorithm {
+class MaximumFlow : public Algorithm {
  public:
     /**
      * Given an input graph, set up the greedy vertex coloring procedure.
@@ -36,6 +37,16 @@ class MaximumFlow : public NetworKit::Algorithm {
      */
     MaximumFlow(NetworKit::Graph &graph, NetworKit::node s, NetworKit::node t);
 
+    /**
+     * Given a shared input graph, set up the maximum flow procedure without copying the graph.
+     *
+     * @param graph The input graph, e.g. obtained from Koala::borrow().
+     * @param s The source vertex.
+     * @param t The sink vertex.
+     */
+    MaximumFlow(
+        std::shared_ptr<const NetworKit::Graph> graph, NetworKit::node s, NetworKit::node t);
+
     /**
      * Return the flow size found by the algorithm.
      *
@@ -43,8 +54,20 @@ class MaximumFlow : public NetworKit::Algorithm {
      */
     int getFlowSize() const;
 
+    /**
+     * Return the flow found by the algorithm.
+     *
+     * @return a map from the arcs to the flow values, antisymmetric for the opposite arcs.
+     */
+    const std::map<std::pair<NetworKit::node, NetworKit::node>, int>& getFlow() const;
+
+    /**
+     * Verify the result found by the algorithm with MaximumFlowVerifier.
+     */
+    void check() const;
+
  protected:
-    std::optional<NetworKit::Graph> graph;
+    std::shared_ptr<const NetworKit::Graph> graph;
     NetworKit::node source, target;
     std::map<std::pair<NetworKit::node, NetworKit::node>, int> flow;
     int flow_size;
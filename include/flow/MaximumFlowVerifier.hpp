@@ -0,0 +1,90 @@
+/*
+ * MaximumFlowVerifier.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+#include <base/Algorithm.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup flow
+ * The certificate of a maximum flow: the results of the feasibility checks and the minimum cut
+ * given by the vertices reachable from the source in the residual network.
+ */
+struct MaximumFlowCertificate {
+    NetworKit::count capacity_violations = 0;
+    NetworKit::count conservation_violations = 0;
+    NetworKit::edgeweight flow_value = 0;
+    NetworKit::edgeweight cut_capacity = 0;
+    bool target_reachable = false;
+    bool cut_equals_flow = false;
+    std::vector<bool> source_side;
+
+    /**
+     * Return whether the flow satisfies the capacity constraints and the flow conservation.
+     */
+    bool isFeasible() const {
+        return capacity_violations == 0 && conservation_violations == 0;
+    }
+
+    /**
+     * Return whether the flow is feasible and the residual cut proves it maximum.
+     */
+    bool isMaximum() const {
+        return isFeasible() && !target_reachable && cut_equals_flow;
+    }
+};
+
+/**
+ * @ingroup flow
+ * The class for the verification of a flow computed by any algorithm or external solver. The
+ * network is stored as a CSR array of arcs with reverse arcs, on which the capacity constraints, the
+ * flow conservation and the capacity of the residual cut are checked in parallel, in O(m log m)
+ * time.
+ */
+class MaximumFlowVerifier : public Algorithm {
+ public:
+    /**
+     * Given a network and a flow, set up the verification. The graph is not referenced afterwards.
+     *
+     * @param graph     The input graph, with the edge weights used as capacities. Every undirected
+     *                  edge is treated as a pair of opposite arcs.
+     * @param s         The source vertex.
+     * @param t         The sink vertex.
+     * @param flow      The nonnegative flow values on the arcs, repeated arcs are summed up.
+     * @param tolerance The absolute tolerance of the numerical comparisons.
+     */
+    MaximumFlowVerifier(
+        const NetworKit::Graph &graph, NetworKit::node s, NetworKit::node t,
+        const std::vector<NetworKit::WeightedEdge> &flow, NetworKit::edgeweight tolerance = 1e-9);
+
+    /**
+     * Execute the verification.
+     */
+    void run();
+
+    /**
+     * Return the certificate computed by the verification.
+     */
+    const MaximumFlowCertificate& getCertificate() const;
+
+ private:
+    NetworKit::node source, target;
+    NetworKit::edgeweight tolerance;
+    std::vector<NetworKit::index> first;
+    std::vector<NetworKit::node> head;
+    std::vector<NetworKit::index> reverse;
+    std::vector<NetworKit::edgeweight> capacity, flow;
+    NetworKit::count unmatched;
+    MaximumFlowCertificate certificate;
+};
+
+}  /* namespace Koala */
@@ -0,0 +1,189 @@
+/*
+ * PreprocessedMaximumFlow.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+#include <base/Algorithm.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup flow
+ * The class for the reduction of a maximum flow network to an equivalent smaller one. Until no
+ * further change is possible, it repeatedly
+ * - removes the vertices not reachable from the source or not reaching the sink (including the
+ *   arcs entering the source or leaving the sink),
+ * - removes the strongly connected components attached to the rest of the network by a single
+ *   vertex, as they can only carry circulations,
+ * - merges the parallel arcs and contracts the vertices with a single incoming and a single
+ *   outgoing arc.
+ * The maximum flow value is preserved, and a minimum cut of the reduced network can be mapped back
+ * to a minimum cut of the input one.
+ */
+class MaximumFlowPreprocessing : public Algorithm {
+ public:
+    /**
+     * Given an input network, set up the preprocessing.
+     *
+     * @param graph The input graph, with the edge weights used as capacities. Every undirected edge
+     *              is treated as a pair of opposite arcs.
+     * @param s     The source vertex.
+     * @param t     The sink vertex.
+     */
+    MaximumFlowPreprocessing(const NetworKit::Graph &graph, NetworKit::node s, NetworKit::node t);
+
+    /**
+     * Execute the preprocessing.
+     */
+    void run();
+
+    /**
+     * Return the reduced network, a directed weighted graph on vertices 0, ..., k - 1, in which
+     * every arc is accompanied by the reverse one, possibly with zero capacity.
+     */
+    const NetworKit::Graph& getReducedGraph() const;
+
+    /**
+     * Return the source vertex in the reduced network.
+     */
+    NetworKit::node getReducedSource() const;
+
+    /**
+     * Return the sink vertex in the reduced network.
+     */
+    NetworKit::node getReducedTarget() const;
+
+    /**
+     * Map the source side of a minimum cut in the reduced network back to the input network.
+     *
+     * @param side A vector indexed by the vertices of the reduced network.
+     * @return a vector indexed by the nodes of the input graph, true for the source side.
+     */
+    std::vector<bool> expandSourceSide(const std::vector<bool> &side) const;
+
+ private:
+    struct Reduction {
+        enum class Type { REMOVED, SAME_SIDE, SERIES };
+        Type type;
+        NetworKit::node v, u, w;
+        NetworKit::edgeweight in, out;
+        bool side;
+    };
+
+    std::optional<NetworKit::Graph> graph;
+    NetworKit::node source, target;
+    std::optional<NetworKit::Graph> reduced;
+    std::vector<NetworKit::node> label;
+
+    std::vector<NetworKit::node> tail, head;
+    std::vector<NetworKit::edgeweight> capacity;
+    std::vector<bool> arc_alive, node_alive;
+    std::vector<std::vector<NetworKit::index>> in_arcs, out_arcs;
+    std::vector<Reduction> reductions;
+
+    void add_arc(NetworKit::node, NetworKit::node, NetworKit::edgeweight);
+    void remove_node(NetworKit::node);
+    void compact();
+    bool prune_unreachable();
+    bool prune_strongly_connected_components();
+    bool merge_parallel_arcs();
+    bool contract_series_arcs();
+};
+
+/**
+ * @ingroup flow
+ * The class running any maximum flow engine (e.g. KingRaoTarjanMaximumFlow or DinicMaximumFlow) on
+ * the network reduced by MaximumFlowPreprocessing.
+ */
+template <class Engine>
+class PreprocessedMaximumFlow final : public Algorithm {
+ public:
+    using flow_type = std::remove_cvref_t<decltype(std::declval<const Engine&>().getFlowSize())>;
+
+    /**
+     * Given an input network, set up the preprocessed maximum flow procedure.
+     *
+     * @param graph The input graph, with the edge weights used as capacities.
+     * @param s     The source vertex.
+     * @param t     The sink vertex.
+     */
+    PreprocessedMaximumFlow(const NetworKit::Graph &graph, NetworKit::node s, NetworKit::node t)
+        : preprocessing(graph, s, t), flow_size(0) { }
+
+    /**
+     * Execute the preprocessing and then the maximum flow engine on the reduced network. The stop
+     * token and the deadline are passed on to the engine.
+     */
+    void run() {
+        interrupted = false;
+        preprocessing.run();
+        NetworKit::Graph G(preprocessing.getReducedGraph());
+        NetworKit::node s = preprocessing.getReducedSource(), t = preprocessing.getReducedTarget();
+        std::vector<bool> reduced_side(G.upperNodeIdBound(), true);
+        if (G.totalEdgeWeight() == 0) {
+            flow_size = 0, reduced_side[t] = false;
+            optimal = true;
+        } else {
+            Engine engine(G, s, t);
+            engine.setStopToken(getStopToken());
+            if (getDeadline()) {
+                engine.setDeadline(*getDeadline());
+            }
+            engine.run();
+            flow_size = engine.getFlowSize();
+            if constexpr (requires { engine.getSourceSide(); }) {
+                reduced_side = engine.getSourceSide();
+            }
+            optimal = engine.isOptimal();
+            interrupted = engine.isInterrupted();
+        }
+        source_side = preprocessing.expandSourceSide(reduced_side);
+        hasRun = true;
+    }
+
+    /**
+     * Return the flow size found by the algorithm.
+     *
+     * @return a total flow value.
+     */
+    flow_type getFlowSize() const {
+        assureFinished();
+        return flow_size;
+    }
+
+    /**
+     * Return the source side of the minimum cut, meaningful only for the engines providing
+     * getSourceSide() themselves.
+     *
+     * @return a vector indexed by nodes, true for the nodes on the source side.
+     */
+    const std::vector<bool>& getSourceSide() const {
+        assureFinished();
+        return source_side;
+    }
+
+    /**
+     * Return the preprocessing, e.g. to inspect the reduced network.
+     */
+    const MaximumFlowPreprocessing& getPreprocessing() const {
+        assureFinished();
+        return preprocessing;
+    }
+
+ private:
+    MaximumFlowPreprocessing preprocessing;
+    flow_type flow_size;
+    std::vector<bool> source_side;
+};
+
+}  /* namespace Koala */
@@ -50,7 +50,7 @@ class KRTEdgeDesignator {
     long double reset();
 
  public:
-    void initialize(const std::optional<NetworKit::Graph>&);
+    void initialize(const NetworKit::Graph&);
     NetworKit::node current_edge(NetworKit::node, int);
     void response_adversary(NetworKit::node, int);
     void response_adversary(NetworKit::node, int, NetworKit::node, int);
@@ -0,0 +1,349 @@
+/*
+ * GraphGenerator.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup generator
+ * The base class for the synthetic graph generators.
+ *
+ * The edges are produced in parallel in fixed-size chunks, each chunk with its own random stream
+ * derived from the seed, and handed over in the chunk order. Hence, the generated graph depends
+ * only on the parameters and the seed, not on the number of threads, and the edges can be
+ * streamed repeatedly (e.g. once to count them and once to write them) without storing the graph.
+ *
+ */
+class GraphGenerator {
+ public:
+    using EdgeCallback =
+        std::function<void(NetworKit::node, NetworKit::node, NetworKit::edgeweight)>;
+
+    /**
+     * Set up the generator.
+     *
+     * @param seed The seed of all random choices made by the generator.
+     */
+    explicit GraphGenerator(uint64_t seed);
+
+    virtual ~GraphGenerator() = default;
+
+    /**
+     * Return the number of nodes of the generated graph.
+     *
+     * @return the number of nodes.
+     */
+    virtual NetworKit::count numberOfNodes() const = 0;
+
+    /**
+     * Return whether the generated graph has edge weights (or arc capacities).
+     *
+     * @return true if the graph is weighted.
+     */
+    virtual bool isWeighted() const;
+
+    /**
+     * Return whether the generated graph is directed.
+     *
+     * @return true if the graph is directed.
+     */
+    virtual bool isDirected() const;
+
+    /**
+     * Stream all edges of the generated graph, in a deterministic order.
+     *
+     * @param callback The function called with the endpoints and the weight of every edge.
+     */
+    virtual void forEdges(const EdgeCallback &callback) const = 0;
+
+    /**
+     * Count the edges of the generated graph by streaming them.
+     *
+     * @return the number of edges.
+     */
+    NetworKit::count numberOfEdges() const;
+
+    /**
+     * Build the generated graph in memory. Directed weighted graphs are built as flow networks,
+     * i.e. with a reverse arc of zero capacity for every arc, like the DIMACS reader does.
+     *
+     * @return the generated graph.
+     */
+    virtual NetworKit::Graph generate() const;
+
+ protected:
+    using ChunkGenerator = std::function<void(
+        NetworKit::index, NetworKit::index, NetworKit::index,
+        std::vector<NetworKit::WeightedEdge>&)>;
+
+    static constexpr NetworKit::count CHUNK_SIZE = 1 << 12;
+
+    void forChunks(
+        NetworKit::count items, const ChunkGenerator &generator,
+        const EdgeCallback &callback) const;
+
+    uint64_t hash(uint64_t stream, uint64_t counter) const;
+    double uniform(uint64_t stream, uint64_t counter) const;
+
+    uint64_t seed;
+};
+
+/**
+ * @ingroup generator
+ * The base class for the generators of maximum flow networks.
+ *
+ */
+class FlowNetworkGenerator : public GraphGenerator {
+ public:
+    using GraphGenerator::GraphGenerator;
+
+    bool isWeighted() const override;
+    bool isDirected() const override;
+
+    /**
+     * Return the source of the generated network.
+     *
+     * @return the source node.
+     */
+    virtual NetworKit::node getSource() const = 0;
+
+    /**
+     * Return the target of the generated network.
+     *
+     * @return the target node.
+     */
+    virtual NetworKit::node getTarget() const = 0;
+};
+
+/**
+ * @ingroup generator
+ * The class for the Erdos-Renyi G(n, p) generator, using geometric skipping over the
+ * non-edges from Batagelj, Brandes, Efficient generation of large random networks.
+ */
+class ErdosRenyiGenerator final : public GraphGenerator {
+ public:
+    /**
+     * Set up the G(n, p) generator.
+     *
+     * @param n The number of nodes.
+     * @param p The probability of every edge.
+     * @param directed Whether the graph is directed.
+     * @param seed The random seed.
+     */
+    ErdosRenyiGenerator(NetworKit::count n, double p, bool directed = false, uint64_t seed = 0);
+
+    NetworKit::count numberOfNodes() const override;
+    bool isDirected() const override;
+    void forEdges(const EdgeCallback &callback) const override;
+
+ private:
+    NetworKit::count n;
+    double p;
+    bool directed;
+};
+
+/**
+ * @ingroup generator
+ * The class for the R-MAT (recursive Kronecker) generator from Chakrabarti, Zhan, Faloutsos,
+ * R-MAT: A Recursive Model for Graph Mining. Self-loops are skipped, parallel edges are streamed
+ * as they are drawn and merged only by generate().
+ */
+class RmatGenerator final : public GraphGenerator {
+ public:
+    /**
+     * Set up the R-MAT generator.
+     *
+     * @param scale The logarithm of the number of nodes.
+     * @param edge_factor The number of drawn edges per node.
+     * @param a,b,c The probabilities of the top-left, top-right and bottom-left quadrants.
+     * @param seed The random seed.
+     */
+    RmatGenerator(
+        NetworKit::count scale, NetworKit::count edge_factor, double a = 0.57, double b = 0.19,
+        double c = 0.19, uint64_t seed = 0);
+
+    NetworKit::count numberOfNodes() const override;
+    void forEdges(const EdgeCallback &callback) const override;
+    NetworKit::Graph generate() const override;
+
+ private:
+    NetworKit::count scale, edge_factor;
+    double a, b, c;
+};
+
+/**
+ * @ingroup generator
+ * The class for the random geometric graph generator: n points uniform in the unit square,
+ * connected whenever they are at most the given radius apart. Edges are weighted by distances.
+ */
+class RandomGeometricGenerator final : public GraphGenerator {
+ public:
+    /**
+     * Set up the random geometric graph generator.
+     *
+     * @param n The number of nodes.
+     * @param radius The connection radius.
+     * @param seed The random seed.
+     */
+    RandomGeometricGenerator(NetworKit::count n, double radius, uint64_t seed = 0);
+
+    NetworKit::count numberOfNodes() const override;
+    bool isWeighted() const override;
+    void forEdges(const EdgeCallback &callback) const override;
+
+ private:
+    NetworKit::count n;
+    double radius;
+};
+
+/**
+ * @ingroup generator
+ * The class for the grid and road-like graph generator: a rows x columns grid, in which every edge
+ * is kept with the given probability and gets an integer weight uniform in [1, max_weight].
+ */
+class GridGenerator final : public GraphGenerator {
+ public:
+    /**
+     * Set up the grid generator.
+     *
+     * @param rows The number of rows.
+     * @param columns The number of columns.
+     * @param keep_probability The probability of keeping every grid edge.
+     * @param max_weight The maximum edge weight, positive, with 1 yielding an unweighted graph.
+     * @param seed The random seed.
+     */
+    GridGenerator(
+        NetworKit::count rows, NetworKit::count columns, double keep_probability = 1.0,
+        NetworKit::count max_weight = 1, uint64_t seed = 0);
+
+    NetworKit::count numberOfNodes() const override;
+    bool isWeighted() const override;
+    void forEdges(const EdgeCallback &callback) const override;
+
+ private:
+    NetworKit::count rows, columns;
+    double keep_probability;
+    NetworKit::count max_weight;
+};
+
+/**
+ * @ingroup generator
+ * The class for the random perfect graph generator, producing the interval graph of n intervals
+ * with left ends uniform in [0, 1] and lengths uniform in [0, max_length].
+ */
+class RandomIntervalGenerator final : public GraphGenerator {
+ public:
+    /**
+     * Set up the random interval graph generator.
+     *
+     * @param n The number of nodes.
+     * @param max_length The maximum length of an interval.
+     * @param seed The random seed.
+     */
+    RandomIntervalGenerator(NetworKit::count n, double max_length, uint64_t seed = 0);
+
+    NetworKit::count numberOfNodes() const override;
+    void forEdges(const EdgeCallback &callback) const override;
+
+ private:
+    NetworKit::count n;
+    double max_length;
+};
+
+/**
+ * @ingroup generator
+ * The class for the hard maximum flow networks in the spirit of AK generator from Cherkassky,
+ * Goldberg, On Implementing Push-Relabel Method for the Maximum Flow Problem. The network
+ * consists of two parts of k nodes each: a path leaking one unit to the target at every node and
+ * a ladder whose every unit of flow has to traverse a shared path of length k.
+ */
+class AKFlowNetworkGenerator final : public FlowNetworkGenerator {
+ public:
+    /**
+     * Set up the AK network generator.
+     *
+     * @param k The size of both parts of the network.
+     */
+    explicit AKFlowNetworkGenerator(NetworKit::count k);
+
+    NetworKit::count numberOfNodes() const override;
+    NetworKit::node getSource() const override;
+    NetworKit::node getTarget() const override;
+    void forEdges(const EdgeCallback &callback) const override;
+
+ private:
+    NetworKit::count k;
+};
+
+/**
+ * @ingroup generator
+ * The class for the Washington random level graph (RLG) flow networks: a rows x columns grid of
+ * nodes, each connected to three random nodes of the next column with capacities uniform in
+ * [1, max_capacity]. The source feeds the first column and the last column drains to the target.
+ */
+class WashingtonFlowNetworkGenerator final : public FlowNetworkGenerator {
+ public:
+    /**
+     * Set up the random level graph generator.
+     *
+     * @param rows The number of rows.
+     * @param columns The number of columns.
+     * @param max_capacity The maximum arc capacity, positive.
+     * @param seed The random seed.
+     */
+    WashingtonFlowNetworkGenerator(
+        NetworKit::count rows, NetworKit::count columns, NetworKit::count max_capacity,
+        uint64_t seed = 0);
+
+    NetworKit::count numberOfNodes() const override;
+    NetworKit::node getSource() const override;
+    NetworKit::node getTarget() const override;
+    void forEdges(const EdgeCallback &callback) const override;
+
+ private:
+    NetworKit::count rows, columns, max_capacity;
+};
+
+/**
+ * @ingroup generator
+ * The class for the image segmentation flow networks: a width x height x depth grid of cells over a
+ * random smooth intensity field with noise. Every cell is joined to the source and to the target
+ * with capacities proportional to its intensity and its complement, and to its axis neighbors in
+ * both directions with capacities decreasing with the intensity difference. The source is 0, the
+ * target is 1 and the cell (x, y, z) is 2 + (z * height + y) * width + x, as in GridNetwork.
+ */
+class SegmentationFlowNetworkGenerator final : public FlowNetworkGenerator {
+ public:
+    /**
+     * Set up the image segmentation network generator.
+     *
+     * @param width The size of the grid along the x axis.
+     * @param height The size of the grid along the y axis.
+     * @param depth The size of the grid along the z axis.
+     * @param max_capacity The maximum arc capacity.
+     * @param seed The random seed.
+     */
+    SegmentationFlowNetworkGenerator(
+        NetworKit::count width, NetworKit::count height, NetworKit::count depth,
+        NetworKit::count max_capacity, uint64_t seed = 0);
+
+    NetworKit::count numberOfNodes() const override;
+    NetworKit::node getSource() const override;
+    NetworKit::node getTarget() const override;
+    void forEdges(const EdgeCallback &callback) const override;
+
+ private:
+    NetworKit::count width, height, depth, max_capacity;
+};
+
+} /* namespace Koala */
@@ -7,32 +7,21 @@
 
 #pragma once
 
-#include <optional>
-
 #include <networkit/graph/Graph.hpp>
 
+#include <graph/RootedTree.hpp>
+
 namespace Koala {
 
-class DirectedTree {
+class DirectedTree : public RootedTree {
  public:
-    explicit DirectedTree(const NetworKit::Graph& G) : tree(G.upperNodeIdBound(), true, true) { }
-
-    NetworKit::Graph& getTree() { return tree; }
-
-    NetworKit::node getRoot() const {
-        return tree.upperNodeIdBound() - 1;
-    }
-
-    std::optional<NetworKit::node> getParent(NetworKit::node u) const {
-        return u != getRoot() ?
-            std::make_optional(*(tree.inNeighborRange(u).begin())) : std::nullopt;
+    explicit DirectedTree(const NetworKit::Graph& G) : RootedTree(G.upperNodeIdBound()) {
+        setRoot(G.upperNodeIdBound() - 1);
     }
 
     NetworKit::edgeweight edgeWeightToParent(NetworKit::node u) const {
-        return u != getRoot() ? tree.weight(*getParent(u), u) : 0;
+        return getWeight(u);
     }
- private:
-    NetworKit::Graph tree;
 };
 
 }  // namespace Koala
@@ -0,0 +1,44 @@
+/*
+ * GraphConcept.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <concepts>
+
+#include <networkit/Globals.hpp>
+
+namespace Koala {
+
+/**
+ * The read-only part of the interface of NetworKit::Graph used by the templated algorithms, so that
+ * they can run over NetworKit::Graph as well as over Koala::StaticGraph. The handles get the ids of
+ * the vertices as NetworKit::node and follow the NetworKit conventions: forNeighborsOf(u, handle)
+ * visits the out-neighbors of u, and forEdges(handle) visits every undirected edge once.
+ */
+template <class Graph>
+concept ReadOnlyGraph = requires(const Graph &graph, NetworKit::node u) {
+    { graph.numberOfNodes() } -> std::convertible_to<NetworKit::count>;
+    { graph.numberOfEdges() } -> std::convertible_to<NetworKit::count>;
+    { graph.upperNodeIdBound() } -> std::convertible_to<NetworKit::count>;
+    { graph.isDirected() } -> std::convertible_to<bool>;
+    { graph.hasNode(u) } -> std::convertible_to<bool>;
+    { graph.degree(u) } -> std::convertible_to<NetworKit::count>;
+    graph.forNodes([](NetworKit::node) { });
+    graph.forNeighborsOf(u, [](NetworKit::node) { });
+};
+
+/**
+ * A read-only graph which also passes the weights of the edges to the handles.
+ */
+template <class Graph>
+concept WeightedReadOnlyGraph = ReadOnlyGraph<Graph> &&
+    requires(const Graph &graph, NetworKit::node u) {
+        { graph.isWeighted() } -> std::convertible_to<bool>;
+        graph.forNeighborsOf(u, [](NetworKit::node, NetworKit::edgeweight) { });
+        graph.forEdges([](NetworKit::node, NetworKit::node, NetworKit::edgeweight) { });
+    };
+
+}  // namespace Koala
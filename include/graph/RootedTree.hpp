@@ -0,0 +1,95 @@
+/*
+ * RootedTree.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <networkit/Globals.hpp>
+
+namespace Koala {
+
+/**
+ * Rooted tree (or forest) stored as the parent array with the weights of the edges to the
+ * parents, and the children lists threaded through the first_child and next_sibling arrays.
+ * The vertices are 0, ..., n - 1 and new ones can be appended with addNode().
+ */
+class RootedTree {
+ public:
+    explicit RootedTree(NetworKit::count n = 0)
+        : root(NetworKit::none), parent(n, NetworKit::none), parent_weight(n, 0),
+            first_child(n, NetworKit::none), next_sibling(n, NetworKit::none) { }
+
+    NetworKit::node addNode() {
+        parent.push_back(NetworKit::none), parent_weight.push_back(0);
+        first_child.push_back(NetworKit::none), next_sibling.push_back(NetworKit::none);
+        return parent.size() - 1;
+    }
+
+    /**
+     * Attach the vertex v, which has no parent yet, as the first child of the vertex u.
+     */
+    void setParent(NetworKit::node v, NetworKit::node u, NetworKit::edgeweight w = 0) {
+        parent[v] = u, parent_weight[v] = w;
+        next_sibling[v] = first_child[u], first_child[u] = v;
+    }
+
+    void setRoot(NetworKit::node u) { root = u; }
+
+    NetworKit::node getRoot() const { return root; }
+
+    std::optional<NetworKit::node> getParent(NetworKit::node v) const {
+        return parent[v] != NetworKit::none ? std::make_optional(parent[v]) : std::nullopt;
+    }
+
+    NetworKit::edgeweight getWeight(NetworKit::node v) const { return parent_weight[v]; }
+
+    NetworKit::count numberOfNodes() const { return parent.size(); }
+
+    NetworKit::count upperNodeIdBound() const { return parent.size(); }
+
+    template <class Handle>
+    void forChildrenOf(NetworKit::node u, Handle handle) const {
+        for (auto v = first_child[u]; v != NetworKit::none; v = next_sibling[v]) {
+            handle(v);
+        }
+    }
+
+    /**
+     * Call handle(u, depth) for every vertex u visited by the Euler tour of the subtree of the
+     * root, i.e. on entering u and after returning from each of its children, 2n - 1 times in
+     * total. The root has depth 1. The tour uses an explicit stack, so deep trees are fine.
+     */
+    template <class Handle>
+    void forEulerTour(Handle handle) const {
+        std::vector<std::pair<NetworKit::node, NetworKit::node>> stack{{root, first_child[root]}};
+        handle(root, 1);
+        while (!stack.empty()) {
+            auto &[u, child] = stack.back();
+            if (child == NetworKit::none) {
+                stack.pop_back();
+                if (!stack.empty()) {
+                    handle(stack.back().first, stack.size());
+                }
+                continue;
+            }
+            auto v = child;
+            child = next_sibling[v];
+            stack.emplace_back(v, first_child[v]);
+            handle(v, stack.size());
+        }
+    }
+
+ private:
+    NetworKit::node root;
+    std::vector<NetworKit::node> parent;
+    std::vector<NetworKit::edgeweight> parent_weight;
+    std::vector<NetworKit::node> first_child, next_sibling;
+};
+
+}  // namespace Koala
@@ -0,0 +1,168 @@
+/*
+ * StaticGraph.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+#include <graph/GraphConcept.hpp>
+
+namespace Koala {
+
+/**
+ * Immutable graph in the compressed sparse row format. The out-neighbors of all vertices are
+ * stored contiguously, sorted for every vertex, in one array of ids of type Node, and the weights
+ * in a parallel array which is empty for the unweighted graphs. With Node = uint32_t the adjacency
+ * takes half the memory of the NetworKit one. The ids of the vertices are those of the source
+ * graph; the deleted vertices are kept as isolated ids for which hasNode() is false.
+ *
+ * The iteration methods mirror NetworKit::Graph, so the class models WeightedReadOnlyGraph, and
+ * the handles are called directly from the loops over the arrays.
+ */
+template <std::unsigned_integral Node = NetworKit::node>
+class StaticGraph {
+ public:
+    using node = Node;
+
+    /**
+     * Build the static copy of the graph.
+     *
+     * @param graph The input graph, with upperNodeIdBound() representable by Node.
+     */
+    explicit StaticGraph(const NetworKit::Graph &graph)
+            : directed(graph.isDirected()), weighted(graph.isWeighted()), n(0),
+              m(graph.numberOfEdges()), present(graph.upperNodeIdBound(), false),
+              offsets(graph.upperNodeIdBound() + 1, 0) {
+        if (graph.upperNodeIdBound() > std::numeric_limits<Node>::max()) {
+            throw std::invalid_argument("The node ids do not fit in the static graph id type");
+        }
+        graph.forNodes([&](NetworKit::node u) {
+            present[u] = true, offsets[u + 1] = graph.degree(u), n++;
+        });
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        targets.resize(offsets.back());
+        if (weighted) {
+            weights.resize(offsets.back());
+        }
+        std::vector<std::pair<Node, NetworKit::edgeweight>> adjacency;
+        graph.forNodes([&](NetworKit::node u) {
+            adjacency.clear();
+            graph.forNeighborsOf(u, [&](NetworKit::node v, NetworKit::edgeweight w) {
+                adjacency.emplace_back(static_cast<Node>(v), w);
+            });
+            std::sort(adjacency.begin(), adjacency.end());
+            for (NetworKit::index i = 0; i < adjacency.size(); i++) {
+                targets[offsets[u] + i] = adjacency[i].first;
+                if (weighted) {
+                    weights[offsets[u] + i] = adjacency[i].second;
+                }
+            }
+        });
+    }
+
+    NetworKit::count numberOfNodes() const { return n; }
+
+    NetworKit::count numberOfEdges() const { return m; }
+
+    NetworKit::count upperNodeIdBound() const { return present.size(); }
+
+    bool isDirected() const { return directed; }
+
+    bool isWeighted() const { return weighted; }
+
+    bool hasNode(NetworKit::node u) const { return u < present.size() && present[u]; }
+
+    NetworKit::count degree(NetworKit::node u) const { return offsets[u + 1] - offsets[u]; }
+
+    /**
+     * Return the sorted out-neighbors of the vertex u.
+     */
+    std::span<const Node> neighbors(NetworKit::node u) const {
+        return std::span<const Node>(targets.data() + offsets[u], degree(u));
+    }
+
+    bool hasEdge(NetworKit::node u, NetworKit::node v) const {
+        auto range = neighbors(u);
+        return std::binary_search(range.begin(), range.end(), static_cast<Node>(v));
+    }
+
+    /**
+     * Return the weight of the edge uv, 1 for the unweighted graphs, or 0 if there is no such edge.
+     */
+    NetworKit::edgeweight weight(NetworKit::node u, NetworKit::node v) const {
+        auto range = neighbors(u);
+        auto it = std::lower_bound(range.begin(), range.end(), static_cast<Node>(v));
+        if (it == range.end() || *it != v) {
+            return 0;
+        }
+        return weighted ? weights[offsets[u] + (it - range.begin())] : 1;
+    }
+
+    template <class Handle>
+    void forNodes(Handle handle) const {
+        for (NetworKit::node u = 0; u < present.size(); u++) {
+            if (present[u]) {
+                handle(u);
+            }
+        }
+    }
+
+    /**
+     * Call handle(v) or handle(v, w) for every out-neighbor v of the vertex u.
+     */
+    template <class Handle>
+    void forNeighborsOf(NetworKit::node u, Handle handle) const {
+        for (auto i = offsets[u]; i < offsets[u + 1]; i++) {
+            if constexpr (std::invocable<Handle&, NetworKit::node, NetworKit::edgeweight>) {
+                handle(NetworKit::node(targets[i]), weighted ? weights[i] : 1.0);
+            } else {
+                handle(NetworKit::node(targets[i]));
+            }
+        }
+    }
+
+    /**
+     * Call handle(u, v) or handle(u, v, w) for every edge, once for the undirected ones.
+     */
+    template <class Handle>
+    void forEdges(Handle handle) const {
+        for (NetworKit::node u = 0; u + 1 < offsets.size(); u++) {
+            for (auto i = offsets[u]; i < offsets[u + 1]; i++) {
+                NetworKit::node v = targets[i];
+                if (!directed && v > u) {
+                    break;
+                }
+                if constexpr (
+                        std::invocable<Handle&, NetworKit::node, NetworKit::node,
+                            NetworKit::edgeweight>) {
+                    handle(u, v, weighted ? weights[i] : 1.0);
+                } else {
+                    handle(u, v);
+                }
+            }
+        }
+    }
+
+ private:
+    bool directed, weighted;
+    NetworKit::count n, m;
+    std::vector<bool> present;
+    std::vector<NetworKit::index> offsets;
+    std::vector<Node> targets;
+    std::vector<NetworKit::edgeweight> weights;
+};
+
+}  // namespace Koala
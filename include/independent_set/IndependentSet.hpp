@@ -8,12 +8,16 @@
 #pragma once
 
 #include <map>
+#include <memory>
+#include <memory_resource>
 #include <optional>
 #include <set>
 
-#include <networkit/base/Algorithm.hpp>
 #include <networkit/graph/Graph.hpp>
 
+#include <base/Algorithm.hpp>
+#include <structures/SearchArena.hpp>
+
 namespace Koala {
 
 /**
@@ -21,7 +25,7 @@ namespace Koala {
  * The base class for the independent set problem algorithms.
  *
  */
-class IndependentSet : public NetworKit::Algorithm {
+class IndependentSet : public Algorithm {
  public:
     /**
      * Given an input graph, set up the independent set problem procedure.
@@ -30,6 +34,14 @@ class IndependentSet : public NetworKit::Algorithm {
      */
     explicit IndependentSet(const NetworKit::Graph &graph);
 
+    /**
+     * Given a shared input graph, set up the independent set problem procedure. The solvers remove
+     * and restore vertices while they search, so they always work on their own copy of the graph.
+     *
+     * @param graph The input graph.
+     */
+    explicit IndependentSet(std::shared_ptr<const NetworKit::Graph> graph);
+
     /**
      * Return the independent set found by the algorithm.
      *
@@ -37,6 +49,14 @@ class IndependentSet : public NetworKit::Algorithm {
      */
     const std::set<NetworKit::node>& getIndependentSet() const;
 
+    /**
+     * Set the resource providing the memory for the temporary containers of the search. By
+     * default, the solver keeps its own pool on top of the default resource.
+     *
+     * @param resource The upstream memory resource.
+     */
+    void setMemoryResource(std::pmr::memory_resource *resource);
+
     /**
      * Execute the maximum independent set finding procedure.
      */
@@ -52,7 +72,7 @@ class IndependentSet : public NetworKit::Algorithm {
      * Comparator for EdgeSet type
      */
     static bool edgeComparator(const NetworKit::Edge& a, const NetworKit::Edge& b);
-    using EdgeSet = std::set<NetworKit::Edge, decltype(&edgeComparator)>;
+    using EdgeSet = std::pmr::set<NetworKit::Edge, decltype(&edgeComparator)>;
 
     /**
      * @return N(v) - neigbors of vertex v
@@ -69,19 +89,30 @@ class IndependentSet : public NetworKit::Algorithm {
     */
     std::vector<NetworKit::node> getNeighbors2(NetworKit::node v) const;
 
+    /**
+     * @return the edges incident to the nodes, allocated from the arena of the current level of
+     * the search, so they have to be restored before the level is left
+    */
     EdgeSet getConnectedEdges(std::vector<NetworKit::node>& nodes) const;
     EdgeSet getInducedEdges(std::vector<NetworKit::node>& nodes) const;
     std::vector<NetworKit::node> getMirrors(NetworKit::node v) const;
 
     NetworKit::node getMinimumDegreeNode() const;
     NetworKit::node getMaximumDegreeNode() const;
-    void removeElements(std::vector<NetworKit::node> nodes);
+    void removeElements(const std::vector<NetworKit::node> &nodes);
     template <typename T>
     void restoreElements(std::vector<NetworKit::node>& nodes, T& edges);
     std::vector<NetworKit::node> runIndependentSetDegree2() const;
 
+    /**
+     * @return an independent set found greedily by picking minimum degree vertices, used as the
+     * fallback when the search is interrupted
+    */
+    std::vector<NetworKit::node> runIndependentSetGreedy() const;
+
     std::optional<NetworKit::Graph> graph;
     std::set<NetworKit::node> independentSet;
+    mutable SearchArena arena;
 };
 
 /**
@@ -107,7 +138,8 @@ class RecursiveIndependentSet : public IndependentSet {
     using IndependentSet::IndependentSet;
 
     /**
-     * Start recursive calls and extract result
+     * Start recursive calls and extract result. If interrupted, the recursive calls still pending
+     * complete their subgraphs greedily.
      */
     virtual void run();
 
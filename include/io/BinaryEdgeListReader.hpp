@@ -0,0 +1,99 @@
+/*
+ * BinaryEdgeListReader.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <networkit/io/GraphReader.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup io
+ * The header of the binary edge list format: the magic string, the number of nodes and the number
+ * of edges, followed by the edges as fixed-size records.
+ */
+struct BinaryEdgeListHeader {
+    static constexpr char MAGIC[8] = {'K', 'O', 'A', 'L', 'A', 'E', 'L', '1'};
+
+    char magic[8];
+    uint64_t nodes, edges;
+};
+
+/**
+ * @ingroup io
+ * A single edge record of the binary edge list format.
+ */
+struct BinaryEdge {
+    uint64_t u, v;
+    double weight;
+};
+
+/**
+ * @ingroup io
+ * A read-only memory-mapped view of a file in the binary edge list format, so that the edges can
+ * be scanned without loading them into memory.
+ */
+class MappedBinaryEdgeList {
+ public:
+    /**
+     * Map the file into memory.
+     *
+     * @param[in]  path  input file path
+     */
+    explicit MappedBinaryEdgeList(const std::string &path);
+    MappedBinaryEdgeList(const MappedBinaryEdgeList&) = delete;
+    MappedBinaryEdgeList& operator=(const MappedBinaryEdgeList&) = delete;
+    ~MappedBinaryEdgeList();
+
+    NetworKit::count numberOfNodes() const {
+        return header->nodes;
+    }
+
+    NetworKit::count numberOfEdges() const {
+        return header->edges;
+    }
+
+    const BinaryEdge* begin() const {
+        return edges;
+    }
+
+    const BinaryEdge* end() const {
+        return edges + header->edges;
+    }
+
+    const BinaryEdge& operator[](NetworKit::index i) const {
+        return edges[i];
+    }
+
+ private:
+    void *data;
+    std::size_t size;
+    const BinaryEdgeListHeader *header;
+    const BinaryEdge *edges;
+};
+
+/**
+ * @ingroup io
+ * A reader for the binary edge list format, building a weighted undirected graph.
+ *
+ */
+class BinaryEdgeListReader final : public NetworKit::GraphReader {
+ public:
+    BinaryEdgeListReader() = default;
+
+    /**
+     * Given the path of an input file, read the graph.
+     *
+     * @param[in]  path  input file path
+     * @param[out]  the graph read from file
+     */
+    NetworKit::Graph read(const std::string &path) override;
+};
+
+}  /* namespace Koala */
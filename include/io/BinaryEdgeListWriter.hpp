@@ -0,0 +1,61 @@
+/*
+ * BinaryEdgeListWriter.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include <networkit/io/GraphWriter.hpp>
+
+#include <generator/GraphGenerator.hpp>
+#include <io/BinaryEdgeListReader.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup io
+ * A writer for the binary edge list format (see BinaryEdgeListHeader and BinaryEdge). The edges are
+ * streamed to the file and the number of edges in the header is filled in at the end.
+ *
+ */
+class BinaryEdgeListWriter final : public NetworKit::GraphWriter {
+ public:
+    using EdgeCallback = GraphGenerator::EdgeCallback;
+
+    BinaryEdgeListWriter() = default;
+
+    /**
+     * Given a graph and a file path, write the graph to the file in binary edge list format.
+     *
+     * @param[in]  G     input graph
+     * @param[in]  path  output file path
+     */
+    void write(const NetworKit::Graph &G, const std::string &path) override;
+
+    /**
+     * Given a graph generator and a file path, stream the generated graph to the file without
+     * building it in memory.
+     *
+     * @param[in]  generator  input graph generator
+     * @param[in]  path       output file path
+     */
+    void write(const GraphGenerator &generator, const std::string &path);
+
+    /**
+     * Given the number of nodes and a procedure calling back for every edge, stream the edges to
+     * the file.
+     *
+     * @param[in]  n      number of nodes
+     * @param[in]  edges  procedure calling the given callback for every edge
+     * @param[in]  path   output file path
+     */
+    void write(
+        NetworKit::count n, const std::function<void(const EdgeCallback&)> &edges,
+        const std::string &path);
+};
+
+}  /* namespace Koala */
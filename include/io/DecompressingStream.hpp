@@ -0,0 +1,111 @@
+/*
+ * DecompressingStream.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <streambuf>
+#include <string>
+#include <thread>
+
+#include <networkit/Globals.hpp>
+
+namespace Koala {
+
+enum class Compression { NONE, GZIP, ZSTD };
+
+/**
+ * @ingroup io
+ * Detect the compression of the file from its magic bytes.
+ *
+ * @param[in]  path  input file path
+ * @param[out]  the compression of the file, NONE if it cannot be opened
+ */
+Compression detectCompression(const std::string &path);
+
+/**
+ * @ingroup io
+ * A stream buffer decompressing a gzip or zstd file on a separate thread. The decompressed data is
+ * passed to the reading thread in blocks through a bounded queue, so the decompression overlaps
+ * with the parsing and at most a few blocks are held in memory at any time.
+ */
+class DecompressingStreamBuf final : public std::streambuf {
+ public:
+    static constexpr NetworKit::count DEFAULT_BLOCK_SIZE = 1 << 20, DEFAULT_BLOCKS = 4;
+
+    /**
+     * Given an open file and its compression, start decompressing it in the background.
+     *
+     * @param[in]  file         input file, positioned at its beginning
+     * @param[in]  compression  compression of the file, either GZIP or ZSTD
+     * @param[in]  block_size   number of bytes in a decompressed block
+     * @param[in]  blocks       maximum number of decompressed blocks waiting to be read
+     */
+    DecompressingStreamBuf(
+        std::unique_ptr<std::ifstream> file, Compression compression,
+        NetworKit::count block_size = DEFAULT_BLOCK_SIZE,
+        NetworKit::count blocks = DEFAULT_BLOCKS);
+
+    DecompressingStreamBuf(const DecompressingStreamBuf&) = delete;
+    DecompressingStreamBuf& operator=(const DecompressingStreamBuf&) = delete;
+
+ protected:
+    int_type underflow() override;
+
+ private:
+    std::unique_ptr<std::ifstream> file;
+    Compression compression;
+    NetworKit::count block_size, blocks;
+
+    std::mutex mutex;
+    std::condition_variable_any changed;
+    std::deque<std::string> queue;
+    bool finished = false;
+    std::exception_ptr error;
+    std::string current;
+
+    std::jthread worker;
+
+    void decompress(std::stop_token token);
+    bool push(std::string &block, const std::stop_token &token);
+    void inflate_gzip(const std::stop_token &token);
+    void inflate_zstd(const std::stop_token &token);
+};
+
+/**
+ * @ingroup io
+ * An input file stream transparently decompressing gzip and zstd files, detected by their magic
+ * bytes. The uncompressed files are read directly, as with std::ifstream.
+ */
+class InputFileStream final : public std::istream {
+ public:
+    /**
+     * Given a path, open the file for reading.
+     *
+     * @param[in]  path  input file path
+     * @param[in]  mode  open mode of an uncompressed file, the compressed ones are read as binary
+     */
+    explicit InputFileStream(
+        const std::string &path, std::ios::openmode mode = std::ios::in);
+
+    /**
+     * Return whether the file was opened successfully.
+     */
+    bool is_open() const;
+
+ private:
+    std::unique_ptr<std::streambuf> buffer;
+    bool opened = false;
+};
+
+}  /* namespace Koala */
@@ -11,6 +11,8 @@
 
 #include <networkit/io/GraphWriter.hpp>
 
+#include <generator/GraphGenerator.hpp>
+
 namespace Koala {
 
 /**
@@ -30,6 +32,17 @@ class DimacsGraphWriter final : public NetworKit::GraphWriter {
      * @param[in]  path  output file path
      */
     void write(const NetworKit::Graph &G, const std::string &path) override;
+
+    /**
+     * Given a graph generator and a file path, stream the generated graph to the file in DIMACS
+     * format without building it in memory. The edges are generated twice, first to count them
+     * for the preamble. Flow networks are written in max format, other weighted graphs in sp
+     * format, and unweighted graphs in edge format.
+     *
+     * @param[in]  generator  input graph generator
+     * @param[in]  path       output file path
+     */
+    void write(const GraphGenerator &generator, const std::string &path);
 };
 
 } /* namespace Koala */
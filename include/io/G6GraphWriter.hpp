@@ -5,6 +5,8 @@
  *      Author: Krzysztof Turowski (krzysztof.szymon.turowski@gmail.com)
  */
 
+#pragma once
+
 #include <string>
 
 #include <networkit/io/GraphWriter.hpp>
@@ -36,6 +38,14 @@ class G6GraphWriter final : public NetworKit::GraphWriter {
      * @param[out]  output string
      */
     std::string writeline(const NetworKit::Graph &G);
+
+    /**
+     * Given a graph, append its graph6 representation to the output string, without the newline.
+     *
+     * @param[in]  G       input graph
+     * @param[out] output  output string
+     */
+    void writeline(const NetworKit::Graph &G, std::string &output);
 };
 
 } /* namespace Koala */
@@ -0,0 +1,108 @@
+/*
+ * GraphCorpusWriter.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+#include <io/S6GraphWriter.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup io
+ * A writer for files with many graphs, one per line, in graph6, sparse6 or incremental sparse6
+ * format. The lines are collected in a buffer and written out in large blocks, and a batch of
+ * graphs is encoded in parallel, with the encoded lines emitted in the order of the batch.
+ *
+ * In the incremental sparse6 format each graph with the same number of vertices as its predecessor
+ * is written as the list of toggled edges, unless the full sparse6 line is shorter. Such a file is
+ * read back line by line with S6GraphReader::readline(line, previous).
+ */
+class GraphCorpusWriter final {
+ public:
+    enum class Format { GRAPH6, SPARSE6, INCREMENTAL_SPARSE6 };
+
+    static constexpr NetworKit::count DEFAULT_BUFFER_SIZE = 1 << 20;
+
+    /**
+     * Given a file path and a format, open the file for writing.
+     *
+     * @param[in]  path         output file path
+     * @param[in]  format       output format
+     * @param[in]  buffer_size  number of bytes collected before writing them to the file
+     */
+    GraphCorpusWriter(
+        const std::string &path, Format format,
+        NetworKit::count buffer_size = DEFAULT_BUFFER_SIZE);
+
+    /**
+     * Given an output stream and a format, prepare for writing to the stream.
+     *
+     * @param[in]  out          output stream
+     * @param[in]  format       output format
+     * @param[in]  buffer_size  number of bytes collected before writing them to the stream
+     */
+    GraphCorpusWriter(
+        std::ostream &out, Format format, NetworKit::count buffer_size = DEFAULT_BUFFER_SIZE);
+
+    GraphCorpusWriter(const GraphCorpusWriter&) = delete;
+    GraphCorpusWriter& operator=(const GraphCorpusWriter&) = delete;
+
+    ~GraphCorpusWriter();
+
+    /**
+     * Given a graph, append it to the output.
+     *
+     * @param[in]  G  input graph
+     */
+    void write(const NetworKit::Graph &G);
+
+    /**
+     * Given a sequence of graphs, encode them in parallel and append them to the output in order.
+     *
+     * @param[in]  batch  input graphs
+     */
+    void write(const std::vector<NetworKit::Graph> &batch);
+
+    /**
+     * Write all the buffered lines to the output.
+     */
+    void flush();
+
+    /**
+     * Return the number of graphs written so far.
+     */
+    NetworKit::count numberOfGraphs() const;
+
+ private:
+    std::unique_ptr<std::ofstream> file;
+    std::ostream &out;
+    Format format;
+    NetworKit::count buffer_size, graphs = 0;
+    std::string buffer;
+
+    // The number of vertices and the sorted edges of the last graph, for the incremental format.
+    struct Snapshot {
+        NetworKit::count nodes;
+        S6GraphWriter::Edges edges;
+    };
+    std::optional<Snapshot> previous;
+
+    // Encode the graph against the snapshot of its predecessor, then replace the snapshot with the
+    // one of the graph.
+    void encode(
+        const NetworKit::Graph &G, std::optional<Snapshot> &last, std::string &output) const;
+};
+
+}  /* namespace Koala */
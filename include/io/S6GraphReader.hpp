@@ -38,6 +38,17 @@ class S6GraphReader final : public NetworKit::GraphReader {
      * @param[out]  the graph read from string
      */
     NetworKit::Graph readline(const std::string &line);
+
+    /**
+     * Given an input string and the graph from the preceding line, read the graph from it. A line
+     * starting with ';' is the incremental variant, listing the edges toggled with respect to the
+     * previous graph, while any other line is read as a standalone graph.
+     *
+     * @param[in]  line  input string
+     * @param[in]  previous  the graph read from the preceding line
+     * @param[out]  the graph read from string
+     */
+    NetworKit::Graph readline(const std::string &line, const NetworKit::Graph &previous);
 };
 
 } /* namespace Koala */
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <networkit/io/GraphWriter.hpp>
 
@@ -15,12 +17,15 @@ namespace Koala {
 
 /**
  * @ingroup io
- * A writer for sparse6 graph format. Each line contains a single graph.
+ * A writer for sparse6 graph format. Each line contains a single graph. In the incremental variant,
+ * starting with ';', the line lists the edges to be toggled in the previous graph of the file.
  * Full definition: https://users.cecs.anu.edu.au/~bdm/data/formats.txt
  *
  */
 class S6GraphWriter final : public NetworKit::GraphWriter {
  public:
+    using Edges = std::vector<std::pair<NetworKit::node, NetworKit::node>>;
+
     S6GraphWriter() = default;
 
     /**
@@ -32,12 +37,62 @@ class S6GraphWriter final : public NetworKit::GraphWriter {
     void write(const NetworKit::Graph &G, const std::string &path) override;
 
     /**
-     * Given a graph, find its graph6 representation.
+     * Given a graph, find its sparse6 representation.
      *
      * @param[in]  G     input graph
      * @param[out]  output string
      */
     std::string writeline(const NetworKit::Graph &G);
+
+    /**
+     * Given a graph, append its sparse6 representation to the output string, without the newline.
+     *
+     * @param[in]  G       input graph
+     * @param[out] output  output string
+     */
+    void writeline(const NetworKit::Graph &G, std::string &output);
+
+    /**
+     * Given a graph and the previous graph on the same vertices, find the incremental sparse6
+     * representation of the graph, i.e. of the symmetric difference of their edge sets.
+     *
+     * @param[in]  G         input graph
+     * @param[in]  previous  previous graph
+     * @param[out]  output string
+     */
+    std::string writeline(const NetworKit::Graph &G, const NetworKit::Graph &previous);
+
+    /**
+     * Given a graph and the previous graph on the same vertices, append the incremental sparse6
+     * representation of the graph to the output string, without the newline.
+     *
+     * @param[in]  G         input graph
+     * @param[in]  previous  previous graph
+     * @param[out] output    output string
+     */
+    void writeline(
+        const NetworKit::Graph &G, const NetworKit::Graph &previous, std::string &output);
+
+    /**
+     * Given the sorted edges of a graph and of the previous graph on the same n vertices, append
+     * the incremental sparse6 representation of the graph to the output string, without the
+     * newline. Keeping the edges of the previous graph avoids sorting them again for every line.
+     *
+     * @param[in]  n         number of vertices
+     * @param[in]  edges     edges of the graph, as returned by sortedEdges()
+     * @param[in]  previous  edges of the previous graph, as returned by sortedEdges()
+     * @param[out] output    output string
+     */
+    void writeline(
+        NetworKit::count n, const Edges &edges, const Edges &previous, std::string &output);
+
+    /**
+     * Given a graph, return its edges uv with u <= v as the pairs (v, u) in increasing order, i.e.
+     * in the order of the sparse6 format.
+     *
+     * @param[in]  G  input graph
+     */
+    static Edges sortedEdges(const NetworKit::Graph &G);
 };
 
 } /* namespace Koala */
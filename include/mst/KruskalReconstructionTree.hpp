@@ -0,0 +1,94 @@
+/*
+ * KruskalReconstructionTree.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+#include <graph/RootedTree.hpp>
+#include <structures/LCA.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup mst
+ * The Kruskal reconstruction tree of a minimum spanning forest, i.e. the single-linkage dendrogram.
+ * Its leaves are the vertices 0, ..., n - 1 of the graph, the internal vertex n + i corresponds to
+ * the i-th merge of two components made by Kruskal algorithm, and it is labelled by the weight of
+ * the merging edge. All the roots of the forest are attached to an artificial root. The bottleneck
+ * distance of two vertices, i.e. the maximum weight on the path between them in the minimum
+ * spanning forest, is the label of their lowest common ancestor.
+ */
+class KruskalReconstructionTree {
+ public:
+    /**
+     * A single merge of the dendrogram, in the format of the linkage matrix: the two merged
+     * clusters, the weight of the merging edge and the number of the vertices in the new cluster.
+     */
+    struct Merge {
+        NetworKit::node left, right;
+        NetworKit::edgeweight height;
+        NetworKit::count size;
+    };
+
+    /**
+     * Build the tree from the edges of a spanning forest, sorted in nondecreasing order of weights.
+     *
+     * @param n     The upper bound on the vertex identifiers.
+     * @param edges The edges of the forest in the order of merging.
+     */
+    KruskalReconstructionTree(NetworKit::count n, const std::vector<NetworKit::WeightedEdge> &edges);
+
+    /**
+     * Build the tree from a spanning forest, sorting its edges first.
+     *
+     * @param forest The minimum spanning forest.
+     */
+    explicit KruskalReconstructionTree(const NetworKit::Graph &forest);
+
+    KruskalReconstructionTree(const KruskalReconstructionTree&) = delete;
+    KruskalReconstructionTree& operator=(const KruskalReconstructionTree&) = delete;
+
+    /**
+     * Return the dendrogram: the i-th merge creates the cluster n + i.
+     */
+    const std::vector<Merge>& getDendrogram() const;
+
+    /**
+     * Return the flat clustering obtained by merging all clusters joined by an edge of weight at
+     * most threshold, in O(n) time.
+     *
+     * @param threshold The maximum weight of a merge.
+     * @return for every vertex the index of its cluster, numbered from 0.
+     */
+    std::vector<NetworKit::index> getClusters(NetworKit::edgeweight threshold) const;
+
+    /**
+     * Return the bottleneck distance between the vertices in O(1) time: the minimum over all
+     * paths between u and v of the maximum weight on the path, infinity if they are disconnected.
+     */
+    NetworKit::edgeweight getBottleneckDistance(NetworKit::node u, NetworKit::node v) const;
+
+    /**
+     * Return the tree, with the weights of the merges on the edges to the parents.
+     */
+    const RootedTree& getTree() const;
+
+ private:
+    NetworKit::count n;
+    std::vector<Merge> merges;
+    RootedTree tree;
+    std::unique_ptr<OptimalLCA<RootedTree>> lca;
+
+    void build(const std::vector<NetworKit::WeightedEdge> &edges);
+};
+
+}  /* namespace Koala */
@@ -0,0 +1,78 @@
+/*
+ * MinimumSpanningArborescence.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include <networkit/graph/Graph.hpp>
+
+#include <base/Algorithm.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup mst
+ * The class for the minimum spanning arborescence algorithm of Edmonds "Optimum Branchings"
+ * (1967), in the O(m log n) implementation from Tarjan "Finding Optimum Branchings" (1977) and
+ * Gabow et al. "Efficient Algorithms for Finding Minimum Spanning Trees in Undirected and Directed
+ * Graphs" (1986). The incoming edges of every contracted vertex are kept in a meldable pairing
+ * heap with a lazy offset of the keys, and the heaps of a cycle are merged smaller into larger.
+ * The arborescence spans the vertices reachable from the root.
+ */
+class MinimumSpanningArborescence final : public Algorithm {
+ public:
+    /**
+     * Given an input directed graph and a root, set up the minimum spanning arborescence procedure.
+     *
+     * @param graph The input directed graph.
+     * @param root  The root of the arborescence.
+     */
+    MinimumSpanningArborescence(const NetworKit::Graph &graph, NetworKit::node root);
+
+    /**
+     * Given a shared input directed graph and a root, set up the minimum spanning arborescence
+     * procedure without copying the graph.
+     *
+     * @param graph The input directed graph, e.g. obtained from Koala::borrow().
+     * @param root  The root of the arborescence.
+     */
+    MinimumSpanningArborescence(
+        std::shared_ptr<const NetworKit::Graph> graph, NetworKit::node root);
+
+    /**
+     * Execute the minimum spanning arborescence algorithm.
+     */
+    void run();
+
+    /**
+     * Return the arborescence found by the algorithm, with the edges directed away from the root.
+     *
+     * @return a spanning arborescence of the vertices reachable from the root.
+     */
+    const NetworKit::Graph& getArborescence() const;
+
+    /**
+     * Return the total weight of the arborescence found by the algorithm.
+     */
+    NetworKit::edgeweight getWeight() const;
+
+    /**
+     * Verify the result found by the algorithm: check that every vertex reachable from the root
+     * has exactly one incoming edge of the graph and is reachable in the arborescence, and compare
+     * the weight with the simple O(nm) contraction algorithm of Chu and Liu, and Edmonds.
+     */
+    void check() const;
+
+ private:
+    std::shared_ptr<const NetworKit::Graph> graph;
+    std::optional<NetworKit::Graph> arborescence;
+    NetworKit::node root;
+    NetworKit::edgeweight weight;
+};
+
+}  /* namespace Koala */
@@ -7,12 +7,22 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <optional>
+#include <utility>
+#include <vector>
 
-#include <networkit/base/Algorithm.hpp>
 #include <networkit/graph/Graph.hpp>
 #include <networkit/structures/UnionFind.hpp>
 
+#include <base/Algorithm.hpp>
+#include <graph/GraphConcept.hpp>
+#include <graph/RootedTree.hpp>
+#include <structures/RadixSort.hpp>
+#include <structures/Random.hpp>
+#include <mst/KruskalReconstructionTree.hpp>
+
 namespace Koala {
 
 /**
@@ -20,7 +30,7 @@ namespace Koala {
  * The base class for the minimum spanning tree algorithms.
  *
  */
-class MinimumSpanningTree : public NetworKit::Algorithm {
+class MinimumSpanningTree : public Algorithm {
  public:
     /**
      * Given an input graph, set up the minimum spanning tree procedure.
@@ -29,6 +39,14 @@ class MinimumSpanningTree : public NetworKit::Algorithm {
      */
     explicit MinimumSpanningTree(NetworKit::Graph &graph);
 
+    /**
+     * Given a shared input graph, set up the minimum spanning tree procedure without copying the
+     * graph.
+     *
+     * @param graph The input graph, e.g. obtained from Koala::borrow().
+     */
+    explicit MinimumSpanningTree(std::shared_ptr<const NetworKit::Graph> graph);
+
     /**
      * Return the spanning tree found by the algorithm.
      *
@@ -36,6 +54,15 @@ class MinimumSpanningTree : public NetworKit::Algorithm {
      */
     const NetworKit::Graph& getForest() const;
 
+    /**
+     * Return the Kruskal reconstruction tree (the single-linkage dendrogram) of the spanning tree
+     * found by the algorithm. Kruskal algorithm records the merges while running, for the other
+     * algorithms the n - 1 edges of the tree are sorted.
+     *
+     * @return the Kruskal reconstruction tree.
+     */
+    KruskalReconstructionTree getReconstructionTree() const;
+
     /**
      * Verify the result found by the algorithm using O(n + m) MST verification algorithm
      * from Hagerup, An Even Simpler Linear-Time Algorithm for Verifying Minimum Spanning Trees.
@@ -45,7 +72,9 @@ class MinimumSpanningTree : public NetworKit::Algorithm {
  protected:
     using NodePair = std::pair<NetworKit::node, NetworKit::node>;
 
-    std::optional<NetworKit::Graph> graph, tree;
+    std::shared_ptr<const NetworKit::Graph> graph;
+    std::optional<NetworKit::Graph> tree;
+    std::vector<NetworKit::WeightedEdge> merges;
 };
 
 /**
@@ -54,12 +83,32 @@ class MinimumSpanningTree : public NetworKit::Algorithm {
  */
 class KruskalMinimumSpanningTree final : public MinimumSpanningTree {
  public:
-    using MinimumSpanningTree::MinimumSpanningTree;
+    /**
+     * The method of sorting the edges: the comparison sort of the weighted edges, or the radix sort
+     * of the pairs (order-preserving integer key of the weight, edge index).
+     */
+    enum class Sorting { COMPARISON, RADIX };
+
+    /**
+     * Given an input graph, set up the Kruskal minimum spanning tree procedure.
+     *
+     * @param graph   The input graph.
+     * @param sorting The method of sorting the edges.
+     */
+    explicit KruskalMinimumSpanningTree(NetworKit::Graph &graph, Sorting sorting = Sorting::RADIX);
+    explicit KruskalMinimumSpanningTree(
+        std::shared_ptr<const NetworKit::Graph> graph, Sorting sorting = Sorting::RADIX);
 
     /**
      * Execute the Kruskal minimum spanning tree algorithm.
      */
     void run();
+
+ private:
+    Sorting sorting;
+
+    void run_comparison();
+    void run_radix();
 };
 
 /**
@@ -76,6 +125,24 @@ class PrimMinimumSpanningTree final : public MinimumSpanningTree {
     void run();
 };
 
+/**
+ * @ingroup mst
+ * The class for the Fredman-Tarjan minimum spanning tree algorithm from Fredman, Tarjan, Fibonacci
+ * Heaps and Their Uses in Improved Network Optimization Algorithms, running in O(m beta(m, n))
+ * time. In every phase the trees are grown as in Prim algorithm from the vertices of the
+ * contracted graph, until the Fibonacci heap exceeds k = 2^(2m/n) elements or the tree reaches
+ * another one. The trees are then contracted, keeping only the lightest of the parallel edges.
+ */
+class FredmanTarjanMinimumSpanningTree final : public MinimumSpanningTree {
+ public:
+    using MinimumSpanningTree::MinimumSpanningTree;
+
+    /**
+     * Execute the Fredman-Tarjan minimum spanning tree algorithm.
+     */
+    void run();
+};
+
 /**
  * @ingroup mst
  * The class for the Boruvka minimum spanning tree algorithm
@@ -91,7 +158,7 @@ class BoruvkaMinimumSpanningTree : public MinimumSpanningTree {
     void run();
 
  protected:
-    static std::optional<NetworKit::Graph> iterate(
+    static std::optional<RootedTree> iterate(
         NetworKit::Graph &G, NetworKit::Graph &F,
         NetworKit::UnionFind &union_find, std::map<NodePair, NodePair> &E,
         NetworKit::count steps, bool get_branching_tree);
@@ -103,7 +170,15 @@ class BoruvkaMinimumSpanningTree : public MinimumSpanningTree {
  */
 class KargerKleinTarjanMinimumSpanningTree final : public BoruvkaMinimumSpanningTree {
  public:
-    using BoruvkaMinimumSpanningTree::BoruvkaMinimumSpanningTree;
+    /**
+     * Given an input graph, set up the Karger-Klein-Tarjan minimum spanning tree procedure.
+     *
+     * @param graph The input graph.
+     * @param seed  The random seed of the edge sampling.
+     */
+    explicit KargerKleinTarjanMinimumSpanningTree(NetworKit::Graph &graph, uint64_t seed = 0);
+    explicit KargerKleinTarjanMinimumSpanningTree(
+        std::shared_ptr<const NetworKit::Graph> graph, uint64_t seed = 0);
 
     /**
      * Execute the Karger-Klein-Tarjan randomized minimum spanning tree algorithm.
@@ -111,9 +186,43 @@ class KargerKleinTarjanMinimumSpanningTree final : public BoruvkaMinimumSpanning
     void run();
 
  protected:
-    static void recurse(NetworKit::Graph &G, NetworKit::Graph &F);
-    static void discard_random_edges(NetworKit::Graph &G, NetworKit::Graph &subgraph);
+    uint64_t seed;
+
+    static void recurse(NetworKit::Graph &G, NetworKit::Graph &F, Philox &generator);
+    static void discard_random_edges(
+        NetworKit::Graph &G, NetworKit::Graph &subgraph, Philox &generator);
     static void remove_heavy_edges(NetworKit::Graph &G, NetworKit::Graph &subgraph);
 };
 
+/**
+ * @ingroup mst
+ * Compute the minimum spanning forest of a read-only graph, e.g. of a StaticGraph, with the
+ * Kruskal algorithm on the radix sorted edges.
+ *
+ * @param G The input undirected graph.
+ * @return the edges of the forest in the nondecreasing order of the weights.
+ */
+template <WeightedReadOnlyGraph Graph>
+std::vector<NetworKit::WeightedEdge> kruskalMinimumSpanningForest(const Graph &G) {
+    std::vector<NetworKit::WeightedEdge> edges;
+    edges.reserve(G.numberOfEdges());
+    G.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        edges.emplace_back(u, v, w);
+    });
+    std::vector<std::pair<uint64_t, NetworKit::index>> order(edges.size());
+    for (NetworKit::index i = 0; i < edges.size(); i++) {
+        order[i] = std::make_pair(order_preserving_key(edges[i].weight), i);
+    }
+    radix_sort(order);
+    NetworKit::UnionFind union_find(G.upperNodeIdBound());
+    std::vector<NetworKit::WeightedEdge> forest;
+    for (const auto &[key, i] : order) {
+        auto u = union_find.find(edges[i].u), v = union_find.find(edges[i].v);
+        if (u != v) {
+            union_find.merge(u, v), forest.push_back(edges[i]);
+        }
+    }
+    return forest;
+}
+
 }  /* namespace Koala */
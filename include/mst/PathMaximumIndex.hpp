@@ -0,0 +1,63 @@
+/*
+ * PathMaximumIndex.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+#include <mst/KruskalReconstructionTree.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup mst
+ * The online index of the maximum edge weights on the paths of a spanning forest, built in
+ * O(n log n) time from the Kruskal reconstruction tree of the forest and answering every query in
+ * O(1) time with OptimalLCA. Unlike AugmentedGraph::getTreePathMaxima the queries need not be
+ * known in advance; they do not modify the index, so it can be queried concurrently by many
+ * threads.
+ */
+class PathMaximumIndex {
+ public:
+    /**
+     * Given a spanning forest, e.g. from MinimumSpanningTree::getForest(), build the index.
+     *
+     * @param forest The weighted undirected forest.
+     */
+    explicit PathMaximumIndex(const NetworKit::Graph &forest);
+
+    /**
+     * Return the maximum weight on the path between the vertices in the forest, 0 if u = v and
+     * infinity if they are disconnected.
+     */
+    NetworKit::edgeweight query(NetworKit::node u, NetworKit::node v) const;
+
+    /**
+     * Answer a batch of queries in parallel.
+     *
+     * @param queries The pairs of vertices.
+     * @return the maximum weights on the paths between the pairs of vertices.
+     */
+    std::vector<NetworKit::edgeweight> query(
+        const std::vector<std::pair<NetworKit::node, NetworKit::node>> &queries) const;
+
+    /**
+     * Check whether a new edge is strictly heavier than every edge on the path between its
+     * endpoints in a minimum spanning forest, i.e. whether adding it leaves the forest minimal.
+     * An edge as heavy as the path maximum yields false, as it could replace the heaviest edge of
+     * the path in another minimum spanning forest. A self-loop (u = v) always yields true and an
+     * edge between distinct trees of the forest always yields false.
+     */
+    bool isHeavier(NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) const;
+
+ private:
+    KruskalReconstructionTree tree;
+};
+
+}  /* namespace Koala */
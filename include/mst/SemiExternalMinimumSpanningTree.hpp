@@ -0,0 +1,61 @@
+/*
+ * SemiExternalMinimumSpanningTree.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <string>
+
+#include <networkit/Globals.hpp>
+
+#include <base/Algorithm.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup mst
+ * The class for the semi-external Kruskal minimum spanning forest algorithm, for the edge lists
+ * larger than the memory. Only the union-find structure on the vertices is kept in memory. The
+ * edges are read from a memory-mapped file in the binary edge list format in runs, each run is
+ * sorted and reduced to its own minimum spanning forest (the other edges are the heaviest ones on
+ * some cycle, so they do not belong to the global forest), and written to a temporary file. The
+ * sorted runs are then merged and fed to Kruskal algorithm, which writes the forest incrementally
+ * to the output file in the binary edge list format. If the run is interrupted, the output file
+ * holds the minimum spanning forest of the edges from the runs sorted so far.
+ */
+class SemiExternalMinimumSpanningTree final : public Algorithm {
+ public:
+    /**
+     * Given the input and output files, set up the semi-external minimum spanning tree procedure.
+     *
+     * @param input    The path of the input graph in the binary edge list format.
+     * @param output   The path of the output forest, also used as a prefix of the temporary files.
+     * @param run_size The maximum number of edges sorted in memory at once.
+     */
+    SemiExternalMinimumSpanningTree(
+        const std::string &input, const std::string &output, NetworKit::count run_size = 1 << 24);
+
+    /**
+     * Execute the semi-external minimum spanning tree algorithm.
+     */
+    void run();
+
+    /**
+     * Return the number of edges of the spanning forest written to the output file.
+     */
+    NetworKit::count getForestSize() const;
+
+    /**
+     * Return the total weight of the spanning forest written to the output file.
+     */
+    NetworKit::edgeweight getForestWeight() const;
+
+ private:
+    std::string input, output;
+    NetworKit::count run_size, forest_size;
+    NetworKit::edgeweight forest_weight;
+};
+
+}  /* namespace Koala */
@@ -0,0 +1,135 @@
+/*
+ * Profiler.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+
+#include <networkit/Globals.hpp>
+
+namespace Koala {
+
+namespace Profiling {
+
+/**
+ * Hardware events counted for every profiled region, if perf_event_open is available.
+ */
+enum class Counter { CYCLES, INSTRUCTIONS, LLC_MISSES, BRANCH_MISSES };
+
+constexpr std::size_t NUMBER_OF_COUNTERS = 4;
+
+/**
+ * Statistics aggregated over all executions of a single region.
+ */
+struct RegionStatistics {
+    NetworKit::count calls = 0;
+    double seconds = 0.0;
+    bool has_counters = false;
+    std::array<uint64_t, NUMBER_OF_COUNTERS> counters{};
+
+    uint64_t get(Counter counter) const {
+        return counters[static_cast<std::size_t>(counter)];
+    }
+};
+
+/**
+ * @ingroup profiling
+ * The per-run profile of an algorithm: statistics of all its regions, keyed by region names.
+ * Nested regions are counted inclusively.
+ */
+class Profile {
+ public:
+    /**
+     * Return the statistics of all regions.
+     *
+     * @return a map from region names to their statistics.
+     */
+    const std::map<std::string, RegionStatistics>& getRegions() const;
+
+    /**
+     * Add a single execution of a region.
+     *
+     * @param name The name of the region.
+     * @param statistics The statistics of the execution.
+     */
+    void add(const std::string &name, const RegionStatistics &statistics);
+
+    void clear();
+
+    bool empty() const;
+
+ private:
+    std::map<std::string, RegionStatistics> regions;
+};
+
+std::ostream& operator<<(std::ostream &out, const Profile &profile);
+
+/**
+ * RAII binding of the profile that the regions executed by the current thread record into.
+ * The previous binding is restored at the end of the scope, so nested algorithms record into
+ * their own profiles.
+ */
+class ProfileScope {
+ public:
+    ProfileScope(Profile &profile, bool reset);
+    ~ProfileScope();
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+ private:
+    Profile *previous;
+};
+
+/**
+ * RAII timer, with hardware counters if available, of a single execution of a region. It records
+ * into the profile bound to the current thread, and does nothing if there is none; hence regions
+ * entered from worker threads of parallel loops are not recorded.
+ */
+class ScopedRegion {
+ public:
+    explicit ScopedRegion(const char *name);
+    ~ScopedRegion();
+
+    ScopedRegion(const ScopedRegion&) = delete;
+    ScopedRegion& operator=(const ScopedRegion&) = delete;
+
+ private:
+    const char *name;
+    Profile *profile;
+    bool has_counters;
+    std::array<uint64_t, NUMBER_OF_COUNTERS> counters;
+    std::chrono::steady_clock::time_point start;
+};
+
+}  // namespace Profiling
+
+}  // namespace Koala
+
+#ifdef KOALA_ENABLE_PROFILING
+#define KOALA_PROFILE_CONCAT_IMPL(a, b) a##b
+#define KOALA_PROFILE_CONCAT(a, b) KOALA_PROFILE_CONCAT_IMPL(a, b)
+// Reset the algorithm profile and record into it until the end of the enclosing scope.
+#define KOALA_PROFILE_RUN() \
+    Koala::Profiling::ProfileScope KOALA_PROFILE_CONCAT(koala_profile_scope_, __LINE__)( \
+        profile, true)
+// Record into the algorithm profile, without resetting it, until the end of the enclosing scope.
+#define KOALA_PROFILE_ATTACH() \
+    Koala::Profiling::ProfileScope KOALA_PROFILE_CONCAT(koala_profile_scope_, __LINE__)( \
+        profile, false)
+// Measure the rest of the enclosing scope as the region with the given name.
+#define KOALA_PROFILE_REGION(name) \
+    Koala::Profiling::ScopedRegion KOALA_PROFILE_CONCAT(koala_profile_region_, __LINE__)(name)
+#else
+#define KOALA_PROFILE_RUN() static_cast<void>(0)
+#define KOALA_PROFILE_ATTACH() static_cast<void>(0)
+#define KOALA_PROFILE_REGION(name) static_cast<void>(0)
+#endif
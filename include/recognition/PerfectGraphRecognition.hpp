@@ -8,14 +8,16 @@
 
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <vector>
 
-#include <networkit/base/Algorithm.hpp>
 #include <networkit/components/ConnectedComponents.hpp>
 #include <networkit/graph/Graph.hpp>
 #include <networkit/graph/GraphTools.hpp>
 
+#include <base/Algorithm.hpp>
+
 namespace Koala {
 
 /**
@@ -24,7 +26,7 @@ namespace Koala {
  * Chudnovsky, Cornuejols, Liu, Seymour, Vuskovic, "Recognizing Berge graphs".
  *
  */
-class PerfectGraphRecognition : public NetworKit::Algorithm {
+class PerfectGraphRecognition : public Algorithm {
  public:
     enum class State {
         UNKNOWN,
@@ -44,6 +46,13 @@ class PerfectGraphRecognition : public NetworKit::Algorithm {
      */
     explicit PerfectGraphRecognition(NetworKit::Graph &graph);
 
+    /**
+     * Given a shared input graph, set up the perfect graph recognition without copying the graph.
+     *
+     * @param graph The input graph, e.g. obtained from Koala::borrow().
+     */
+    explicit PerfectGraphRecognition(std::shared_ptr<const NetworKit::Graph> graph);
+
     /**
      * Execute the perfect graph recognition procedure.
      */
@@ -75,7 +84,7 @@ class PerfectGraphRecognition : public NetworKit::Algorithm {
     static std::vector<std::vector<NetworKit::node>> getAuxiliaryComponents(
         const NetworKit::Graph &graph, const std::vector<NetworKit::node> &V);
  private:
-    std::optional<NetworKit::Graph> graph;
+    std::shared_ptr<const NetworKit::Graph> graph;
     State is_perfect;
 
     static State contains_simple_prohibited(const NetworKit::Graph &graph);
@@ -0,0 +1,145 @@
+/*
+ * PlanarGraphRecognition.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+#include <base/Algorithm.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup recognition
+ * A combinatorial embedding of a planar graph, i.e. its rotation system: for every vertex the
+ * clockwise order of its neighbors around it. The rotations of all vertices are stored one after
+ * another in a single array, indexed by offsets as in the compressed sparse row format, and for
+ * every entry uv the position of the reverse entry vu is stored as well.
+ */
+class PlanarEmbedding {
+ public:
+    PlanarEmbedding() = default;
+
+    NetworKit::count upperNodeIdBound() const;
+
+    NetworKit::count degree(NetworKit::node u) const;
+
+    /**
+     * Return the neighbors of the vertex u in the clockwise order.
+     */
+    std::span<const NetworKit::node> rotation(NetworKit::node u) const;
+
+    /**
+     * Return the position of the entry u in the rotation of targets[i], given the position i of
+     * an entry in the rotation of u, both counted from the beginning of the whole array.
+     */
+    NetworKit::index twin(NetworKit::index i) const;
+
+    /**
+     * Return the number of faces of the embedding, counted separately for every connected
+     * component with at least one edge.
+     */
+    NetworKit::count numberOfFaces() const;
+
+ private:
+    friend class PlanarGraphRecognition;
+
+    std::vector<NetworKit::index> offsets = {0}, twins;
+    std::vector<NetworKit::node> targets;
+};
+
+/**
+ * @ingroup recognition
+ * The class for the linear-time planarity testing with the left-right criterion from
+ * Brandes, "The left-right planarity test", following de Fraysseix, Ossona de Mendez, Rosenstiehl,
+ * "Tremaux trees and planarity". For planar graphs the algorithm also finds a combinatorial
+ * embedding. All the depth-first searches use explicit stacks, so the recursion depth does not
+ * depend on the size of the graph. Self-loops and parallel edges are ignored.
+ *
+ */
+class PlanarGraphRecognition : public Algorithm {
+ public:
+    /**
+     * Given an input graph, set up the planarity test.
+     *
+     * @param graph The input graph.
+     */
+    explicit PlanarGraphRecognition(const NetworKit::Graph &graph);
+
+    /**
+     * Given a shared input graph, set up the planarity test without copying the graph.
+     *
+     * @param graph The input graph, e.g. obtained from Koala::borrow().
+     */
+    explicit PlanarGraphRecognition(std::shared_ptr<const NetworKit::Graph> graph);
+
+    /**
+     * Execute the planarity test.
+     */
+    void run();
+
+    /**
+     * Return the result found by the algorithm.
+     *
+     * @return true if the graph is planar, false otherwise.
+     */
+    bool isPlanar() const;
+
+    /**
+     * Return the combinatorial embedding found by the algorithm, empty if the graph is not planar.
+     */
+    const PlanarEmbedding& getEmbedding() const;
+
+    /**
+     * Verify the embedding found by the algorithm with the Euler formula.
+     */
+    void check() const;
+
+ private:
+    static constexpr NetworKit::index NONE = NetworKit::none;
+
+    struct Interval {
+        NetworKit::index low = NONE, high = NONE;
+
+        bool empty() const { return low == NONE && high == NONE; }
+    };
+
+    struct ConflictPair {
+        Interval left, right;
+    };
+
+    std::shared_ptr<const NetworKit::Graph> graph;
+    bool is_planar = false;
+    PlanarEmbedding embedding;
+
+    // the edges oriented during the depth-first search, from the parent or to the ancestor
+    std::vector<NetworKit::node> source, target;
+    std::vector<NetworKit::index> adjacency_offsets, adjacency, parent_edge;
+    std::vector<NetworKit::index> out_offsets, out_edges;
+    std::vector<NetworKit::index> height, lowpt, lowpt2, ref, lowpt_edge, stack_bottom;
+    std::vector<int64_t> nesting_depth;
+    std::vector<int> side;
+    std::vector<ConflictPair> S;
+    std::vector<NetworKit::node> roots;
+
+    void orient();
+    void sort_out_edges();
+    bool test();
+    bool add_constraints(NetworKit::index ei, NetworKit::index e);
+    void remove_back_edges(NetworKit::index e);
+    int sign(NetworKit::index e);
+    void embed();
+
+    bool conflicting(const Interval &I, NetworKit::index b) const;
+    NetworKit::index lowest(const ConflictPair &P) const;
+};
+
+}  /* namespace Koala */
@@ -0,0 +1,260 @@
+/*
+ * VertexReordering.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+#include <base/Algorithm.hpp>
+
+namespace Koala {
+
+/**
+ * @ingroup reordering
+ * The base class for the vertex reordering heuristics. The vertices of the input graph are
+ * relabelled with the ids 0, ..., n - 1 so that the adjacent vertices get close ids, and the
+ * reordered graph is built with every adjacency list sorted by the new ids. The algorithms run on
+ * the reordered graph then touch the per-vertex arrays in a more local pattern, and their results
+ * are translated back to the ids of the input graph with mapBack().
+ */
+class VertexReordering : public Algorithm {
+ public:
+    /**
+     * Given an input graph, set up the reordering procedure.
+     *
+     * @param graph The input graph.
+     */
+    explicit VertexReordering(const NetworKit::Graph &graph);
+
+    /**
+     * Given a shared input graph, set up the reordering procedure without copying the graph.
+     *
+     * @param graph The input graph, e.g. obtained from Koala::borrow().
+     */
+    explicit VertexReordering(std::shared_ptr<const NetworKit::Graph> graph);
+
+    /**
+     * Return the permutation found by the algorithm, i.e. the new id of every vertex of the input
+     * graph, or NetworKit::none for the ids of the deleted vertices.
+     */
+    const std::vector<NetworKit::node>& getPermutation() const;
+
+    /**
+     * Return the inverse permutation, i.e. the id in the input graph of every vertex of the
+     * reordered graph.
+     */
+    const std::vector<NetworKit::node>& getInversePermutation() const;
+
+    /**
+     * Return the reordered graph, with the vertices 0, ..., n - 1.
+     */
+    const NetworKit::Graph& getReorderedGraph() const;
+
+    /**
+     * Translate an id of the reordered graph to the id of the input graph.
+     */
+    NetworKit::node mapBack(NetworKit::node v) const;
+
+    /**
+     * Translate a set of vertices of the reordered graph to the ids of the input graph.
+     */
+    std::set<NetworKit::node> mapBack(const std::set<NetworKit::node> &vertices) const;
+
+    /**
+     * Translate a map keyed by the vertices of the reordered graph, e.g. a coloring.
+     */
+    template <class T>
+    std::map<NetworKit::node, T> mapBack(const std::map<NetworKit::node, T> &values) const {
+        std::map<NetworKit::node, T> result;
+        for (const auto &[v, value] : values) {
+            result.emplace(mapBack(v), value);
+        }
+        return result;
+    }
+
+    /**
+     * Translate an array indexed by the vertices of the reordered graph to an array indexed by the
+     * ids of the input graph, with the default value of T at the ids of the deleted vertices.
+     */
+    template <class T>
+    std::vector<T> mapBack(const std::vector<T> &values) const {
+        std::vector<T> result(permutation.size());
+        for (NetworKit::node v = 0; v < values.size(); v++) {
+            result[inverse[v]] = values[v];
+        }
+        return result;
+    }
+
+    /**
+     * Translate a subgraph of the reordered graph, e.g. a spanning forest, to a graph on the ids of
+     * the input graph.
+     */
+    NetworKit::Graph mapBack(const NetworKit::Graph &subgraph) const;
+
+    /**
+     * Verify the result found by the algorithm: check that the ordering is a permutation of the
+     * vertices and that it maps the edges of the reordered graph onto the edges of the input graph.
+     */
+    void check() const;
+
+ protected:
+    std::shared_ptr<const NetworKit::Graph> graph;
+    std::vector<NetworKit::node> permutation, inverse;
+    std::optional<NetworKit::Graph> reordered;
+
+    /**
+     * Given the vertices of the input graph listed in the new order in inverse, compute the
+     * permutation and build the reordered graph.
+     */
+    void build();
+};
+
+/**
+ * @ingroup reordering
+ * The class for the ordering of the vertices by non-increasing degrees, so that the adjacency lists
+ * of the hubs, visited by most of the traversals, are packed at the front of the graph.
+ */
+class DegreeSortReordering final : public VertexReordering {
+ public:
+    using VertexReordering::VertexReordering;
+
+    /**
+     * Execute the degree sorting.
+     */
+    void run();
+};
+
+/**
+ * @ingroup reordering
+ * The class for the breadth-first search ordering, with every component searched from its vertex
+ * of the smallest id and the neighbors visited in the order of the adjacency lists.
+ */
+class BFSReordering final : public VertexReordering {
+ public:
+    using VertexReordering::VertexReordering;
+
+    /**
+     * Execute the breadth-first search ordering.
+     */
+    void run();
+};
+
+/**
+ * @ingroup reordering
+ * The class for the reverse Cuthill-McKee ordering from Cuthill, McKee, Reducing the Bandwidth of
+ * Sparse Symmetric Matrices, and George, Computer Implementation of the Finite Element Method.
+ * Every component is searched breadth-first from a pseudo-peripheral vertex found with the
+ * heuristic of George and Liu, the neighbors are visited by non-decreasing degrees, and the whole
+ * ordering is reversed, which keeps the edges between close ids.
+ */
+class ReverseCuthillMcKeeReordering final : public VertexReordering {
+ public:
+    using VertexReordering::VertexReordering;
+
+    /**
+     * Execute the reverse Cuthill-McKee ordering.
+     */
+    void run();
+};
+
+/**
+ * @ingroup reordering
+ * The class for the greedy Gorder heuristic from Wei et al., Speedup Graph Processing by Graph
+ * Ordering. The next vertex is the one with the largest score against the last w placed ones,
+ * where the score of u and v counts the edges between them and their common in-neighbors. The
+ * scores are kept in a lazy max-heap and updated when a vertex enters and leaves the window; the
+ * in-neighbors of degree above sqrt(n) are skipped when counting the common ones, so that a single
+ * hub does not cost a pass over its whole neighborhood for every vertex in the window.
+ */
+class GorderReordering final : public VertexReordering {
+ public:
+    /**
+     * Given an input graph, set up the Gorder procedure.
+     *
+     * @param graph  The input graph.
+     * @param window The size w of the window of the last placed vertices.
+     */
+    explicit GorderReordering(const NetworKit::Graph &graph, NetworKit::count window = 5);
+    explicit GorderReordering(
+        std::shared_ptr<const NetworKit::Graph> graph, NetworKit::count window = 5);
+
+    /**
+     * Execute the Gorder heuristic.
+     */
+    void run();
+
+ private:
+    NetworKit::count window;
+};
+
+/**
+ * @ingroup reordering
+ * Run an algorithm on the graph reordered with the given heuristic. The algorithm shares the
+ * reordered graph, so it has to accept a std::shared_ptr<const NetworKit::Graph>, and the
+ * remaining arguments are passed to its constructor unchanged, so they cannot refer to the
+ * vertices. The results are translated back to the ids of the input graph with mapBack(). The
+ * input graph is not copied, so it has to outlive the object, which can be neither copied nor
+ * moved, as the algorithm refers to the reordered graph owned by it.
+ */
+template <class Algorithm, class Reordering = ReverseCuthillMcKeeReordering>
+class ReorderedAlgorithm {
+ public:
+    /**
+     * Reorder the input graph and set up the algorithm on the reordered one.
+     *
+     * @param graph The input graph.
+     * @param args  The remaining arguments of the constructor of the algorithm.
+     */
+    template <class... Args>
+    explicit ReorderedAlgorithm(const NetworKit::Graph &graph, Args&&... args)
+            : reordering(borrow(graph)) {
+        reordering.run();
+        algorithm.emplace(borrow(reordering.getReorderedGraph()), std::forward<Args>(args)...);
+    }
+
+    ReorderedAlgorithm(const ReorderedAlgorithm&) = delete;
+    ReorderedAlgorithm& operator=(const ReorderedAlgorithm&) = delete;
+
+    /**
+     * Execute the algorithm on the reordered graph.
+     */
+    void run() {
+        algorithm->run();
+    }
+
+    Algorithm& getAlgorithm() {
+        return *algorithm;
+    }
+
+    const Algorithm& getAlgorithm() const {
+        return *algorithm;
+    }
+
+    const Reordering& getReordering() const {
+        return reordering;
+    }
+
+    /**
+     * Translate a result of the algorithm to the ids of the input graph.
+     */
+    template <class Result>
+    auto mapBack(const Result &result) const {
+        return reordering.mapBack(result);
+    }
+
+ private:
+    Reordering reordering;
+    std::optional<Algorithm> algorithm;
+};
+
+}  /* namespace Koala */
@@ -10,18 +10,20 @@
 #include <set>
 #include <vector>
 
-#include <networkit/base/Algorithm.hpp>
 #include <networkit/graph/Graph.hpp>
 
+#include <base/Algorithm.hpp>
+
 namespace Koala {
 
 /**
  * @ingroup set_cover
  * The class for exact determination of minimum set cover
- * via branch and reduce algorithm.
+ * via branch and reduce algorithm. Once cancelled, the remaining elements are covered by arbitrary
+ * sets containing them, so the result is a feasible, but not minimum set cover.
  *
  */
-class BranchAndReduceSetCover : public NetworKit::Algorithm {
+class BranchAndReduceSetCover : public Algorithm {
  public:
     /**
      * Given an input graph, set up the branch and reduce minimum set cover algorithm.
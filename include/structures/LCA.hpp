@@ -12,7 +12,7 @@
 
 namespace Koala {
 
-template<class T>
+template<class T = RootedTree>
 using LCA = OptimalLCA<T>;
 
 }  // namespace Koala
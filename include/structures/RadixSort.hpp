@@ -0,0 +1,83 @@
+/*
+ * RadixSort.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <omp.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Koala {
+
+/**
+ * Map a floating-point number to an unsigned integer, so that the order of the non-NaN numbers is
+ * preserved: the sign bit is flipped for the nonnegative numbers and all bits for the negative ones.
+ */
+inline uint64_t order_preserving_key(double x) {
+    auto bits = std::bit_cast<uint64_t>(x);
+    return bits & (1ULL << 63) ? ~bits : bits | (1ULL << 63);
+}
+
+/**
+ * Sort stably the pairs by their keys with a parallel LSD radix sort on 11-bit digits. Only the
+ * digits below the highest bit in which the keys differ are processed, so e.g. small integer
+ * weights take one or two passes.
+ *
+ * @param items The vector of pairs (key, value) to be sorted.
+ */
+template <class Value>
+void radix_sort(std::vector<std::pair<uint64_t, Value>> &items) {
+    constexpr int BITS = 11;
+    constexpr uint64_t BUCKETS = 1 << BITS;
+    const int64_t n = items.size();
+    if (n < 2) {
+        return;
+    }
+    uint64_t low = items[0].first, high = items[0].first;
+    #pragma omp parallel for reduction(min:low) reduction(max:high)
+    for (int64_t i = 0; i < n; i++) {
+        low = std::min(low, items[i].first), high = std::max(high, items[i].first);
+    }
+    const int passes = (std::bit_width(high - low) + BITS - 1) / BITS;
+
+    std::vector<std::pair<uint64_t, Value>> buffer(n);
+    std::vector<uint64_t> histogram(static_cast<uint64_t>(omp_get_max_threads()) * BUCKETS);
+    for (int pass = 0; pass < passes; pass++) {
+        auto digit = [&](uint64_t key) { return ((key - low) >> (pass * BITS)) & (BUCKETS - 1); };
+        #pragma omp parallel
+        {
+            const int64_t threads = omp_get_num_threads(), t = omp_get_thread_num();
+            const int64_t begin = n * t / threads, end = n * (t + 1) / threads;
+            uint64_t *count = histogram.data() + t * BUCKETS;
+            std::fill(count, count + BUCKETS, 0);
+            for (int64_t i = begin; i < end; i++) {
+                count[digit(items[i].first)]++;
+            }
+            #pragma omp barrier
+            #pragma omp single
+            {
+                // the offsets are ordered by the digits first and then by the threads
+                uint64_t offset = 0;
+                for (uint64_t b = 0; b < BUCKETS; b++) {
+                    for (int64_t s = 0; s < threads; s++) {
+                        std::swap(histogram[s * BUCKETS + b], offset);
+                        offset += histogram[s * BUCKETS + b];
+                    }
+                }
+            }
+            for (int64_t i = begin; i < end; i++) {
+                buffer[count[digit(items[i].first)]++] = items[i];
+            }
+        }
+        std::swap(items, buffer);
+    }
+}
+
+}  // namespace Koala
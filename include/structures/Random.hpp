@@ -0,0 +1,79 @@
+/*
+ * Random.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace Koala {
+
+/**
+ * Map 64 random bits to a double uniform in [0, 1).
+ */
+inline double to_unit(uint64_t x) {
+    return static_cast<double>(x >> 11) * 0x1.0p-53;
+}
+
+/**
+ * Counter-based random number generator Philox4x32-10 from Salmon et al. "Parallel Random
+ * Numbers: As Easy as 1, 2, 3" (2011). The i-th number of the stream is a bijective function of
+ * (seed, stream, i), so it can be computed in O(1) time without any shared state: the parallel
+ * loops draw from the counter of their item instead of a generator shared by the threads, and
+ * the results do not depend on the number of threads. The class is also a uniform random bit
+ * generator, so it can be used with the distributions from <random>.
+ */
+class Philox {
+ public:
+    using result_type = uint64_t;
+
+    explicit Philox(uint64_t seed = 0, uint64_t stream = 0)
+        : seed(seed), stream(stream), counter(0) { }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    /**
+     * Return the next number of the stream.
+     */
+    result_type operator()() { return (*this)[counter++]; }
+
+    /**
+     * Return the i-th number of the stream, regardless of the numbers drawn so far.
+     */
+    result_type operator[](uint64_t i) const {
+        auto block = generate(i >> 1);
+        auto j = 2 * (i & 1);
+        return (uint64_t(block[j + 1]) << 32) | block[j];
+    }
+
+    void discard(uint64_t steps) { counter += steps; }
+
+    /**
+     * Return a number uniform in [0, 1) and advance the stream.
+     */
+    double real() { return to_unit((*this)()); }
+
+ private:
+    uint64_t seed, stream, counter;
+
+    std::array<uint32_t, 4> generate(uint64_t block) const {
+        std::array<uint32_t, 4> c{
+            static_cast<uint32_t>(block), static_cast<uint32_t>(block >> 32),
+            static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)};
+        uint32_t k0 = static_cast<uint32_t>(seed), k1 = static_cast<uint32_t>(seed >> 32);
+        for (int round = 0; round < 10; round++) {
+            uint64_t p0 = uint64_t(0xD2511F53) * c[0], p1 = uint64_t(0xCD9E8D57) * c[2];
+            c = {static_cast<uint32_t>(p1 >> 32) ^ c[1] ^ k0, static_cast<uint32_t>(p1),
+                static_cast<uint32_t>(p0 >> 32) ^ c[3] ^ k1, static_cast<uint32_t>(p0)};
+            k0 += 0x9E3779B9, k1 += 0xBB67AE85;
+        }
+        return c;
+    }
+};
+
+}  // namespace Koala
@@ -0,0 +1,78 @@
+/*
+ * SearchArena.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace Koala {
+
+/**
+ * Stack of monotonic arenas, one per level of a backtracking search. The temporary containers of a
+ * level are allocated by bumping a pointer in its arena and the whole arena is released at once
+ * when the search backtracks from the level, so that the memory is reused by the next branch
+ * without going through the global allocator. The released blocks are kept by an unsynchronized
+ * pool, so every solver owns its memory and the threads running separate solvers do not contend.
+ *
+ * Only the containers that die before their level is left may use its arena; the results passed
+ * up to the caller have to be allocated elsewhere.
+ */
+class SearchArena {
+ public:
+    /**
+     * Set up the arenas on top of the given resource.
+     *
+     * @param upstream The resource providing the memory for the pool of the arenas.
+     */
+    explicit SearchArena(std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+        : pool(std::make_unique<std::pmr::unsynchronized_pool_resource>(upstream)) { }
+
+    /**
+     * Scope guard of a single level of the search: the level is entered on construction and
+     * released on destruction.
+     */
+    class Frame {
+     public:
+        explicit Frame(SearchArena &arena) : arena(arena) { arena.enter(); }
+        ~Frame() { arena.leave(); }
+
+        Frame(const Frame&) = delete;
+        Frame& operator=(const Frame&) = delete;
+
+     private:
+        SearchArena &arena;
+    };
+
+    /**
+     * Return the arena of the innermost level, or the pool itself if no level is entered.
+     */
+    std::pmr::memory_resource* resource() {
+        if (depth == 0) {
+            return pool.get();
+        }
+        return levels[depth - 1].get();
+    }
+
+ private:
+    std::unique_ptr<std::pmr::unsynchronized_pool_resource> pool;
+    std::vector<std::unique_ptr<std::pmr::monotonic_buffer_resource>> levels;
+    std::size_t depth = 0;
+
+    void enter() {
+        if (levels.size() == depth) {
+            levels.push_back(std::make_unique<std::pmr::monotonic_buffer_resource>(pool.get()));
+        }
+        depth++;
+    }
+
+    void leave() {
+        levels[--depth]->release();
+    }
+};
+
+}  // namespace Koala
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <functional>
 #include <iterator>
 #include <list>
 
@@ -51,6 +52,7 @@ class BinomialHeap {
      public:
         explicit iterator(NetworKit::index data = NetworKit::none) : data(data) { }
         iterator(const iterator &other) : data(other.data) { }
+        iterator& operator=(const iterator &other) = default;
         bool operator==(const iterator &other) { return data == other.data; }
         bool operator!=(const iterator &other) { return !(*this == other); }
         NetworKit::index operator*() const { return data; }
@@ -67,9 +69,22 @@ class BinomialHeap {
     void update(iterator, const value_type&);
     void erase(iterator);
 
+    /**
+     * Move all elements of the other heap into this one, applying to their keys the transform,
+     * which has to preserve their order. Takes time linear in the capacity of the other heap, which
+     * is left empty; its iterators have to be shifted by the returned offset.
+     */
+    template <class Transform = std::identity>
+    NetworKit::index merge(BinomialHeap&, Transform = Transform());
+
     NetworKit::count size() const;
     bool empty() const;
 
+    /**
+     * Return the number of allocated slots, including the ones freed by the removed elements.
+     */
+    NetworKit::count capacity() const;
+
     void check() const;
 };
 
@@ -267,11 +282,50 @@ void BinomialHeap<Key, Compare>::erase(typename BinomialHeap<Key, Compare>::iter
     reserved.push_back(a);
 }
 
+template <class Key, class Compare>
+template <class Transform>
+NetworKit::index BinomialHeap<Key, Compare>::merge(
+        BinomialHeap<Key, Compare> &other, Transform transform) {
+    const NetworKit::index offset = nodes.size();
+    auto shift = [offset](NetworKit::index a) {
+        return a != NetworKit::none ? a + offset : NetworKit::none;
+    };
+    nodes.reserve(offset + other.nodes.size());
+    for (auto &a : other.nodes) {
+        nodes.push_back(a);
+        auto &A = nodes.back();
+        A.parent = shift(A.parent), A.child = shift(A.child), A.next = shift(A.next);
+        A.key = transform(A.key);
+    }
+    for (auto a : other.reserved) {
+        reserved.push_back(a + offset);
+    }
+    auto a = shift(other.root), b = shift(other.minimum);
+    other.clear();
+    if (a == NetworKit::none) {
+        return offset;
+    }
+    if (root == NetworKit::none) {
+        root = a, minimum = b;
+        return offset;
+    }
+    root = join(root, a);
+    if (!function(nodes[b].key, nodes[minimum].key)) {
+        minimum = b;
+    }
+    return offset;
+}
+
 template <class Key, class Compare>
 NetworKit::count BinomialHeap<Key, Compare>::size() const {
     return nodes.size() - reserved.size();
 }
 
+template <class Key, class Compare>
+NetworKit::count BinomialHeap<Key, Compare>::capacity() const {
+    return nodes.size();
+}
+
 template <class Key, class Compare>
 bool BinomialHeap<Key, Compare>::empty() const {
     return root == NetworKit::none;
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <functional>
 #include <iterator>
 #include <list>
 
@@ -47,6 +48,7 @@ class FibonacciHeap {
      public:
         explicit iterator(NetworKit::index data = NetworKit::none) : data(data) { }
         iterator(const iterator &other) : data(other.data) { }
+        iterator& operator=(const iterator &other) = default;
         bool operator==(const iterator &other) { return data == other.data; }
         bool operator!=(const iterator &other) { return !(*this == other); }
         NetworKit::index operator*() const { return data; }
@@ -63,9 +65,22 @@ class FibonacciHeap {
     void update(iterator, const value_type&);
     void erase(iterator);
 
+    /**
+     * Move all elements of the other heap into this one, applying to their keys the transform,
+     * which has to preserve their order. Takes time linear in the capacity of the other heap, which
+     * is left empty; its iterators have to be shifted by the returned offset.
+     */
+    template <class Transform = std::identity>
+    NetworKit::index merge(FibonacciHeap&, Transform = Transform());
+
     NetworKit::count size() const;
     bool empty() const;
 
+    /**
+     * Return the number of allocated slots, including the ones freed by the removed elements.
+     */
+    NetworKit::count capacity() const;
+
     void check() const;
 };
 
@@ -243,11 +258,51 @@ void FibonacciHeap<Key, Compare>::erase(iterator it) {
     root = c, pop();
 }
 
+template <class Key, class Compare>
+template <class Transform>
+NetworKit::index FibonacciHeap<Key, Compare>::merge(
+        FibonacciHeap<Key, Compare> &other, Transform transform) {
+    const NetworKit::index offset = nodes.size();
+    auto shift = [offset](NetworKit::index a) {
+        return a != NetworKit::none ? a + offset : NetworKit::none;
+    };
+    nodes.reserve(offset + other.nodes.size());
+    for (auto &a : other.nodes) {
+        nodes.push_back(a);
+        auto &A = nodes.back();
+        A.parent = shift(A.parent), A.child = shift(A.child);
+        A.previous = shift(A.previous), A.next = shift(A.next);
+        A.key = transform(A.key);
+    }
+    for (auto a : other.reserved) {
+        reserved.push_back(a + offset);
+    }
+    auto a = shift(other.root);
+    other.clear();
+    if (a == NetworKit::none) {
+        return offset;
+    }
+    if (root == NetworKit::none) {
+        root = a;
+        return offset;
+    }
+    insert_node(root, a);
+    if (!function(nodes[a].key, nodes[root].key)) {
+        root = a;
+    }
+    return offset;
+}
+
 template <class Key, class Compare>
 NetworKit::count FibonacciHeap<Key, Compare>::size() const {
     return nodes.size() - reserved.size();
 }
 
+template <class Key, class Compare>
+NetworKit::count FibonacciHeap<Key, Compare>::capacity() const {
+    return nodes.size();
+}
+
 template <class Key, class Compare>
 bool FibonacciHeap<Key, Compare>::empty() const {
     return root == NetworKit::none;
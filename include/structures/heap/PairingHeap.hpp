@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <functional>
 #include <iterator>
 
 namespace Koala {
@@ -45,6 +46,7 @@ class PairingHeap {
      public:
         explicit iterator(NetworKit::index data = NetworKit::none) : data(data) { }
         iterator(const iterator &other) : data(other.data) { }
+        iterator& operator=(const iterator &other) = default;
         bool operator==(const iterator &other) { return data == other.data; }
         bool operator!=(const iterator &other) { return !(*this == other); }
         NetworKit::index operator*() const { return data; }
@@ -61,9 +63,22 @@ class PairingHeap {
     void update(iterator, const value_type&);
     void erase(iterator);
 
+    /**
+     * Move all elements of the other heap into this one, applying to their keys the transform,
+     * which has to preserve their order. Takes time linear in the capacity of the other heap, which
+     * is left empty; its iterators have to be shifted by the returned offset.
+     */
+    template <class Transform = std::identity>
+    NetworKit::index merge(PairingHeap&, Transform = Transform());
+
     NetworKit::count size() const;
     bool empty() const;
 
+    /**
+     * Return the number of allocated slots, including the ones freed by the removed elements.
+     */
+    NetworKit::count capacity() const;
+
     void check() const;
 };
 
@@ -194,11 +209,50 @@ void PairingHeap<Key, Compare>::erase(iterator it) {
     pop();
 }
 
+template <class Key, class Compare>
+template <class Transform>
+NetworKit::index PairingHeap<Key, Compare>::merge(
+        PairingHeap<Key, Compare> &other, Transform transform) {
+    const NetworKit::index offset = nodes.size();
+    auto shift = [offset](NetworKit::index a) {
+        return a != NetworKit::none ? a + offset : NetworKit::none;
+    };
+    nodes.reserve(offset + other.nodes.size());
+    for (auto &a : other.nodes) {
+        nodes.push_back(a);
+        auto &A = nodes.back();
+        A.parent = shift(A.parent), A.child = shift(A.child);
+        A.previous = shift(A.previous), A.next = shift(A.next);
+        A.key = transform(A.key);
+    }
+    for (auto a : other.reserved) {
+        reserved.push_back(a + offset);
+    }
+    auto a = shift(other.root);
+    other.clear();
+    if (a == NetworKit::none) {
+        return offset;
+    }
+    if (root == NetworKit::none) {
+        root = a;
+    } else if (!function(nodes[a].key, nodes[root].key)) {
+        insert_node(a, root), root = a;
+    } else {
+        insert_node(root, a);
+    }
+    return offset;
+}
+
 template <class Key, class Compare>
 NetworKit::count PairingHeap<Key, Compare>::size() const {
     return nodes.size() - reserved.size();
 }
 
+template <class Key, class Compare>
+NetworKit::count PairingHeap<Key, Compare>::capacity() const {
+    return nodes.size();
+}
+
 template <class Key, class Compare>
 bool PairingHeap<Key, Compare>::empty() const {
     return root == NetworKit::none;
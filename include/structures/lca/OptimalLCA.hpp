@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <graph/RootedTree.hpp>
+
 inline constexpr NetworKit::count log2(NetworKit::count n) {
     return n > 1 ? 1 + log2(n >> 1) : 0;
 }
@@ -19,15 +21,16 @@ namespace Koala {
 /**
  * @ingroup lca
  * <O(n), O(1)> algorithm from Bender & Farach-Colton "The LCA Problem Revisited" (2000).
+ * The tree type has to provide the interface of RootedTree.
  */
-template <class T>
+template <class T = RootedTree>
 class OptimalLCA {
  public:
     using depth_t = NetworKit::count;
     using mask_t = NetworKit::index;
 
     // preprocessing in O(|V|) time
-    explicit OptimalLCA(T& tree);
+    explicit OptimalLCA(const T& tree);
 
     // query in O(1) time
     [[nodiscard]] NetworKit::node query(NetworKit::node u, NetworKit::node v) const;
@@ -64,7 +67,7 @@ class OptimalLCA {
     // M in the paper. M[l][j] is the index of minimum element in A_prim[i][l...l+2^j)
     std::vector<std::vector<NetworKit::index>> M;
 
-    void euler_DFS(NetworKit::node u, NetworKit::count level);
+    void euler_tour();
     void populate_precomputed_RMQ_small_blocks();
     void populate_block_arrays();
     void populate_sparse_table();
@@ -79,9 +82,9 @@ class OptimalLCA {
 };
 
 template <class T>
-OptimalLCA<T>::OptimalLCA(T& tree) : tree(tree) {
-    R.assign(tree.getTree().upperNodeIdBound(), NetworKit::none);
-    euler_DFS(tree.getRoot(), 1);
+OptimalLCA<T>::OptimalLCA(const T& tree) : tree(tree) {
+    R.assign(tree.upperNodeIdBound(), NetworKit::none);
+    euler_tour();
     block_size = log2(E.size()) / 2;
     if (block_size >= MIN_ALLOWED_BLOCK_SIZE) {
         populate_precomputed_RMQ_small_blocks();
@@ -118,20 +121,16 @@ void OptimalLCA<T>::verify() const {
     // the label of each node each time it is visited during a DFS. The array of the Euler tour
     // has length 2n-1 because we start at the root and subsequently output a node each time
     // we traverse an edge. We traverse each of the n-1 edges twice, once in each direction."
-    assert(E.size() == 2 * tree.getTree().numberOfNodes() - 1);
+    assert(E.size() == 2 * tree.numberOfNodes() - 1);
 }
 
 template <class T>
-void OptimalLCA<T>::euler_DFS(const NetworKit::node u, const depth_t level) {
-    // We cannot use NetworKit's DFS because it accepts just one handle that is called
-    // during traversing adjacency list before following an edge - but we need the second handle
-    // to call after coming back from the recursion.
-    if (R[u] == NetworKit::none) {
-        R[u] = E.size();
-    }
-    E.push_back(u), L.push_back(level);
-    tree.getTree().forEdgesOf(u, [this, level](NetworKit::node u, NetworKit::node child) {
-        euler_DFS(child, level + 1);
+void OptimalLCA<T>::euler_tour() {
+    E.reserve(2 * tree.numberOfNodes()), L.reserve(2 * tree.numberOfNodes());
+    tree.forEulerTour([this](NetworKit::node u, depth_t level) {
+        if (R[u] == NetworKit::none) {
+            R[u] = E.size();
+        }
         E.push_back(u), L.push_back(level);
     });
 }
@@ -13,13 +13,15 @@
 
 #include <networkit/graph/Graph.hpp>
 
+#include <graph/GraphConcept.hpp>
+
 namespace Koala {
 
 namespace Traversal {
 
-template <typename Predicate>
+template <ReadOnlyGraph Graph, typename Predicate>
 bool BFS(
-        const NetworKit::Graph &G, NetworKit::node source, NetworKit::node target,
+        const Graph &G, NetworKit::node source, NetworKit::node target,
         Predicate predicate) {
     std::queue<NetworKit::node> Q({source});
     std::vector<bool> marked(G.upperNodeIdBound());
@@ -40,9 +42,9 @@ bool BFS(
     return false;
 }
 
-template <typename Predicate>
+template <ReadOnlyGraph Graph, typename Predicate>
 std::vector<NetworKit::node> BFSPath(
-        const NetworKit::Graph &G, NetworKit::node source, NetworKit::node target,
+        const Graph &G, NetworKit::node source, NetworKit::node target,
         Predicate predicate) {
     std::queue<NetworKit::node> Q({source});
     std::map<NetworKit::node, NetworKit::node> parent;
@@ -12,13 +12,15 @@
 
 #include <networkit/graph/Graph.hpp>
 
+#include <graph/GraphConcept.hpp>
+
 namespace Koala {
 
 namespace Traversal {
 
-template <typename Action, typename Predicate>
+template <ReadOnlyGraph Graph, typename Action, typename Predicate>
 void DFSFrom(
-        const NetworKit::Graph &G, NetworKit::node source,
+        const Graph &G, NetworKit::node source,
         Action action, Predicate predicate) {
     std::stack<NetworKit::node> Q({source});
     std::vector<bool> marked(G.upperNodeIdBound());
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <stop_token>
+
 #include <dominating_set/ExactDominatingSet.hpp>
 #include <set_cover/BranchAndReduceSetCover.hpp>
 
@@ -95,7 +97,45 @@ TEST_P(SchiermeyerTest, test) {
     auto algorithm = Koala::SchiermeyerDominatingSet(G);
     algorithm.run();
     algorithm.check();
+    EXPECT_TRUE(algorithm.isOptimal());
     EXPECT_EQ(parameters.minimumDominatingSetSize, algorithm.getDominatingSet().size());
 }
 
 INSTANTIATE_TEST_SUITE_P(test_example, SchiermeyerTest, testing::Values(parameter_set));
+
+TEST(SchiermeyerTest, interrupted) {
+    NetworKit::Graph G = build_graph(parameter_set.N, parameter_set.E, false);
+    std::stop_source source;
+    source.request_stop();
+    auto algorithm = Koala::SchiermeyerDominatingSet(G);
+    algorithm.setStopToken(source.get_token());
+    algorithm.run();
+    algorithm.check();
+    EXPECT_TRUE(algorithm.isInterrupted());
+    EXPECT_FALSE(algorithm.isOptimal());
+    EXPECT_LE(parameter_set.minimumDominatingSetSize, algorithm.getDominatingSet().size());
+}
+
+template <typename SetCover>
+void test_interrupted_set_cover() {
+    NetworKit::Graph G = build_graph(parameter_set.N, parameter_set.E, false);
+    std::stop_source source;
+    source.request_stop();
+    auto algorithm = Koala::BranchAndReduceDominatingSet<SetCover>(G);
+    algorithm.setStopToken(source.get_token());
+    algorithm.run();
+    algorithm.check();
+    EXPECT_TRUE(algorithm.isInterrupted());
+    EXPECT_FALSE(algorithm.isOptimal());
+    EXPECT_LE(parameter_set.minimumDominatingSetSize, algorithm.getDominatingSet().size());
+    algorithm.setStopToken(std::stop_token());
+    algorithm.run();
+    EXPECT_TRUE(algorithm.isOptimal());
+    EXPECT_EQ(parameter_set.minimumDominatingSetSize, algorithm.getDominatingSet().size());
+}
+
+TEST(BranchAndReduceTest, interrupted) {
+    test_interrupted_set_cover<Koala::GrandoniSetCover>();
+    test_interrupted_set_cover<Koala::FominGrandoniKratschSetCover>();
+    test_interrupted_set_cover<Koala::RooijBodlaenderSetCover>();
+}
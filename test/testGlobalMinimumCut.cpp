@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <memory>
+#include <stop_token>
+#include <tuple>
+
+#include <flow/GlobalMinimumCut.hpp>
+#include <generator/GraphGenerator.hpp>
+
+#include "helpers.hpp"
+
+struct GlobalMinimumCutParameters {
+    int N;
+    std::list<std::tuple<int, int, int>> EW;
+    int cut;
+};
+
+template <class Algorithm>
+class GlobalMinimumCutTest : public testing::TestWithParam<GlobalMinimumCutParameters> {
+ public:
+    void test_cut() {
+        const auto &parameters = GetParam();
+        auto G = build_graph(parameters.N, parameters.EW, false);
+        auto algorithm = Algorithm(G);
+        algorithm.run();
+        algorithm.check();
+        EXPECT_EQ(algorithm.getCutSize(), parameters.cut);
+    }
+};
+
+auto example_cuts = testing::Values(
+    GlobalMinimumCutParameters{
+        8, {{0, 1, 2}, {0, 4, 3}, {1, 2, 3}, {1, 4, 2}, {1, 5, 2}, {2, 3, 4}, {2, 6, 2},
+            {3, 6, 2}, {3, 7, 2}, {4, 5, 3}, {5, 6, 1}, {6, 7, 3}}, 4},
+    GlobalMinimumCutParameters{
+        8, {{0, 1, 5}, {0, 2, 5}, {0, 3, 5}, {1, 2, 5}, {1, 3, 5}, {2, 3, 5},
+            {4, 5, 5}, {4, 6, 5}, {4, 7, 5}, {5, 6, 5}, {5, 7, 5}, {6, 7, 5}, {3, 4, 2}}, 2},
+    GlobalMinimumCutParameters{
+        5, {{0, 1, 7}, {1, 2, 7}, {2, 0, 7}, {3, 4, 1}}, 0},
+    GlobalMinimumCutParameters{
+        4, {{0, 1, 1}, {1, 2, 10}, {2, 3, 10}, {3, 0, 10}, {0, 0, 100}}, 11}
+);
+
+class StoerWagnerGlobalMinimumCutTest
+    : public GlobalMinimumCutTest<Koala::StoerWagnerGlobalMinimumCut> { };
+
+TEST_P(StoerWagnerGlobalMinimumCutTest, test_example) {
+    test_cut();
+}
+
+INSTANTIATE_TEST_SUITE_P(test_example, StoerWagnerGlobalMinimumCutTest, example_cuts);
+
+class NagamochiIbarakiGlobalMinimumCutTest
+    : public GlobalMinimumCutTest<Koala::NagamochiIbarakiGlobalMinimumCut> { };
+
+TEST_P(NagamochiIbarakiGlobalMinimumCutTest, test_example) {
+    test_cut();
+}
+
+INSTANTIATE_TEST_SUITE_P(test_example, NagamochiIbarakiGlobalMinimumCutTest, example_cuts);
+
+class KargerSteinGlobalMinimumCutTest
+    : public GlobalMinimumCutTest<Koala::KargerSteinGlobalMinimumCut> { };
+
+TEST_P(KargerSteinGlobalMinimumCutTest, test_example) {
+    test_cut();
+}
+
+INSTANTIATE_TEST_SUITE_P(test_example, KargerSteinGlobalMinimumCutTest, example_cuts);
+
+TEST(GlobalMinimumCutTest, RandomGraphs) {
+    for (uint64_t seed = 1; seed <= 5; seed++) {
+        auto G = Koala::GridGenerator(8, 9, 0.9, 20, seed).generate();
+        auto stoer_wagner = Koala::StoerWagnerGlobalMinimumCut(G);
+        stoer_wagner.run();
+        stoer_wagner.check();
+        EXPECT_TRUE(stoer_wagner.isOptimal());
+        auto nagamochi_ibaraki = Koala::NagamochiIbarakiGlobalMinimumCut(G);
+        nagamochi_ibaraki.run();
+        nagamochi_ibaraki.check();
+        EXPECT_TRUE(nagamochi_ibaraki.isOptimal());
+        EXPECT_EQ(stoer_wagner.getCutSize(), nagamochi_ibaraki.getCutSize());
+        auto karger_stein = Koala::KargerSteinGlobalMinimumCut(G, 0, seed);
+        karger_stein.run();
+        karger_stein.check();
+        EXPECT_FALSE(karger_stein.isOptimal());
+        EXPECT_GE(karger_stein.getCutSize(), stoer_wagner.getCutSize());
+    }
+}
+
+TEST(GlobalMinimumCutTest, KargerSteinDeterministic) {
+    auto G = Koala::ErdosRenyiGenerator(60, 0.2, false, 3).generate();
+    auto first = Koala::KargerSteinGlobalMinimumCut(G, 8, 17);
+    first.run();
+    auto second = Koala::KargerSteinGlobalMinimumCut(G, 8, 17);
+    second.run();
+    EXPECT_EQ(first.getCutSize(), second.getCutSize());
+    EXPECT_EQ(first.getCut(), second.getCut());
+}
+
+TEST(GlobalMinimumCutTest, KargerSteinInterrupted) {
+    auto G = Koala::ErdosRenyiGenerator(60, 0.2, false, 3).generate();
+    std::stop_source source;
+    source.request_stop();
+    auto interrupted = Koala::KargerSteinGlobalMinimumCut(G, 8, 17);
+    interrupted.setStopToken(source.get_token());
+    interrupted.run();
+    interrupted.check();
+    EXPECT_TRUE(interrupted.isInterrupted());
+    EXPECT_FALSE(interrupted.isOptimal());
+    auto single = Koala::KargerSteinGlobalMinimumCut(G, 1, 17);
+    single.run();
+    EXPECT_EQ(interrupted.getCutSize(), single.getCutSize());
+    EXPECT_EQ(interrupted.getCut(), single.getCut());
+    interrupted.setStopToken(std::stop_token());
+    interrupted.run();
+    EXPECT_FALSE(interrupted.isInterrupted());
+}
+
+TEST(GlobalMinimumCutTest, SharedGraph) {
+    auto G = Koala::GridGenerator(6, 7, 0.9, 20, 4).generate();
+    auto shared = std::make_shared<const NetworKit::Graph>(G);
+    auto stoer_wagner = Koala::StoerWagnerGlobalMinimumCut(shared);
+    auto karger_stein = Koala::KargerSteinGlobalMinimumCut(shared, 4, 5);
+    EXPECT_EQ(shared.use_count(), 3);
+    auto nagamochi_ibaraki = Koala::NagamochiIbarakiGlobalMinimumCut(Koala::borrow(G));
+    stoer_wagner.run(), karger_stein.run(), nagamochi_ibaraki.run();
+    stoer_wagner.check(), karger_stein.check(), nagamochi_ibaraki.check();
+    EXPECT_EQ(stoer_wagner.getCutSize(), nagamochi_ibaraki.getCutSize());
+    EXPECT_GE(karger_stein.getCutSize(), stoer_wagner.getCutSize());
+}
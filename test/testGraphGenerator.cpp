@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <omp.h>
+
+#include <cmath>
+#include <memory>
+#include <set>
+#include <tuple>
+#include <vector>
+
+#include <flow/MaximumFlow.hpp>
+#include <generator/GraphGenerator.hpp>
+#include <io/DimacsGraphReader.hpp>
+#include <io/DimacsGraphWriter.hpp>
+
+#include "helpers.hpp"
+
+using EdgeList = std::vector<std::tuple<NetworKit::node, NetworKit::node, NetworKit::edgeweight>>;
+
+EdgeList stream_edges(const Koala::GraphGenerator &generator, int threads) {
+    int previous = omp_get_max_threads();
+    omp_set_num_threads(threads);
+    EdgeList edges;
+    generator.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        edges.emplace_back(u, v, w);
+    });
+    omp_set_num_threads(previous);
+    return edges;
+}
+
+class GraphGeneratorDeterminismTest
+    : public testing::TestWithParam<std::shared_ptr<Koala::GraphGenerator>> { };
+
+TEST_P(GraphGeneratorDeterminismTest, test) {
+    const auto &generator = *GetParam();
+    auto edges = stream_edges(generator, 1);
+    EXPECT_EQ(edges, stream_edges(generator, 4));
+    EXPECT_EQ(edges.size(), generator.numberOfEdges());
+    for (const auto &[u, v, w] : edges) {
+        EXPECT_LT(u, generator.numberOfNodes());
+        EXPECT_LT(v, generator.numberOfNodes());
+        EXPECT_NE(u, v);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    test_small, GraphGeneratorDeterminismTest, testing::Values(
+        std::make_shared<Koala::ErdosRenyiGenerator>(10000, 0.001, false, 1),
+        std::make_shared<Koala::ErdosRenyiGenerator>(5000, 0.002, true, 2),
+        std::make_shared<Koala::RmatGenerator>(13, 4, 0.57, 0.19, 0.19, 3),
+        std::make_shared<Koala::RandomGeometricGenerator>(10000, 0.02, 4),
+        std::make_shared<Koala::GridGenerator>(100, 150, 0.9, 1000, 5),
+        std::make_shared<Koala::RandomIntervalGenerator>(10000, 0.001, 6),
+        std::make_shared<Koala::AKFlowNetworkGenerator>(100),
+        std::make_shared<Koala::WashingtonFlowNetworkGenerator>(60, 80, 1000, 7),
+        std::make_shared<Koala::SegmentationFlowNetworkGenerator>(50, 40, 3, 100, 8)
+));
+
+TEST(GraphGeneratorTest, ErdosRenyiEdgeCount) {
+    const NetworKit::count n = 20000;
+    const double p = 0.001;
+    auto m = static_cast<double>(Koala::ErdosRenyiGenerator(n, p, false, 42).numberOfEdges());
+    double expected = p * static_cast<double>(n * (n - 1) / 2);
+    EXPECT_LT(std::abs(m - expected), 5 * std::sqrt(expected));
+    EXPECT_EQ(Koala::ErdosRenyiGenerator(100, 1.0).numberOfEdges(), 100 * 99 / 2);
+    EXPECT_EQ(Koala::ErdosRenyiGenerator(100, 1.0, true).numberOfEdges(), 100 * 99);
+    EXPECT_EQ(Koala::ErdosRenyiGenerator(100, 0.0).numberOfEdges(), 0);
+}
+
+TEST(GraphGeneratorTest, DifferentSeeds) {
+    EXPECT_NE(
+        stream_edges(Koala::ErdosRenyiGenerator(1000, 0.01, false, 1), 1),
+        stream_edges(Koala::ErdosRenyiGenerator(1000, 0.01, false, 2), 1));
+}
+
+TEST(GraphGeneratorTest, Grid) {
+    auto G = Koala::GridGenerator(30, 40).generate();
+    EXPECT_EQ(G.numberOfNodes(), 30 * 40);
+    EXPECT_EQ(G.numberOfEdges(), 30 * 39 + 29 * 40);
+    EXPECT_TRUE(G.hasEdge(0, 1));
+    EXPECT_TRUE(G.hasEdge(0, 40));
+    EXPECT_FALSE(G.hasEdge(39, 40));
+}
+
+TEST(GraphGeneratorTest, ZeroMaximumWeight) {
+    EXPECT_THROW(Koala::GridGenerator(3, 4, 1.0, 0), std::invalid_argument);
+    EXPECT_THROW(Koala::WashingtonFlowNetworkGenerator(3, 4, 0), std::invalid_argument);
+}
+
+TEST(GraphGeneratorTest, RandomGeometric) {
+    const NetworKit::count n = 500;
+    const double radius = 0.1;
+    Koala::RandomGeometricGenerator generator(n, radius, 7);
+    auto G = generator.generate();
+    NetworKit::count m = 0;
+    G.forEdges([&](NetworKit::node, NetworKit::node, NetworKit::edgeweight w) {
+        EXPECT_LE(w, radius);
+        m++;
+    });
+    // the edge weights are the distances, so every pair closer than radius has to be present
+    auto brute = Koala::RandomGeometricGenerator(n, 2.0, 7).generate();
+    NetworKit::count expected = 0;
+    brute.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        if (w <= radius) {
+            EXPECT_TRUE(G.hasEdge(u, v));
+            expected++;
+        }
+    });
+    EXPECT_EQ(m, expected);
+}
+
+TEST(GraphGeneratorTest, RmatWithoutParallelEdges) {
+    auto G = Koala::RmatGenerator(10, 8, 0.57, 0.19, 0.19, 11).generate();
+    EXPECT_EQ(G.numberOfNodes(), 1024);
+    EXPECT_GT(G.numberOfEdges(), 0);
+    G.forNodes([&](NetworKit::node u) {
+        std::set<NetworKit::node> neighbors;
+        G.forNeighborsOf(u, [&](NetworKit::node v) {
+            EXPECT_TRUE(neighbors.insert(v).second);
+        });
+    });
+}
+
+TEST(GraphGeneratorTest, AKFlowNetwork) {
+    const NetworKit::count k = 50;
+    Koala::AKFlowNetworkGenerator generator(k);
+    auto G = generator.generate();
+    auto algorithm = Koala::KingRaoTarjanMaximumFlow(
+        G, generator.getSource(), generator.getTarget());
+    algorithm.run();
+    EXPECT_EQ(algorithm.getFlowSize(), 2 * k);
+}
+
+TEST(GraphGeneratorTest, StreamToDimacs) {
+    Koala::WashingtonFlowNetworkGenerator generator(8, 10, 100, 13);
+    std::string path = generate_filename("input");
+    Koala::DimacsGraphWriter().write(generator, path);
+    auto [G, s, t] = Koala::DimacsGraphReader().read_all(path);
+    remove(path.data());
+    EXPECT_EQ(s, generator.getSource());
+    EXPECT_EQ(t, generator.getTarget());
+    auto H = generator.generate();
+    EXPECT_EQ(G.numberOfNodes(), H.numberOfNodes());
+    EXPECT_EQ(G.numberOfEdges(), H.numberOfEdges());
+    H.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        EXPECT_EQ(G.weight(u, v), w);
+    });
+    auto from_file = Koala::KingRaoTarjanMaximumFlow(G, s, t);
+    from_file.run();
+    auto generated = Koala::KingRaoTarjanMaximumFlow(H, s, t);
+    generated.run();
+    EXPECT_EQ(from_file.getFlowSize(), generated.getFlowSize());
+}
@@ -1,15 +1,30 @@
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <fstream>
 #include <list>
-
+#include <memory>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <zlib.h>
+#ifdef KOALA_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#include <io/BinaryEdgeListReader.hpp>
+#include <io/BinaryEdgeListWriter.hpp>
 #include <io/D6GraphReader.hpp>
 #include <io/D6GraphWriter.hpp>
+#include <io/DecompressingStream.hpp>
 #include <io/DimacsBinaryGraphReader.hpp>
 #include <io/DimacsBinaryGraphWriter.hpp>
 #include <io/DimacsGraphReader.hpp>
 #include <io/DimacsGraphWriter.hpp>
 #include <io/G6GraphReader.hpp>
 #include <io/G6GraphWriter.hpp>
+#include <io/GraphCorpusWriter.hpp>
 #include <io/S6GraphReader.hpp>
 #include <io/S6GraphWriter.hpp>
 
@@ -51,6 +66,12 @@ class GraphWriterToDimacsTest
 class GraphWriterToDimacsBinaryTest
     : public testing::TestWithParam<GraphIOParameters> { };
 
+class GraphBinaryEdgeListTest
+    : public testing::TestWithParam<GraphIOParameters> { };
+
+class GraphCorpusWriterTest
+    : public testing::TestWithParam<Koala::GraphCorpusWriter::Format> { };
+
 TEST_P(GraphReaderFromDigraph6Test, test) {
     GraphIOParameters const& parameters = GetParam();
     NetworKit::Graph G = Koala::D6GraphReader().readline(parameters.G);
@@ -86,7 +107,9 @@ INSTANTIATE_TEST_SUITE_P(
         GraphIOParameters{
             "GCQR@O", 8, {{3, 0}, {4, 1}, {5, 0}, {5, 3}, {6, 1}, {6, 2}, {7, 2}, {7, 4}}},
         GraphIOParameters{
-            "Fw??G", 7, {{1, 0}, {2, 0}, {2, 1}, {6, 5}}}
+            "Fw??G", 7, {{1, 0}, {2, 0}, {2, 1}, {6, 5}}},
+        GraphIOParameters{
+            "C~", 4, {{1, 0}, {2, 0}, {2, 1}, {3, 0}, {3, 1}, {3, 2}}}
 ));
 
 TEST_P(GraphReaderFromSparse6Test, test) {
@@ -183,7 +206,9 @@ INSTANTIATE_TEST_SUITE_P(
         GraphIOParameters{
             "GCQR@O", 8, {{3, 0}, {4, 1}, {5, 0}, {5, 3}, {6, 1}, {6, 2}, {7, 2}, {7, 4}}},
         GraphIOParameters{
-            "Fw??G", 7, {{1, 0}, {2, 0}, {2, 1}, {6, 5}}}
+            "Fw??G", 7, {{1, 0}, {2, 0}, {2, 1}, {6, 5}}},
+        GraphIOParameters{
+            "C~", 4, {{1, 0}, {2, 0}, {2, 1}, {3, 0}, {3, 1}, {3, 2}}}
 ));
 
 TEST_P(GraphWriterToSparse6Test, test) {
@@ -249,3 +274,279 @@ INSTANTIATE_TEST_SUITE_P(
              {8, 5}, {8, 6}, {9, 0}, {9, 2}, {9, 3}, {9, 5}, {9, 6}, {9, 8}, {10, 1},
              {10, 2}, {10, 3}, {10, 5}, {10, 6}}}
 ));
+
+TEST_P(GraphBinaryEdgeListTest, test) {
+    GraphIOParameters const& parameters = GetParam();
+    NetworKit::Graph G(parameters.N, true, false);
+    NetworKit::edgeweight w = 0.5;
+    for (const auto &[u, v] : parameters.E) {
+        G.addEdge(u, v, w++);
+    }
+    std::string path = generate_filename("input");
+    Koala::BinaryEdgeListWriter().write(G, path);
+    {
+        Koala::MappedBinaryEdgeList edges(path);
+        EXPECT_EQ(edges.numberOfNodes(), parameters.N);
+        EXPECT_EQ(edges.numberOfEdges(), parameters.E.size());
+    }
+    auto H = Koala::BinaryEdgeListReader().read(path);
+    remove(path.data());
+    EXPECT_EQ(H.numberOfNodes(), parameters.N);
+    EXPECT_EQ(H.numberOfEdges(), parameters.E.size());
+    G.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        EXPECT_EQ(H.weight(u, v), w);
+    });
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    test_small, GraphBinaryEdgeListTest, testing::Values(
+        GraphIOParameters{"", 1, {}},
+        GraphIOParameters{
+            "", 8, {{4, 0}, {4, 1}, {5, 0}, {5, 1}, {6, 2}, {6, 3}, {7, 2}, {7, 3}}}
+));
+
+TEST(GraphBinaryEdgeListTest, invalid) {
+    std::string path = generate_filename("input");
+    Koala::BinaryEdgeListWriter().write(2, [](const auto &callback) {
+        callback(0, 1, 1.0), callback(0, 5, 1.0);
+    }, path);
+    EXPECT_THROW(Koala::MappedBinaryEdgeList edges(path), std::runtime_error);
+    Koala::BinaryEdgeListWriter().write(2, [](const auto &callback) {
+        callback(0, 1, 1.0);
+    }, path);
+    {
+        // the number of edges such that its size in bytes overflows
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        uint64_t edges = uint64_t(1) << 60;
+        file.seekp(offsetof(Koala::BinaryEdgeListHeader, edges));
+        file.write(reinterpret_cast<const char*>(&edges), sizeof(edges));
+    }
+    EXPECT_THROW(Koala::MappedBinaryEdgeList edges(path), std::runtime_error);
+    remove(path.data());
+    EXPECT_THROW(Koala::BinaryEdgeListWriter().write(
+        NetworKit::Graph(2), "/dev/full"), std::runtime_error);
+}
+
+// A sequence of graphs on the same vertices, each differing from the previous one in a few edges.
+std::vector<NetworKit::Graph> random_walk_graphs(int n, int count, int changes, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    std::uniform_int_distribution<int> vertex(0, n - 1);
+    std::vector<NetworKit::Graph> graphs;
+    NetworKit::Graph G(n, false, false);
+    for (int i = 0; i < count; i++) {
+        for (int j = 0; j < changes; j++) {
+            int u = vertex(generator), v = vertex(generator);
+            if (u == v) {
+                continue;
+            }
+            if (G.hasEdge(u, v)) {
+                G.removeEdge(u, v);
+            } else {
+                G.addEdge(u, v);
+            }
+        }
+        graphs.push_back(G);
+    }
+    return graphs;
+}
+
+TEST_P(GraphCorpusWriterTest, test) {
+    auto format = GetParam();
+    auto graphs = random_walk_graphs(70, 50, 10, 1);
+    graphs.push_back(NetworKit::Graph(5, false, false));
+    graphs.back().addEdge(0, 4);
+    std::string path = generate_filename("input");
+    {
+        Koala::GraphCorpusWriter writer(path, format, 64);
+        for (int i = 0; i < 10; i++) {
+            writer.write(graphs[i]);
+        }
+        writer.write(std::vector<NetworKit::Graph>(graphs.begin() + 10, graphs.end() - 5));
+        // the graphs after a batch are encoded against its last graph
+        for (auto it = graphs.end() - 5; it != graphs.end(); ++it) {
+            writer.write(*it);
+        }
+        EXPECT_EQ(writer.numberOfGraphs(), graphs.size());
+    }
+    std::ifstream file(path);
+    std::string line;
+    NetworKit::Graph previous;
+    for (const auto &G : graphs) {
+        ASSERT_TRUE(std::getline(file, line));
+        NetworKit::Graph H;
+        if (format == Koala::GraphCorpusWriter::Format::GRAPH6) {
+            H = Koala::G6GraphReader().readline(line);
+        } else {
+            H = Koala::S6GraphReader().readline(line, previous);
+        }
+        EXPECT_EQ(H.numberOfNodes(), G.numberOfNodes());
+        EXPECT_EQ(H.numberOfEdges(), G.numberOfEdges());
+        G.forEdges([&](NetworKit::node u, NetworKit::node v) {
+            EXPECT_TRUE(H.hasEdge(u, v));
+        });
+        previous = H;
+    }
+    EXPECT_FALSE(std::getline(file, line));
+    file.close();
+    remove(path.data());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    test_small, GraphCorpusWriterTest, testing::Values(
+        Koala::GraphCorpusWriter::Format::GRAPH6,
+        Koala::GraphCorpusWriter::Format::SPARSE6,
+        Koala::GraphCorpusWriter::Format::INCREMENTAL_SPARSE6
+));
+
+TEST(GraphCorpusWriterIncrementalTest, smaller) {
+    auto graphs = random_walk_graphs(100, 20, 5, 2);
+    std::ostringstream sparse6, incremental;
+    {
+        Koala::GraphCorpusWriter writer(sparse6, Koala::GraphCorpusWriter::Format::SPARSE6);
+        writer.write(graphs);
+    }
+    {
+        Koala::GraphCorpusWriter writer(
+            incremental, Koala::GraphCorpusWriter::Format::INCREMENTAL_SPARSE6);
+        writer.write(graphs);
+    }
+    EXPECT_LT(incremental.str().size(), sparse6.str().size());
+    EXPECT_EQ(incremental.str().find(';'), incremental.str().find('\n') + 1);
+}
+
+// Append the data to the file as a separate gzip member.
+void append_gzip(const std::string &path, const std::string &data) {
+    gzFile file = gzopen(path.c_str(), "ab");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(gzwrite(file, data.data(), static_cast<unsigned>(data.size())), data.size());
+    gzclose(file);
+}
+
+std::string read_file(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// Decompress the whole file in blocks of the given size.
+std::string decompress_file(
+        const std::string &path, Koala::Compression compression, NetworKit::count block_size) {
+    Koala::DecompressingStreamBuf buffer(
+        std::make_unique<std::ifstream>(path, std::ios::binary), compression, block_size);
+    return std::string(
+        std::istreambuf_iterator<char>(&buffer), std::istreambuf_iterator<char>());
+}
+
+void expect_same_graph(const NetworKit::Graph &G, const NetworKit::Graph &H) {
+    EXPECT_EQ(H.numberOfNodes(), G.numberOfNodes());
+    EXPECT_EQ(H.numberOfEdges(), G.numberOfEdges());
+    G.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        EXPECT_TRUE(H.hasEdge(u, v));
+        EXPECT_EQ(H.weight(u, v), w);
+    });
+}
+
+TEST(GraphReaderCompressedTest, readers) {
+    std::string path = generate_filename("input");
+    append_gzip(path, read_file("input/example_1.col"));
+    EXPECT_EQ(Koala::detectCompression(path), Koala::Compression::GZIP);
+    EXPECT_EQ(Koala::detectCompression("input/example_1.col"), Koala::Compression::NONE);
+    expect_same_graph(
+        Koala::DimacsGraphReader().read("input/example_1.col"),
+        Koala::DimacsGraphReader().read(path));
+    remove(path.data());
+
+    append_gzip(path, read_file("input/example_1.col.b"));
+    expect_same_graph(
+        Koala::DimacsBinaryGraphReader().read("input/example_1.col.b"),
+        Koala::DimacsBinaryGraphReader().read(path));
+    remove(path.data());
+
+    append_gzip(path, read_file("input/graph5.g6"));
+    expect_same_graph(
+        Koala::G6GraphReader().read("input/graph5.g6"), Koala::G6GraphReader().read(path));
+    remove(path.data());
+}
+
+TEST(GraphReaderCompressedTest, stream) {
+    std::string path = generate_filename("input"), expected;
+    std::mt19937_64 generator(1);
+    for (int member = 0; member < 3; member++) {
+        std::string data;
+        for (int i = 0; i < 300000; i++) {
+            data += std::to_string(generator() % 1000) + (i % 10 == 9 ? "\n" : " ");
+        }
+        append_gzip(path, data);
+        expected += data;
+    }
+    {
+        Koala::InputFileStream file(path);
+        EXPECT_TRUE(file.is_open());
+        std::string actual(
+            (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        EXPECT_EQ(actual, expected);
+    }
+    {
+        // closing the stream before the end of the input stops the decompression
+        Koala::InputFileStream file(path);
+        std::string word;
+        file >> word;
+        EXPECT_EQ(word, expected.substr(0, word.size()));
+    }
+    remove(path.data());
+}
+
+TEST(GraphReaderCompressedTest, corrupted) {
+    std::string path = generate_filename("input"), data(100000, 'a');
+    append_gzip(path, data);
+    std::string compressed = read_file(path);
+    std::ofstream(path, std::ios::binary | std::ios::trunc)
+        .write(compressed.data(), static_cast<std::streamsize>(compressed.size() / 2));
+    EXPECT_THROW({
+        Koala::InputFileStream file(path);
+        std::string word;
+        while (file >> word) { }
+    }, std::runtime_error);
+    remove(path.data());
+    EXPECT_FALSE(Koala::InputFileStream(path).is_open());
+}
+
+TEST(GraphReaderCompressedTest, exactBlocks) {
+    // the members end exactly at the ends of the decompressed blocks
+    const NetworKit::count BLOCK_SIZE = 16;
+    std::string path = generate_filename("input"), expected;
+    for (NetworKit::count size : {4 * BLOCK_SIZE, BLOCK_SIZE}) {
+        std::string data(size, 'a' + static_cast<char>(expected.size() % 26));
+        append_gzip(path, data);
+        expected += data;
+        EXPECT_EQ(decompress_file(path, Koala::Compression::GZIP, BLOCK_SIZE), expected);
+    }
+    std::string compressed = read_file(path);
+    std::ofstream(path, std::ios::binary | std::ios::trunc)
+        .write(compressed.data(), static_cast<std::streamsize>(compressed.size() - 4));
+    EXPECT_THROW(decompress_file(path, Koala::Compression::GZIP, BLOCK_SIZE), std::runtime_error);
+    remove(path.data());
+}
+
+#ifdef KOALA_HAVE_ZSTD
+TEST(GraphReaderCompressedTest, zstd) {
+    const NetworKit::count BLOCK_SIZE = 16;
+    std::string path = generate_filename("input"), expected, compressed;
+    for (NetworKit::count size : {4 * BLOCK_SIZE, 1000 * BLOCK_SIZE + 3}) {
+        std::string data(size, 'a' + static_cast<char>(expected.size() % 26)), frame;
+        frame.resize(ZSTD_compressBound(data.size()));
+        frame.resize(ZSTD_compress(frame.data(), frame.size(), data.data(), data.size(), 3));
+        compressed += frame, expected += data;
+        std::ofstream(path, std::ios::binary | std::ios::trunc)
+            .write(compressed.data(), static_cast<std::streamsize>(compressed.size()));
+        EXPECT_EQ(Koala::detectCompression(path), Koala::Compression::ZSTD);
+        EXPECT_EQ(decompress_file(path, Koala::Compression::ZSTD, BLOCK_SIZE), expected);
+        Koala::InputFileStream file(path);
+        EXPECT_EQ(std::string(
+            std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()), expected);
+    }
+    std::ofstream(path, std::ios::binary | std::ios::trunc)
+        .write(compressed.data(), static_cast<std::streamsize>(compressed.size() - 4));
+    EXPECT_THROW(decompress_file(path, Koala::Compression::ZSTD, BLOCK_SIZE), std::runtime_error);
+    remove(path.data());
+}
+#endif
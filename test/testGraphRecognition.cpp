@@ -1,8 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <fstream>
 #include <list>
+#include <string>
 
+#include <io/G6GraphReader.hpp>
 #include <recognition/PerfectGraphRecognition.hpp>
+#include <recognition/PlanarGraphRecognition.hpp>
 
 #include "helpers.hpp"
 
@@ -15,6 +19,9 @@ struct GraphRecognitionParameters {
 class PerfectGraphRecognitionTest
     : public testing::TestWithParam<GraphRecognitionParameters> { };
 
+class PlanarGraphRecognitionTest
+    : public testing::TestWithParam<GraphRecognitionParameters> { };
+
 TEST_P(PerfectGraphRecognitionTest, test) {
     GraphRecognitionParameters const& parameters = GetParam();
     NetworKit::Graph G = build_graph(parameters.N, parameters.E, false);
@@ -30,3 +37,106 @@ INSTANTIATE_TEST_SUITE_P(
         GraphRecognitionParameters{4, {{0, 1}, {0, 2}, {1, 3}, {2, 3}}, true},
         GraphRecognitionParameters{5, {{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0}}, false}
 ));
+
+TEST_P(PlanarGraphRecognitionTest, test) {
+    GraphRecognitionParameters const& parameters = GetParam();
+    NetworKit::Graph G = build_graph(parameters.N, parameters.E, false);
+    auto algorithm = Koala::PlanarGraphRecognition(G);
+    algorithm.run();
+    algorithm.check();
+    EXPECT_EQ(algorithm.isPlanar(), parameters.is_recognized);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    test_example, PlanarGraphRecognitionTest, testing::Values(
+        GraphRecognitionParameters{1, {}, true},
+        GraphRecognitionParameters{4, {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}}, true},
+        GraphRecognitionParameters{
+            5, {{0, 1}, {0, 2}, {0, 3}, {0, 4}, {1, 2}, {1, 3}, {1, 4}, {2, 3}, {2, 4}}, true},
+        GraphRecognitionParameters{
+            5, {{0, 1}, {0, 2}, {0, 3}, {0, 4}, {1, 2}, {1, 3}, {1, 4}, {2, 3}, {2, 4}, {3, 4}},
+            false},
+        GraphRecognitionParameters{
+            6, {{0, 3}, {0, 4}, {0, 5}, {1, 3}, {1, 4}, {1, 5}, {2, 3}, {2, 4}, {2, 5}}, false},
+        GraphRecognitionParameters{
+            8, {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {4, 5}, {5, 6}, {6, 7}, {7, 4}, {0, 4}, {1, 5},
+                {2, 6}, {3, 7}}, true},
+        GraphRecognitionParameters{
+            10, {{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0}, {0, 5}, {1, 6}, {2, 7}, {3, 8}, {4, 9},
+                 {5, 7}, {7, 9}, {9, 6}, {6, 8}, {8, 5}}, false},
+        GraphRecognitionParameters{
+            9, {{0, 1}, {1, 2}, {2, 0}, {3, 4}, {5, 6}, {6, 7}, {7, 8}, {8, 5}, {5, 7}, {0, 0},
+                {1, 0}}, true}
+));
+
+NetworKit::count count_planar(const std::string &path) {
+    std::ifstream file(path);
+    std::string line;
+    NetworKit::count planar = 0;
+    while (std::getline(file, line)) {
+        auto algorithm = Koala::PlanarGraphRecognition(Koala::G6GraphReader().readline(line));
+        algorithm.run();
+        algorithm.check();
+        planar += algorithm.isPlanar();
+    }
+    return planar;
+}
+
+TEST(PlanarGraphRecognitionCorpusTest, test) {
+    EXPECT_EQ(count_planar("input/planar_conn.5.g6"), 20);
+    EXPECT_EQ(count_planar("input/planar_conn.6.g6"), 99);
+    EXPECT_EQ(count_planar("input/planar_conn.7.g6"), 646);
+    EXPECT_EQ(count_planar("input/planar_conn.8.g6"), 5974);
+    EXPECT_EQ(count_planar("input/graph7.g6"), 822);
+    EXPECT_EQ(count_planar("input/graph8.g6"), 6966);
+    EXPECT_EQ(count_planar("input/graph8c.g6"), 5974);
+}
+
+TEST(PlanarGraphRecognitionRepeatedTest, test) {
+    // the graph is borrowed, so the changes are visible to the next runs
+    NetworKit::Graph G = build_graph(5, {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}}, false);
+    auto algorithm = Koala::PlanarGraphRecognition(Koala::borrow(G));
+    for (int i = 0; i < 2; i++) {
+        algorithm.run();
+        algorithm.check();
+        EXPECT_TRUE(algorithm.isPlanar());
+        EXPECT_EQ(algorithm.getEmbedding().numberOfFaces(), 4);
+    }
+    for (NetworKit::node v = 0; v < 4; v++) {
+        G.addEdge(v, 4);
+    }
+    algorithm.run();
+    EXPECT_FALSE(algorithm.isPlanar());
+    EXPECT_EQ(algorithm.getEmbedding().upperNodeIdBound(), 0);
+}
+
+TEST(PlanarGraphRecognitionLargeTest, test) {
+    // a triangulated grid, with the depth-first search paths of about a million vertices
+    const NetworKit::count N = 1000;
+    NetworKit::Graph G(N * N, false, false);
+    for (NetworKit::node i = 0; i < N; i++) {
+        for (NetworKit::node j = 0; j < N; j++) {
+            if (i + 1 < N) {
+                G.addEdge(i * N + j, (i + 1) * N + j);
+            }
+            if (j + 1 < N) {
+                G.addEdge(i * N + j, i * N + j + 1);
+            }
+            if (i + 1 < N && j + 1 < N) {
+                G.addEdge(i * N + j, (i + 1) * N + j + 1);
+            }
+        }
+    }
+    auto algorithm = Koala::PlanarGraphRecognition(G);
+    algorithm.run();
+    algorithm.check();
+    EXPECT_TRUE(algorithm.isPlanar());
+    EXPECT_EQ(algorithm.getEmbedding().numberOfFaces(), G.numberOfEdges() - G.numberOfNodes() + 2);
+
+    // the other diagonal of an inner square joins two vertices without a common face
+    const NetworKit::node v = (N / 2) * N + N / 2;
+    G.addEdge(v + 1, v + N);
+    auto nonplanar = Koala::PlanarGraphRecognition(G);
+    nonplanar.run();
+    EXPECT_FALSE(nonplanar.isPlanar());
+}
@@ -122,3 +122,32 @@ TYPED_TEST(HeapTest, UpdateDecreasing_Other) {
         this->heap.check();
     }
 }
+
+TYPED_TEST(HeapTest, Merge) {
+    const int MAX = 1000;
+    TypeParam other;
+    for (int i = 0; i < MAX; i++) {
+        (i % 2 == 0 ? this->heap : other).push(i);
+    }
+    for (int i = 0; i < MAX / 4; i++) {
+        this->heap.pop(), other.pop();
+    }
+    auto offset = this->heap.merge(other, [](int key) { return key - MAX; });
+    this->heap.check(), other.check();
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(this->heap.size(), MAX / 2);
+    ASSERT_EQ(this->heap.capacity(), MAX);
+    ASSERT_EQ(other.capacity(), 0);
+    this->heap.update(this->get_iterator(offset + MAX / 2 - 1), -2 * MAX);
+    ASSERT_EQ(this->heap.top(), -2 * MAX);
+    this->heap.pop(), this->heap.check();
+    for (int i = MAX / 2 + 1; i < MAX - 1; i += 2) {
+        ASSERT_EQ(this->heap.top(), i - MAX);
+        this->heap.pop(), this->heap.check();
+    }
+    for (int i = MAX / 2; i < MAX; i += 2) {
+        ASSERT_EQ(this->heap.top(), i);
+        this->heap.pop(), this->heap.check();
+    }
+    ASSERT_TRUE(this->heap.empty());
+}
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <list>
+#include <memory_resource>
+#include <stop_token>
+#include <type_traits>
 
 #include <independent_set/IndependentSet.hpp>
 
@@ -95,9 +98,62 @@ TYPED_TEST_P(SimpleGraphs, TestingGraph) {
     3};
     this->verify(parameters);
 }
+TYPED_TEST_P(SimpleGraphs, Interrupted) {
+    std::list<std::pair<int, int>> E = {
+        {0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0}, {0, 5}, {1, 6}, {2, 7}, {3, 8}, {4, 9},
+        {5, 7}, {7, 9}, {9, 6}, {6, 8}, {8, 5}};
+    NetworKit::Graph G = build_graph(10, E, false);
+    std::stop_source source;
+    source.request_stop();
+    auto algorithm = TypeParam(G);
+    algorithm.setStopToken(source.get_token());
+    algorithm.run();
+    algorithm.check();
+    EXPECT_TRUE(algorithm.isInterrupted());
+    EXPECT_FALSE(algorithm.isOptimal());
+    EXPECT_LE(algorithm.getIndependentSet().size(), 4);
+}
+
+class CountingResource : public std::pmr::memory_resource {
+ public:
+    int allocations = 0;
+
+ private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+};
+
+TYPED_TEST_P(SimpleGraphs, MemoryResource) {
+    std::list<std::pair<int, int>> E = {
+        {0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0}, {0, 5}, {1, 6}, {2, 7}, {3, 8}, {4, 9},
+        {5, 7}, {7, 9}, {9, 6}, {6, 8}, {8, 5}};
+    NetworKit::Graph G = build_graph(10, E, false);
+    CountingResource resource;
+    {
+        auto algorithm = TypeParam(G);
+        algorithm.setMemoryResource(&resource);
+        algorithm.run();
+        algorithm.check();
+        EXPECT_EQ(algorithm.getIndependentSet().size(), 4);
+    }
+    if constexpr (std::is_base_of_v<Koala::RecursiveIndependentSet, TypeParam>) {
+        EXPECT_GT(resource.allocations, 0);
+    }
+}
+
 REGISTER_TYPED_TEST_CASE_P(
     SimpleGraphs, WheelGraphW_8, UtilityGraphK_3_3, PetersenGraph, FruchtGraph,
-    TwoK5, TestingGraph);
+    TwoK5, TestingGraph, Interrupted, MemoryResource);
 
 using Algorithms = testing::Types<
     Koala::BruteForceIndependentSet,
@@ -1,8 +1,17 @@
 #include <gtest/gtest.h>
 
 #include <list>
+#include <random>
+#include <stop_token>
+#include <type_traits>
 
+#include <flow/Connectivity.hpp>
+#include <flow/DinicMaximumFlow.hpp>
+#include <flow/GridMaximumFlow.hpp>
 #include <flow/MaximumFlow.hpp>
+#include <flow/MaximumFlowVerifier.hpp>
+#include <flow/PreprocessedMaximumFlow.hpp>
+#include <generator/GraphGenerator.hpp>
 
 #include "helpers.hpp"
 
@@ -21,14 +30,348 @@ TEST_P(KingRaoTarjanMaximumFlowTest, test) {
     NetworKit::Graph G = build_graph(parameters.N, parameters.EW, true);
     auto algorithm = Koala::KingRaoTarjanMaximumFlow(G, parameters.s, parameters.t);
     algorithm.run();
+    algorithm.check();
     EXPECT_EQ(algorithm.getFlowSize(), parameters.flowSize);
 }
 
-INSTANTIATE_TEST_SUITE_P(
-    test_example, KingRaoTarjanMaximumFlowTest, testing::Values(
-        MaximumFlowParameters{
-            4, {{0, 1, 10}, {0, 2, 5}, {1, 2, 15}, {1, 3, 5}, {2, 3, 10}}, 0, 3, 15},
-        MaximumFlowParameters{
-            6, {{0, 1, 16}, {0, 2, 13}, {1, 3, 12}, {2, 1, 4}, {2, 4, 14}, {3, 2, 9},
-                {4, 3, 7}, {3, 5, 20}, {4, 5, 4}}, 0, 5, 23}
-));
+auto example_flows = testing::Values(
+    MaximumFlowParameters{
+        4, {{0, 1, 10}, {0, 2, 5}, {1, 2, 15}, {1, 3, 5}, {2, 3, 10}}, 0, 3, 15},
+    MaximumFlowParameters{
+        6, {{0, 1, 16}, {0, 2, 13}, {1, 3, 12}, {2, 1, 4}, {2, 4, 14}, {3, 2, 9},
+            {4, 3, 7}, {3, 5, 20}, {4, 5, 4}}, 0, 5, 23}
+);
+
+INSTANTIATE_TEST_SUITE_P(test_example, KingRaoTarjanMaximumFlowTest, example_flows);
+
+template <class Capacity>
+class DinicMaximumFlowTest : public testing::TestWithParam<MaximumFlowParameters> {
+ public:
+    void test_flow() {
+        MaximumFlowParameters const& parameters = GetParam();
+        NetworKit::Graph G = build_graph(parameters.N, parameters.EW, true);
+        auto algorithm = Koala::DinicMaximumFlow<Capacity>(G, parameters.s, parameters.t);
+        algorithm.run();
+        algorithm.check();
+        EXPECT_EQ(algorithm.getFlowSize(), parameters.flowSize);
+        EXPECT_TRUE(algorithm.getSourceSide()[parameters.s]);
+        EXPECT_FALSE(algorithm.getSourceSide()[parameters.t]);
+    }
+};
+
+class DinicInt32MaximumFlowTest : public DinicMaximumFlowTest<int32_t> { };
+
+TEST_P(DinicInt32MaximumFlowTest, test) {
+    test_flow();
+}
+
+INSTANTIATE_TEST_SUITE_P(test_example, DinicInt32MaximumFlowTest, example_flows);
+
+class DinicInt64MaximumFlowTest : public DinicMaximumFlowTest<int64_t> { };
+
+TEST_P(DinicInt64MaximumFlowTest, test) {
+    test_flow();
+}
+
+INSTANTIATE_TEST_SUITE_P(test_example, DinicInt64MaximumFlowTest, example_flows);
+
+TEST(DinicMaximumFlowTest, UnitCapacityMatchesInteger) {
+    for (uint64_t seed = 1; seed <= 5; seed++) {
+        auto G = Koala::ErdosRenyiGenerator(300, 0.02, true, seed).generate();
+        auto unit = Koala::DinicMaximumFlow<Koala::UnitCapacity>(G, 0, 1);
+        unit.run();
+        unit.check();
+        auto integer = Koala::DinicMaximumFlow<int32_t>(G, 0, 1);
+        integer.run();
+        integer.check();
+        EXPECT_EQ(unit.getFlowSize(), integer.getFlowSize());
+        EXPECT_LE(unit.getFlowSize(), std::min(G.degreeOut(0), G.degreeIn(1)));
+    }
+}
+
+TEST(DinicMaximumFlowTest, InvalidCapacities) {
+    NetworKit::Graph G(3, true, true);
+    G.addEdge(0, 1, 2.5), G.addEdge(1, 2, 1);
+    auto fractional = Koala::DinicMaximumFlow<int64_t>(G, 0, 2);
+    EXPECT_THROW(fractional.run(), std::invalid_argument);
+    G.setWeight(0, 1, 4294967296.0);
+    auto large = Koala::DinicMaximumFlow<int32_t>(G, 0, 2);
+    EXPECT_THROW(large.run(), std::invalid_argument);
+    auto wide = Koala::DinicMaximumFlow<int64_t>(G, 0, 2);
+    wide.run();
+    wide.check();
+    EXPECT_EQ(wide.getFlowSize(), 1);
+    G.setWeight(0, 1, 2147483647.0), G.addEdge(0, 2, 2147483647.0);
+    auto overflow = Koala::DinicMaximumFlow<int32_t>(G, 0, 2);
+    EXPECT_THROW(overflow.run(), std::invalid_argument);
+}
+
+TEST(DinicMaximumFlowTest, ChangedTerminals) {
+    auto G = Koala::ErdosRenyiGenerator(100, 0.05, true, 7).generate();
+    auto reused = Koala::DinicMaximumFlow<Koala::UnitCapacity>(G, 0, 1);
+    for (NetworKit::node t = 1; t < 10; t++) {
+        reused.setTerminals(0, t);
+        reused.run();
+        reused.check();
+        auto fresh = Koala::DinicMaximumFlow<Koala::UnitCapacity>(G, 0, t);
+        fresh.run();
+        EXPECT_EQ(reused.getFlowSize(), fresh.getFlowSize());
+    }
+    EXPECT_THROW(reused.setTerminals(2, 2), std::invalid_argument);
+}
+
+TEST(ConnectivityTest, Petersen) {
+    auto G = build_graph(10, {
+        {0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0}, {0, 5}, {1, 6}, {2, 7}, {3, 8}, {4, 9},
+        {5, 7}, {7, 9}, {9, 6}, {6, 8}, {8, 5}}, false);
+    EXPECT_EQ(Koala::edgeConnectivity(G, 0, 7), 3);
+    EXPECT_EQ(Koala::vertexConnectivity(G, 0, 7), 3);
+    EXPECT_EQ(Koala::edgeConnectivity(G), 3);
+    EXPECT_EQ(Koala::vertexConnectivity(G), 3);
+}
+
+TEST(ConnectivityTest, Bowtie) {
+    // two triangles sharing the vertex 2
+    auto G = build_graph(5, {{0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {4, 2}}, false);
+    EXPECT_EQ(Koala::edgeConnectivity(G), 2);
+    EXPECT_EQ(Koala::vertexConnectivity(G), 1);
+    EXPECT_EQ(Koala::vertexConnectivity(G, 0, 3), 1);
+}
+
+TEST(ConnectivityTest, Directed) {
+    auto G = build_graph(4, {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {0, 2}, {2, 0}}, true);
+    EXPECT_EQ(Koala::edgeConnectivity(G, 0, 2), 2);
+    EXPECT_EQ(Koala::edgeConnectivity(G), 1);
+}
+
+class PreprocessedMaximumFlowTest : public testing::TestWithParam<MaximumFlowParameters> { };
+
+TEST_P(PreprocessedMaximumFlowTest, test) {
+    MaximumFlowParameters const& parameters = GetParam();
+    NetworKit::Graph G = build_graph(parameters.N, parameters.EW, true);
+    auto krt = Koala::PreprocessedMaximumFlow<Koala::KingRaoTarjanMaximumFlow>(
+        G, parameters.s, parameters.t);
+    krt.run();
+    EXPECT_EQ(krt.getFlowSize(), parameters.flowSize);
+    auto dinic = Koala::PreprocessedMaximumFlow<Koala::DinicMaximumFlow<int64_t>>(
+        G, parameters.s, parameters.t);
+    dinic.run();
+    EXPECT_EQ(dinic.getFlowSize(), parameters.flowSize);
+}
+
+INSTANTIATE_TEST_SUITE_P(test_example, PreprocessedMaximumFlowTest, example_flows);
+
+TEST(PreprocessedMaximumFlowTest, Reduction) {
+    // 0 -> 1 -> 2 -> 3 is a series path, 4 is a dead end, 5 is unreachable, {6, 7} is a cycle
+    // hanging off 2, and the arcs 0 -> 3 are parallel
+    auto G = build_graph(8, {
+        {0, 1, 5}, {1, 2, 3}, {2, 3, 4}, {1, 4, 7}, {5, 2, 2}, {2, 6, 1}, {6, 7, 1}, {7, 2, 1},
+        {0, 3, 2}, {0, 3, 1}, {3, 0, 9}}, true);
+    auto algorithm = Koala::PreprocessedMaximumFlow<Koala::DinicMaximumFlow<int64_t>>(G, 0, 3);
+    algorithm.run();
+    EXPECT_EQ(algorithm.getFlowSize(), 6);
+    const auto &reduced = algorithm.getPreprocessing().getReducedGraph();
+    EXPECT_EQ(reduced.numberOfNodes(), 2);
+    EXPECT_EQ(reduced.weight(0, 1), 6);
+    EXPECT_EQ(reduced.weight(1, 0), 0);
+    const auto &side = algorithm.getSourceSide();
+    EXPECT_TRUE(side[0]);
+    EXPECT_FALSE(side[3]);
+}
+
+TEST(PreprocessedMaximumFlowTest, Interrupted) {
+    auto G = build_graph(4, {{0, 1, 5}, {0, 2, 3}, {1, 3, 4}, {2, 3, 6}, {1, 2, 2}}, true);
+    std::stop_source source;
+    source.request_stop();
+    auto algorithm = Koala::PreprocessedMaximumFlow<Koala::DinicMaximumFlow<int64_t>>(G, 0, 3);
+    algorithm.setStopToken(source.get_token());
+    algorithm.run();
+    EXPECT_TRUE(algorithm.isInterrupted());
+    EXPECT_FALSE(algorithm.isOptimal());
+    algorithm.setStopToken(std::stop_token());
+    algorithm.run();
+    EXPECT_FALSE(algorithm.isInterrupted());
+    EXPECT_EQ(algorithm.getFlowSize(), 8);
+}
+
+TEST(PreprocessedMaximumFlowTest, RandomNetworks) {
+    std::mt19937_64 generator(7);
+    for (int i = 0; i < 50; i++) {
+        const int N = 60;
+        std::list<std::tuple<int, int, int>> EW;
+        for (int j = 0; j < 120; j++) {
+            int u = generator() % N, v = generator() % N;
+            if (u != v) {
+                EW.emplace_back(u, v, 1 + generator() % 20);
+            }
+        }
+        NetworKit::Graph G = build_graph(N, EW, true);
+        auto direct = Koala::DinicMaximumFlow<int64_t>(G, 0, 1);
+        direct.run();
+        auto preprocessed = Koala::PreprocessedMaximumFlow<Koala::DinicMaximumFlow<int64_t>>(
+            G, 0, 1);
+        preprocessed.run();
+        EXPECT_EQ(direct.getFlowSize(), preprocessed.getFlowSize());
+        EXPECT_LE(preprocessed.getPreprocessing().getReducedGraph().numberOfEdges(),
+            G.numberOfEdges());
+        const auto &side = preprocessed.getSourceSide();
+        EXPECT_TRUE(side[0]);
+        EXPECT_FALSE(side[1]);
+        NetworKit::edgeweight cut = 0;
+        G.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+            if (side[u] && !side[v]) {
+                cut += w;
+            }
+        });
+        EXPECT_EQ(cut, preprocessed.getFlowSize());
+    }
+}
+
+TEST(MaximumFlowVerifierTest, Certificate) {
+    auto G = build_graph(4, {{0, 1, 10}, {0, 2, 5}, {1, 2, 15}, {1, 3, 5}, {2, 3, 10}}, true);
+    auto verify = [&](const std::vector<NetworKit::WeightedEdge> &flow) {
+        Koala::MaximumFlowVerifier verifier(G, 0, 3, flow);
+        verifier.run();
+        return verifier.getCertificate();
+    };
+
+    auto maximum = verify({{0, 1, 10}, {0, 2, 5}, {1, 2, 5}, {1, 3, 5}, {2, 3, 10}});
+    EXPECT_TRUE(maximum.isMaximum());
+    EXPECT_EQ(maximum.flow_value, 15);
+    EXPECT_EQ(maximum.cut_capacity, 15);
+    EXPECT_TRUE(maximum.source_side[0]);
+    EXPECT_FALSE(maximum.source_side[3]);
+
+    auto feasible = verify({{0, 1, 5}, {1, 3, 5}});
+    EXPECT_TRUE(feasible.isFeasible());
+    EXPECT_FALSE(feasible.isMaximum());
+    EXPECT_TRUE(feasible.target_reachable);
+
+    auto over_capacity = verify({{0, 2, 6}, {2, 3, 6}});
+    EXPECT_EQ(over_capacity.capacity_violations, 1);
+    EXPECT_FALSE(over_capacity.isFeasible());
+
+    auto not_conserving = verify({{0, 1, 10}, {1, 3, 5}});
+    EXPECT_EQ(not_conserving.conservation_violations, 1);
+
+    auto missing_arc = verify({{0, 3, 1}});
+    EXPECT_EQ(missing_arc.capacity_violations, 1);
+}
+
+TEST(MaximumFlowVerifierTest, KingRaoTarjanFlow) {
+    Koala::WashingtonFlowNetworkGenerator generator(6, 8, 100, 5);
+    auto G = generator.generate();
+    auto algorithm = Koala::KingRaoTarjanMaximumFlow(
+        G, generator.getSource(), generator.getTarget());
+    algorithm.run();
+    std::vector<NetworKit::WeightedEdge> flow;
+    for (const auto &[e, f] : algorithm.getFlow()) {
+        if (f > 0) {
+            flow.emplace_back(e.first, e.second, f);
+        }
+    }
+    Koala::MaximumFlowVerifier verifier(G, generator.getSource(), generator.getTarget(), flow);
+    verifier.run();
+    EXPECT_TRUE(verifier.getCertificate().isMaximum());
+    EXPECT_EQ(verifier.getCertificate().flow_value, algorithm.getFlowSize());
+}
+
+TEST(GridMaximumFlowTest, Small) {
+    Koala::GridNetwork network(2, 1);
+    network.addArc(0, 2, 5), network.addArc(0, 3, 1), network.addArc(2, 3, 3);
+    network.addArc(2, 1, 1), network.addArc(3, 1, 4);
+    EXPECT_THROW(network.addArc(2, 2, 1), std::invalid_argument);
+    auto bk = Koala::BoykovKolmogorovGridMaximumFlow(network);
+    bk.run();
+    bk.check();
+    EXPECT_EQ(bk.getFlowSize(), 5);
+    EXPECT_EQ(bk.getSourceSide(), std::vector<bool>({true, false}));
+    auto pr = Koala::PushRelabelGridMaximumFlow(network, 1);
+    pr.run();
+    pr.check();
+    EXPECT_EQ(pr.getFlowSize(), 5);
+    EXPECT_EQ(network.getCutCapacity(pr.getSourceSide()), 5);
+}
+
+// the algorithms keep a reference to the network, thus the temporary networks are rejected
+static_assert(!std::is_constructible_v<
+    Koala::BoykovKolmogorovGridMaximumFlow, Koala::GridNetwork&&>);
+static_assert(!std::is_constructible_v<Koala::PushRelabelGridMaximumFlow, Koala::GridNetwork&&>);
+
+TEST(GridMaximumFlowTest, RunTwice) {
+    Koala::GridNetwork network(2, 1);
+    network.addArc(0, 2, 5), network.addArc(0, 3, 1), network.addArc(2, 3, 3);
+    network.addArc(2, 1, 1), network.addArc(3, 1, 4);
+    std::stop_source source;
+    source.request_stop();
+    auto bk = Koala::BoykovKolmogorovGridMaximumFlow(network);
+    auto pr = Koala::PushRelabelGridMaximumFlow(network, 1);
+    bk.setStopToken(source.get_token()), pr.setStopToken(source.get_token());
+    bk.run(), pr.run();
+    bk.check(), pr.check();
+    EXPECT_TRUE(bk.isInterrupted());
+    EXPECT_TRUE(pr.isInterrupted());
+    bk.setStopToken(std::stop_token()), pr.setStopToken(std::stop_token());
+    for (int i = 0; i < 2; i++) {
+        bk.run(), pr.run();
+        bk.check(), pr.check();
+        EXPECT_FALSE(bk.isInterrupted());
+        EXPECT_FALSE(pr.isInterrupted());
+        EXPECT_EQ(bk.getFlowSize(), 5);
+        EXPECT_EQ(pr.getFlowSize(), 5);
+    }
+}
+
+TEST(GridMaximumFlowTest, RandomGrids) {
+    std::mt19937_64 generator(17);
+    for (auto [width, height, depth] : std::vector<std::tuple<int, int, int>>{
+            {7, 5, 1}, {20, 15, 1}, {6, 4, 3}, {5, 5, 5}, {1, 30, 1}}) {
+        for (int repetition = 0; repetition < 10; repetition++) {
+            Koala::GridNetwork network(width, height, depth);
+            std::uniform_int_distribution<int> capacity(-10, 20);
+            auto add = [&](NetworKit::node u, NetworKit::node v) {
+                network.addArc(u, v, std::max(0, capacity(generator)));
+            };
+            for (NetworKit::index v = 0; v < network.numberOfCells(); v++) {
+                add(0, v + 2), add(v + 2, 1);
+                for (int d = 0; d < Koala::GridNetwork::DIRECTIONS; d++) {
+                    if (network.getNeighbor(v, d) != NetworKit::none) {
+                        add(v + 2, network.getNeighbor(v, d) + 2);
+                    }
+                }
+            }
+            auto dinic = Koala::DinicMaximumFlow<int64_t>(network.toGraph(), 0, 1);
+            dinic.run();
+            auto bk = Koala::BoykovKolmogorovGridMaximumFlow(network);
+            bk.run();
+            bk.check();
+            EXPECT_EQ(bk.getFlowSize(), dinic.getFlowSize());
+            for (NetworKit::count block_size : {1, 3, 32}) {
+                auto pr = Koala::PushRelabelGridMaximumFlow(network, block_size);
+                pr.run();
+                pr.check();
+                EXPECT_EQ(pr.getFlowSize(), dinic.getFlowSize());
+                EXPECT_EQ(network.getCutCapacity(pr.getSourceSide()), dinic.getFlowSize());
+            }
+        }
+    }
+}
+
+TEST(GridMaximumFlowTest, Segmentation) {
+    Koala::SegmentationFlowNetworkGenerator generator(40, 30, 2, 100, 3);
+    Koala::GridNetwork network(40, 30, 2);
+    generator.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        network.addArc(u, v, static_cast<int64_t>(w));
+    });
+    auto dinic = Koala::DinicMaximumFlow<int64_t>(
+        generator.generate(), generator.getSource(), generator.getTarget());
+    dinic.run();
+    auto bk = Koala::BoykovKolmogorovGridMaximumFlow(network);
+    bk.run();
+    bk.check();
+    EXPECT_EQ(bk.getFlowSize(), dinic.getFlowSize());
+    auto pr = Koala::PushRelabelGridMaximumFlow(network, 8);
+    pr.run();
+    pr.check();
+    EXPECT_EQ(pr.getFlowSize(), dinic.getFlowSize());
+}
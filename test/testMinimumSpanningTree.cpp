@@ -1,11 +1,22 @@
 #include <gtest/gtest.h>
 
 #include <list>
+#include <memory>
 #include <iostream>
+#include <random>
+#include <stop_token>
 
 #include <networkit/graph/GraphTools.hpp>
 
+#include <generator/GraphGenerator.hpp>
+#include <io/BinaryEdgeListReader.hpp>
+#include <io/BinaryEdgeListWriter.hpp>
+#include <mst/KruskalReconstructionTree.hpp>
+#include <mst/MinimumSpanningArborescence.hpp>
 #include <mst/MinimumSpanningTree.hpp>
+#include <mst/PathMaximumIndex.hpp>
+#include <mst/SemiExternalMinimumSpanningTree.hpp>
+#include <structures/RadixSort.hpp>
 
 #include "helpers.hpp"
 
@@ -47,6 +58,214 @@ TEST_P(KruskalMinimumSpanningTreeTest, test_example) {
 
 INSTANTIATE_TEST_SUITE_P(test_example, KruskalMinimumSpanningTreeTest, example_trees);
 
+TEST(KruskalMinimumSpanningTreeTest, RadixSort) {
+    std::mt19937_64 generator(5);
+    std::vector<double> values{-1e300, -2.5, -0.0, 0.0, 1e-300, 0.5, 3.0, 1e300};
+    for (NetworKit::index i = 0; i + 1 < values.size(); i++) {
+        EXPECT_LE(Koala::order_preserving_key(values[i]), Koala::order_preserving_key(values[i + 1]));
+    }
+    for (NetworKit::count n : {0, 1, 1000, 100000}) {
+        for (uint64_t range : {1ULL, 5000ULL, ~0ULL}) {
+            std::vector<std::pair<uint64_t, NetworKit::index>> items(n);
+            for (NetworKit::index i = 0; i < n; i++) {
+                items[i] = std::make_pair(generator() % range, i);
+            }
+            auto expected = items;
+            std::stable_sort(expected.begin(), expected.end(), [](auto &a, auto &b) {
+                return a.first < b.first;
+            });
+            Koala::radix_sort(items);
+            EXPECT_EQ(items, expected);
+        }
+    }
+}
+
+TEST(KruskalMinimumSpanningTreeTest, RadixMatchesComparison) {
+    std::mt19937_64 generator(7);
+    std::uniform_real_distribution<double> weight(-100.0, 100.0);
+    NetworKit::Graph G(300, true, false);
+    for (NetworKit::index i = 0; i < 3000; i++) {
+        NetworKit::node u = generator() % 300, v = generator() % 300;
+        if (u != v && !G.hasEdge(u, v)) {
+            G.addEdge(u, v, i % 3 ? weight(generator) : std::round(weight(generator)));
+        }
+    }
+    auto radix = Koala::KruskalMinimumSpanningTree(G);
+    radix.run();
+    auto comparison = Koala::KruskalMinimumSpanningTree(
+        G, Koala::KruskalMinimumSpanningTree::Sorting::COMPARISON);
+    comparison.run();
+    EXPECT_DOUBLE_EQ(
+        radix.getForest().totalEdgeWeight(), comparison.getForest().totalEdgeWeight());
+}
+
+TEST(MinimumSpanningTreeTest, BorrowedGraph) {
+    std::mt19937_64 generator(11);
+    NetworKit::Graph G(200, true, false);
+    for (NetworKit::index i = 0; i < 1500; i++) {
+        NetworKit::node u = generator() % 200, v = generator() % 200;
+        if (u != v && !G.hasEdge(u, v)) {
+            G.addEdge(u, v, static_cast<NetworKit::edgeweight>(generator() % 1000));
+        }
+    }
+    auto copied = Koala::KruskalMinimumSpanningTree(G);
+    copied.run();
+
+    // the borrowed and the shared graphs are read by several algorithms without being copied
+    auto borrowed = Koala::borrow(G);
+    auto shared = std::make_shared<const NetworKit::Graph>(G);
+    EXPECT_EQ(borrowed.get(), &G);
+    auto kruskal = Koala::KruskalMinimumSpanningTree(
+        borrowed, Koala::KruskalMinimumSpanningTree::Sorting::COMPARISON);
+    auto prim = Koala::PrimMinimumSpanningTree(borrowed);
+    auto boruvka = Koala::BoruvkaMinimumSpanningTree(shared);
+    auto kkt = Koala::KargerKleinTarjanMinimumSpanningTree(shared, 3);
+    EXPECT_EQ(shared.use_count(), 3);
+    for (Koala::MinimumSpanningTree *mst : std::initializer_list<Koala::MinimumSpanningTree*>{
+            &kruskal, &prim, &boruvka, &kkt}) {
+        mst->run();
+        mst->check();
+        EXPECT_DOUBLE_EQ(
+            mst->getForest().totalEdgeWeight(), copied.getForest().totalEdgeWeight());
+    }
+    EXPECT_EQ(G.numberOfEdges(), shared->numberOfEdges());
+}
+
+TEST(KruskalReconstructionTreeTest, SingleLinkage) {
+    std::mt19937_64 generator(19);
+    const int n = 60;
+    NetworKit::Graph G(n, true, false);
+    for (int i = 0; i < 150; i++) {
+        NetworKit::node u = generator() % n, v = generator() % n;
+        if (u != v && !G.hasEdge(u, v)) {
+            G.addEdge(u, v, static_cast<NetworKit::edgeweight>(generator() % 30));
+        }
+    }
+    auto kruskal = Koala::KruskalMinimumSpanningTree(G);
+    kruskal.run();
+    auto boruvka = Koala::BoruvkaMinimumSpanningTree(G);
+    boruvka.run();
+    auto krt = kruskal.getReconstructionTree();
+    auto other = boruvka.getReconstructionTree();
+    const auto &dendrogram = krt.getDendrogram();
+    EXPECT_EQ(dendrogram.size(), kruskal.getForest().numberOfEdges());
+    for (NetworKit::index i = 0; i < dendrogram.size(); i++) {
+        EXPECT_LT(std::max(dendrogram[i].left, dendrogram[i].right), n + i);
+        EXPECT_TRUE(i == 0 || dendrogram[i - 1].height <= dendrogram[i].height);
+    }
+
+    // the bottleneck distance is the smallest threshold at which u and v share a cluster
+    for (NetworKit::edgeweight threshold = 0; threshold <= 30; threshold++) {
+        NetworKit::UnionFind union_find(n);
+        G.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+            if (w <= threshold) {
+                union_find.merge(u, v);
+            }
+        });
+        auto clusters = krt.getClusters(threshold);
+        for (int u = 0; u < n; u++) {
+            for (int v = 0; v < n; v++) {
+                bool together = union_find.find(u) == union_find.find(v);
+                EXPECT_EQ(clusters[u] == clusters[v], together);
+                EXPECT_EQ(krt.getBottleneckDistance(u, v) <= threshold, together);
+                EXPECT_EQ(other.getBottleneckDistance(u, v) <= threshold, together);
+            }
+        }
+    }
+}
+
+TEST(KruskalReconstructionTreeTest, DeepTree) {
+    // the path with increasing weights gives a reconstruction tree of depth n
+    const int n = 200000;
+    NetworKit::Graph G(n, true, false);
+    for (int v = 1; v < n; v++) {
+        G.addEdge(v - 1, v, v);
+    }
+    auto krt = Koala::KruskalReconstructionTree(G);
+    EXPECT_EQ(krt.getTree().numberOfNodes(), 2 * n);
+    EXPECT_EQ(krt.getBottleneckDistance(0, 1), 1);
+    EXPECT_EQ(krt.getBottleneckDistance(n / 2, n / 3), n / 2);
+    EXPECT_EQ(krt.getBottleneckDistance(n - 1, 0), n - 1);
+}
+
+TEST(PathMaximumIndexTest, RandomForest) {
+    std::mt19937_64 generator(23);
+    const int n = 300;
+    NetworKit::Graph G(n, true, false);
+    for (int i = 0; i < 500; i++) {
+        NetworKit::node u = generator() % n, v = generator() % n;
+        if (u != v && !G.hasEdge(u, v)) {
+            G.addEdge(u, v, static_cast<NetworKit::edgeweight>(generator() % 1000));
+        }
+    }
+    auto kruskal = Koala::KruskalMinimumSpanningTree(G);
+    kruskal.run();
+    const auto &F = kruskal.getForest();
+    auto index = Koala::PathMaximumIndex(F);
+
+    std::vector<std::pair<NetworKit::node, NetworKit::node>> queries;
+    std::vector<NetworKit::edgeweight> expected;
+    for (NetworKit::node s = 0; s < n; s += 7) {
+        std::vector<NetworKit::edgeweight> maximum(n, std::numeric_limits<double>::infinity());
+        std::vector<NetworKit::node> stack{s};
+        maximum[s] = 0;
+        while (!stack.empty()) {
+            auto u = stack.back();
+            stack.pop_back();
+            F.forNeighborsOf(u, [&](NetworKit::node v, NetworKit::edgeweight w) {
+                if (v != s && maximum[v] == std::numeric_limits<double>::infinity()) {
+                    maximum[v] = std::max(maximum[u], w), stack.push_back(v);
+                }
+            });
+        }
+        for (NetworKit::node v = 0; v < n; v++) {
+            EXPECT_EQ(index.query(s, v), maximum[v]);
+            queries.push_back({s, v}), expected.push_back(maximum[v]);
+        }
+    }
+    EXPECT_EQ(index.query(queries), expected);
+    G.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        if (F.hasEdge(u, v)) {
+            EXPECT_EQ(index.query(u, v), w);
+        } else {
+            EXPECT_LE(index.query(u, v), w);
+        }
+        EXPECT_FALSE(index.isHeavier(u, v, index.query(u, v)));
+        EXPECT_TRUE(index.isHeavier(u, v, index.query(u, v) + 1));
+    });
+    EXPECT_TRUE(index.isHeavier(0, 0, 0));
+}
+
+class FredmanTarjanMinimumSpanningTreeTest
+    : public MinimumSpanningTreeTest<Koala::FredmanTarjanMinimumSpanningTree> { };
+
+TEST_P(FredmanTarjanMinimumSpanningTreeTest, test_example) {
+    test_mst();
+}
+
+INSTANTIATE_TEST_SUITE_P(test_example, FredmanTarjanMinimumSpanningTreeTest, example_trees);
+
+TEST(FredmanTarjanMinimumSpanningTreeTest, RandomGraphs) {
+    std::mt19937_64 generator(11);
+    for (auto [n, m] : std::vector<std::pair<int, int>>{{1, 0}, {50, 40}, {200, 1000}, {100, 4950}}) {
+        NetworKit::Graph G(n, true, false);
+        for (int i = 0; i < 4 * m && static_cast<int>(G.numberOfEdges()) < m; i++) {
+            NetworKit::node u = generator() % n, v = generator() % n;
+            if (u != v && !G.hasEdge(u, v)) {
+                G.addEdge(u, v, static_cast<NetworKit::edgeweight>(1 + generator() % 20));
+            }
+        }
+        auto kruskal = Koala::KruskalMinimumSpanningTree(G);
+        kruskal.run();
+        auto fredman_tarjan = Koala::FredmanTarjanMinimumSpanningTree(G);
+        fredman_tarjan.run();
+        EXPECT_EQ(
+            fredman_tarjan.getForest().numberOfEdges(), kruskal.getForest().numberOfEdges());
+        EXPECT_EQ(
+            fredman_tarjan.getForest().totalEdgeWeight(), kruskal.getForest().totalEdgeWeight());
+    }
+}
+
 class BoruvkaMinimumSpanningTreeTest
     : public MinimumSpanningTreeTest<Koala::BoruvkaMinimumSpanningTree> { };
 
@@ -64,3 +283,149 @@ TEST_P(KargerKleinTarjanMinimumSpanningTreeTest, test_example) {
 }
 
 INSTANTIATE_TEST_SUITE_P(test_example, KargerKleinTarjanMinimumSpanningTreeTest, example_trees);
+
+TEST(SemiExternalMinimumSpanningTreeTest, MatchesKruskal) {
+    Koala::GridGenerator generator(30, 40, 0.8, 50, 3);
+    auto G = generator.generate();
+    auto kruskal = Koala::KruskalMinimumSpanningTree(G);
+    kruskal.run();
+    std::string input = generate_filename("input"), output = generate_filename("input");
+    Koala::BinaryEdgeListWriter().write(generator, input);
+    for (NetworKit::count run_size : {1, 100, 1000000}) {
+        auto mst = Koala::SemiExternalMinimumSpanningTree(input, output, run_size);
+        mst.run();
+        EXPECT_EQ(mst.getForestSize(), kruskal.getForest().numberOfEdges());
+        EXPECT_DOUBLE_EQ(mst.getForestWeight(), kruskal.getForest().totalEdgeWeight());
+        auto F = Koala::BinaryEdgeListReader().read(output);
+        EXPECT_EQ(F.numberOfEdges(), mst.getForestSize());
+        EXPECT_DOUBLE_EQ(F.totalEdgeWeight(), mst.getForestWeight());
+        remove(output.data());
+    }
+    remove(input.data());
+}
+
+TEST(SemiExternalMinimumSpanningTreeTest, Interrupted) {
+    Koala::GridGenerator generator(10, 10, 0.8, 50, 3);
+    std::string input = generate_filename("input"), output = generate_filename("input");
+    Koala::BinaryEdgeListWriter().write(generator, input);
+    for (NetworKit::count run_size : {10, 1000000}) {
+        auto mst = Koala::SemiExternalMinimumSpanningTree(input, output, run_size);
+        mst.run();
+        EXPECT_FALSE(mst.isInterrupted());
+        std::stop_source source;
+        source.request_stop();
+        mst.setStopToken(source.get_token());
+        mst.run();
+        EXPECT_TRUE(mst.isInterrupted());
+        EXPECT_EQ(mst.getForestSize(), 0);
+        // the forest of the previous run is overwritten
+        EXPECT_EQ(Koala::BinaryEdgeListReader().read(output).numberOfEdges(), 0);
+        mst.setStopToken(std::stop_token());
+        mst.run();
+        EXPECT_FALSE(mst.isInterrupted());
+        EXPECT_EQ(Koala::BinaryEdgeListReader().read(output).numberOfEdges(), mst.getForestSize());
+        remove(output.data());
+    }
+    remove(input.data());
+}
+
+TEST(MinimumSpanningArborescenceTest, Example) {
+    NetworKit::Graph G(5, true, true);
+    for (auto [u, v, w] : std::vector<std::tuple<int, int, int>>{
+            {0, 1, 10}, {0, 2, 10}, {1, 2, 1}, {2, 1, 1}, {2, 3, 5}, {1, 3, 7}, {3, 1, 0},
+            {4, 0, 1}, {4, 3, 1}}) {
+        G.addEdge(u, v, w);
+    }
+    auto msa = Koala::MinimumSpanningArborescence(G, 0);
+    msa.run();
+    msa.check();
+    EXPECT_EQ(msa.getWeight(), 15);
+    EXPECT_EQ(msa.getArborescence().numberOfEdges(), 3);
+    EXPECT_TRUE(msa.getArborescence().hasEdge(0, 2));
+    EXPECT_TRUE(msa.getArborescence().hasEdge(2, 3));
+    EXPECT_TRUE(msa.getArborescence().hasEdge(3, 1));
+    auto borrowed = Koala::MinimumSpanningArborescence(Koala::borrow(G), 4);
+    borrowed.run();
+    borrowed.check();
+    EXPECT_EQ(borrowed.getWeight(), 3);
+    EXPECT_THROW(Koala::MinimumSpanningArborescence(NetworKit::Graph(3, true, false), 0),
+        std::invalid_argument);
+}
+
+TEST(MinimumSpanningArborescenceTest, BruteForce) {
+    std::mt19937_64 generator(13);
+    for (int iteration = 0; iteration < 200; iteration++) {
+        const int n = 1 + generator() % 6;
+        NetworKit::Graph G(n, true, true);
+        for (int u = 0; u < n; u++) {
+            for (int v = 0; v < n; v++) {
+                if (generator() % 2 == 0) {
+                    G.addEdge(u, v, static_cast<NetworKit::edgeweight>(generator() % 10));
+                }
+            }
+        }
+        auto msa = Koala::MinimumSpanningArborescence(G, 0);
+        msa.run();
+        msa.check();
+
+        // try all choices of the incoming edges and keep the ones forming an arborescence
+        std::vector<std::vector<std::pair<NetworKit::node, NetworKit::edgeweight>>> in(n);
+        std::vector<bool> reachable(n, false);
+        std::vector<NetworKit::node> stack{0};
+        reachable[0] = true;
+        while (!stack.empty()) {
+            auto u = stack.back();
+            stack.pop_back();
+            G.forNeighborsOf(u, [&](NetworKit::node v, NetworKit::edgeweight w) {
+                if (v != 0 && u != v) {
+                    in[v].push_back({u, w});
+                }
+                if (!reachable[v]) {
+                    reachable[v] = true, stack.push_back(v);
+                }
+            });
+        }
+        auto best = std::numeric_limits<NetworKit::edgeweight>::infinity();
+        std::vector<NetworKit::index> choice(n, 0);
+        while (true) {
+            NetworKit::edgeweight total = 0;
+            bool valid = true;
+            for (int v = 1; v < n; v++) {
+                if (!reachable[v]) {
+                    continue;
+                }
+                total += in[v][choice[v]].second;
+                auto u = static_cast<NetworKit::node>(v);
+                for (int steps = 0; u != 0 && steps < n; steps++) {
+                    u = in[u][choice[u]].first;
+                }
+                valid &= u == 0;
+            }
+            if (valid) {
+                best = std::min(best, total);
+            }
+            int v = 1;
+            while (v < n && (!reachable[v] || ++choice[v] == in[v].size())) {
+                choice[v++] = 0;
+            }
+            if (v == n) {
+                break;
+            }
+        }
+        EXPECT_EQ(msa.getWeight(), best);
+    }
+}
+
+TEST(MinimumSpanningArborescenceTest, RandomGraphs) {
+    std::mt19937_64 generator(17);
+    std::uniform_real_distribution<double> weight(-1.0, 1.0);
+    for (auto [n, m] : std::vector<std::pair<int, int>>{{200, 400}, {500, 5000}, {100, 9900}}) {
+        NetworKit::Graph G(n, true, true);
+        for (int i = 0; i < m; i++) {
+            G.addEdge(generator() % n, generator() % n, weight(generator));
+        }
+        auto msa = Koala::MinimumSpanningArborescence(G, 0);
+        msa.run();
+        msa.check();
+    }
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <stop_token>
+
+#include <networkit/graph/Graph.hpp>
+
+#include <base/Portfolio.hpp>
+#include <coloring/ExactVertexColoring.hpp>
+#include <dominating_set/ExactDominatingSet.hpp>
+#include <independent_set/IndependentSet.hpp>
+
+NetworKit::Graph random_graph(int n, double p, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    std::bernoulli_distribution edge(p);
+    NetworKit::Graph G(n);
+    for (int u = 0; u < n; u++) {
+        for (int v = u + 1; v < n; v++) {
+            if (edge(generator)) {
+                G.addEdge(u, v);
+            }
+        }
+    }
+    return G;
+}
+
+TEST(PortfolioTest, IndependentSet) {
+    auto G = random_graph(40, 0.2, 1);
+    auto expected = Koala::Mis1IndependentSet(G);
+    expected.run();
+    auto portfolio = Koala::Portfolio<
+        Koala::Mis3IndependentSet, Koala::MeasureAndConquerIndependentSet,
+        Koala::Mis5IndependentSet>(G);
+    portfolio.run();
+    EXPECT_TRUE(portfolio.isOptimal());
+    EXPECT_FALSE(portfolio.isInterrupted());
+    EXPECT_LT(portfolio.getWinner(), 3);
+    auto size = portfolio.visit([](const Koala::IndependentSet &algorithm) {
+        algorithm.check();
+        return algorithm.getIndependentSet().size();
+    });
+    EXPECT_EQ(size, expected.getIndependentSet().size());
+}
+
+TEST(PortfolioTest, DominatingSet) {
+    auto G = random_graph(24, 0.2, 2);
+    auto expected = Koala::SchiermeyerDominatingSet(G);
+    expected.run();
+    auto portfolio = Koala::Portfolio<
+        Koala::FominKratschWoegingerDominatingSet, Koala::SchiermeyerDominatingSet>(G);
+    portfolio.run();
+    EXPECT_TRUE(portfolio.isOptimal());
+    auto size = portfolio.visit([](const Koala::DominatingSet &algorithm) {
+        algorithm.check();
+        return algorithm.getDominatingSet().size();
+    });
+    EXPECT_EQ(size, expected.getDominatingSet().size());
+}
+
+TEST(PortfolioTest, VertexColoring) {
+    auto G = random_graph(20, 0.4, 3);
+    auto expected = Koala::BrownEnumerationVertexColoring(G);
+    expected.run();
+    auto portfolio = Koala::Portfolio<
+        Koala::BrownEnumerationVertexColoring, Koala::KormanEnumerationVertexColoring>(G);
+    portfolio.run();
+    EXPECT_TRUE(portfolio.isOptimal());
+    auto colors = [](const std::map<NetworKit::node, int> &coloring) {
+        int result = 0;
+        for (const auto &[v, c] : coloring) {
+            result = std::max(result, c);
+        }
+        return result;
+    };
+    auto coloring = portfolio.visit([](const Koala::EnumerationVertexColoring &algorithm) {
+        return algorithm.getColoring();
+    });
+    G.forEdges([&](NetworKit::node u, NetworKit::node v) {
+        EXPECT_NE(coloring.at(u), coloring.at(v));
+    });
+    EXPECT_EQ(colors(coloring), colors(expected.getColoring()));
+}
+
+TEST(PortfolioTest, Cancelled) {
+    auto G = random_graph(40, 0.2, 4);
+    std::stop_source source;
+    source.request_stop();
+    auto portfolio = Koala::Portfolio<
+        Koala::Mis3IndependentSet, Koala::MeasureAndConquerIndependentSet>(G);
+    portfolio.setStopToken(source.get_token());
+    portfolio.run();
+    EXPECT_TRUE(portfolio.isInterrupted());
+    EXPECT_FALSE(portfolio.isOptimal());
+    EXPECT_TRUE(portfolio.get<0>().isInterrupted());
+    EXPECT_TRUE(portfolio.get<1>().isInterrupted());
+    portfolio.visit([](const Koala::IndependentSet &algorithm) {
+        algorithm.check();
+    });
+}
+
+class FailingAlgorithm final : public Koala::Algorithm {
+ public:
+    explicit FailingAlgorithm(std::shared_ptr<const NetworKit::Graph>) { }
+
+    void run() {
+        throw std::runtime_error("failure");
+    }
+};
+
+class HeuristicAlgorithm final : public Koala::Algorithm {
+ public:
+    explicit HeuristicAlgorithm(std::shared_ptr<const NetworKit::Graph>) { }
+
+    void run() {
+        hasRun = true;
+    }
+};
+
+TEST(PortfolioTest, Heuristic) {
+    auto G = random_graph(10, 0.5, 6);
+    auto portfolio = Koala::Portfolio<HeuristicAlgorithm, HeuristicAlgorithm>(G);
+    portfolio.run();
+    EXPECT_FALSE(portfolio.isOptimal());
+    EXPECT_FALSE(portfolio.isInterrupted());
+}
+
+TEST(PortfolioTest, Exception) {
+    auto G = random_graph(10, 0.5, 5);
+    auto failing = Koala::Portfolio<FailingAlgorithm>(G);
+    EXPECT_THROW(failing.run(), std::runtime_error);
+    auto portfolio = Koala::Portfolio<FailingAlgorithm, Koala::Mis3IndependentSet>(G);
+    portfolio.run();
+    EXPECT_EQ(portfolio.getWinner(), 1);
+    EXPECT_TRUE(portfolio.isOptimal());
+}
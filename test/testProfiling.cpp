@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <mst/MinimumSpanningTree.hpp>
+#include <profiling/Profiler.hpp>
+
+#include "helpers.hpp"
+
+TEST(ProfilingTest, NestedRegions) {
+    Koala::Profiling::Profile profile, inner;
+    {
+        Koala::Profiling::ProfileScope scope(profile, true);
+        for (int i = 0; i < 3; i++) {
+            Koala::Profiling::ScopedRegion region("outer");
+            Koala::Profiling::ProfileScope inner_scope(inner, false);
+            Koala::Profiling::ScopedRegion inner_region("inner");
+        }
+        Koala::Profiling::ScopedRegion region("after");
+    }
+    Koala::Profiling::ScopedRegion unbound("unbound");
+    const auto &regions = profile.getRegions();
+    EXPECT_EQ(regions.size(), 2);
+    EXPECT_EQ(regions.at("outer").calls, 3);
+    EXPECT_EQ(regions.at("after").calls, 1);
+    EXPECT_GE(regions.at("outer").seconds, 0.0);
+    EXPECT_EQ(inner.getRegions().size(), 1);
+    EXPECT_EQ(inner.getRegions().at("inner").calls, 3);
+}
+
+TEST(ProfilingTest, AlgorithmProfile) {
+    auto G = build_graph(4, {{0, 1, 10}, {0, 2, 5}, {1, 2, 15}, {1, 3, 5}, {2, 3, 10}}, false);
+    auto algorithm = Koala::BoruvkaMinimumSpanningTree(G);
+    algorithm.run();
+    algorithm.check();
+#ifdef KOALA_ENABLE_PROFILING
+    const auto &regions = algorithm.getProfile().getRegions();
+    EXPECT_GE(regions.at("contraction").calls, 1);
+    EXPECT_EQ(regions.at("verification").calls, 1);
+    algorithm.run();
+    EXPECT_EQ(algorithm.getProfile().getRegions().count("verification"), 0);
+#else
+    EXPECT_TRUE(algorithm.getProfile().empty());
+#endif
+}
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <mst/MinimumSpanningTree.hpp>
+#include <structures/Random.hpp>
+
+TEST(PhiloxTest, KnownAnswer) {
+    // the test vectors of Philox4x32-10 from the Random123 library
+    EXPECT_EQ(Koala::Philox(0, 0)[0], 0xe169c58d6627e8d5ULL);
+    EXPECT_EQ(Koala::Philox(0, 0)[1], 0x9b00dbd8bc57ac4cULL);
+}
+
+TEST(PhiloxTest, RandomAccess) {
+    Koala::Philox generator(42, 7), other(42, 8);
+    std::vector<uint64_t> numbers;
+    for (int i = 0; i < 100; i++) {
+        numbers.push_back(generator());
+    }
+    for (int i = 99; i >= 0; i--) {
+        EXPECT_EQ(generator[i], numbers[i]);
+        EXPECT_NE(other[i], numbers[i]);
+    }
+    std::uniform_int_distribution<int> distribution(1, 6);
+    for (int i = 0; i < 100; i++) {
+        auto x = distribution(generator);
+        EXPECT_TRUE(1 <= x && x <= 6);
+        auto y = generator.real();
+        EXPECT_TRUE(0 <= y && y < 1);
+    }
+}
+
+TEST(PhiloxTest, ConcurrentAlgorithms) {
+    std::mt19937_64 generator(29);
+    NetworKit::Graph G(300, true, false);
+    for (int i = 0; i < 3000; i++) {
+        NetworKit::node u = generator() % 300, v = generator() % 300;
+        if (u != v && !G.hasEdge(u, v)) {
+            G.addEdge(u, v, static_cast<NetworKit::edgeweight>(1 + generator() % 100));
+        }
+    }
+    auto kruskal = Koala::KruskalMinimumSpanningTree(G);
+    kruskal.run();
+    std::vector<NetworKit::edgeweight> weights(8);
+    #pragma omp parallel for
+    for (int i = 0; i < 8; i++) {
+        NetworKit::Graph H(G);
+        auto kkt = Koala::KargerKleinTarjanMinimumSpanningTree(H, i);
+        kkt.run();
+        weights[i] = kkt.getForest().totalEdgeWeight();
+    }
+    for (auto w : weights) {
+        EXPECT_EQ(w, kruskal.getForest().totalEdgeWeight());
+    }
+}
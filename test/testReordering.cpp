@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <set>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+#include <coloring/GreedyVertexColoring.hpp>
+#include <mst/MinimumSpanningTree.hpp>
+#include <reordering/VertexReordering.hpp>
+
+NetworKit::Graph shuffled_grid(int rows, int columns, uint64_t seed) {
+    std::vector<NetworKit::node> label(rows * columns);
+    for (NetworKit::node v = 0; v < label.size(); v++) {
+        label[v] = v;
+    }
+    std::mt19937_64 generator(seed);
+    std::shuffle(label.begin(), label.end(), generator);
+    NetworKit::Graph G(rows * columns, true, false);
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < columns; j++) {
+            auto weight = static_cast<NetworKit::edgeweight>(generator() % 100 + 1);
+            if (i + 1 < rows) {
+                G.addEdge(label[i * columns + j], label[(i + 1) * columns + j], weight);
+            }
+            if (j + 1 < columns) {
+                G.addEdge(label[i * columns + j], label[i * columns + j + 1], weight + 1);
+            }
+        }
+    }
+    G.removeNode(label[0]);
+    return G;
+}
+
+NetworKit::count bandwidth(const NetworKit::Graph &G) {
+    NetworKit::count result = 0;
+    G.forEdges([&](NetworKit::node u, NetworKit::node v) {
+        result = std::max(result, u > v ? u - v : v - u);
+    });
+    return result;
+}
+
+template <typename Reordering>
+class ReorderingTest : public testing::Test { };
+
+using Reorderings = testing::Types<
+    Koala::DegreeSortReordering, Koala::BFSReordering, Koala::ReverseCuthillMcKeeReordering,
+    Koala::GorderReordering>;
+TYPED_TEST_SUITE(ReorderingTest, Reorderings);
+
+TYPED_TEST(ReorderingTest, Permutation) {
+    auto G = shuffled_grid(20, 30, 1);
+    auto algorithm = TypeParam(G);
+    algorithm.run();
+    algorithm.check();
+    const auto &permutation = algorithm.getPermutation();
+    const auto &inverse = algorithm.getInversePermutation();
+    const auto &R = algorithm.getReorderedGraph();
+    EXPECT_EQ(R.numberOfNodes(), G.numberOfNodes());
+    EXPECT_EQ(R.upperNodeIdBound(), G.numberOfNodes());
+    EXPECT_EQ(R.numberOfEdges(), G.numberOfEdges());
+    EXPECT_EQ(inverse.size(), G.numberOfNodes());
+    std::set<NetworKit::node> vertices(inverse.begin(), inverse.end());
+    EXPECT_EQ(vertices.size(), G.numberOfNodes());
+    for (NetworKit::node v = 0; v < G.upperNodeIdBound(); v++) {
+        if (G.hasNode(v)) {
+            EXPECT_EQ(inverse[permutation[v]], v);
+        } else {
+            EXPECT_EQ(permutation[v], NetworKit::none);
+        }
+    }
+    G.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        EXPECT_TRUE(R.hasEdge(permutation[u], permutation[v]));
+        EXPECT_EQ(R.weight(permutation[u], permutation[v]), w);
+    });
+}
+
+TYPED_TEST(ReorderingTest, DirectedGraph) {
+    std::mt19937_64 generator(3);
+    NetworKit::Graph G(200, false, true);
+    for (int i = 0; i < 800; i++) {
+        NetworKit::node u = generator() % 200, v = generator() % 200;
+        if (u != v && !G.hasEdge(u, v)) {
+            G.addEdge(u, v);
+        }
+    }
+    auto algorithm = TypeParam(G);
+    algorithm.run();
+    algorithm.check();
+    const auto &permutation = algorithm.getPermutation();
+    G.forEdges([&](NetworKit::node u, NetworKit::node v) {
+        EXPECT_TRUE(algorithm.getReorderedGraph().hasEdge(permutation[u], permutation[v]));
+    });
+}
+
+TYPED_TEST(ReorderingTest, MinimumSpanningTree) {
+    auto G = shuffled_grid(15, 15, 5);
+    auto kruskal = Koala::KruskalMinimumSpanningTree(G);
+    kruskal.run();
+    auto reordered = Koala::ReorderedAlgorithm<Koala::KruskalMinimumSpanningTree, TypeParam>(G);
+    reordered.run();
+    reordered.getAlgorithm().check();
+    auto forest = reordered.mapBack(reordered.getAlgorithm().getForest());
+    EXPECT_EQ(forest.numberOfNodes(), G.numberOfNodes());
+    EXPECT_EQ(forest.numberOfEdges(), G.numberOfNodes() - 1);
+    forest.forEdges([&](NetworKit::node u, NetworKit::node v, NetworKit::edgeweight w) {
+        EXPECT_TRUE(G.hasEdge(u, v));
+        EXPECT_EQ(G.weight(u, v), w);
+    });
+    EXPECT_DOUBLE_EQ(forest.totalEdgeWeight(), kruskal.getForest().totalEdgeWeight());
+}
+
+TYPED_TEST(ReorderingTest, VertexColoring) {
+    auto G = shuffled_grid(10, 12, 7);
+    auto reordered = Koala::ReorderedAlgorithm<Koala::SmallestLastVertexColoring, TypeParam>(G);
+    reordered.run();
+    auto coloring = reordered.mapBack(reordered.getAlgorithm().getColoring());
+    EXPECT_EQ(coloring.size(), G.numberOfNodes());
+    G.forEdges([&](NetworKit::node u, NetworKit::node v) {
+        EXPECT_NE(coloring.at(u), coloring.at(v));
+    });
+}
+
+TEST(ReorderingTest, ReverseCuthillMcKeeBandwidth) {
+    auto G = shuffled_grid(10, 40, 9);
+    auto algorithm = Koala::ReverseCuthillMcKeeReordering(G);
+    algorithm.run();
+    // the bandwidth of a k x l grid in a breadth-first order is about 2 min(k, l)
+    EXPECT_LE(bandwidth(algorithm.getReorderedGraph()), 21);
+    EXPECT_GT(bandwidth(G), 100);
+}
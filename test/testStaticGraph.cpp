@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+#include <coloring/GreedyVertexColoring.hpp>
+#include <graph/StaticGraph.hpp>
+#include <mst/MinimumSpanningTree.hpp>
+#include <traversal/BFS.hpp>
+#include <traversal/DFS.hpp>
+
+static_assert(Koala::WeightedReadOnlyGraph<NetworKit::Graph>);
+static_assert(Koala::WeightedReadOnlyGraph<Koala::StaticGraph<>>);
+static_assert(Koala::WeightedReadOnlyGraph<Koala::StaticGraph<uint32_t>>);
+
+NetworKit::Graph random_graph(int n, int m, bool directed, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    NetworKit::Graph G(n, true, directed);
+    for (int i = 0; i < m; i++) {
+        NetworKit::node u = generator() % n, v = generator() % n;
+        if (u != v && !G.hasEdge(u, v)) {
+            G.addEdge(u, v, static_cast<NetworKit::edgeweight>(generator() % 100));
+        }
+    }
+    G.removeNode(n / 2);
+    return G;
+}
+
+template <class Graph>
+void expect_same_graph(const NetworKit::Graph &G, const Graph &S) {
+    EXPECT_EQ(S.numberOfNodes(), G.numberOfNodes());
+    EXPECT_EQ(S.numberOfEdges(), G.numberOfEdges());
+    EXPECT_EQ(S.upperNodeIdBound(), G.upperNodeIdBound());
+    for (NetworKit::node u = 0; u < G.upperNodeIdBound(); u++) {
+        EXPECT_EQ(S.hasNode(u), G.hasNode(u));
+        if (!G.hasNode(u)) {
+            continue;
+        }
+        EXPECT_EQ(S.degree(u), G.degree(u));
+        std::set<std::pair<NetworKit::node, NetworKit::edgeweight>> expected, actual;
+        G.forNeighborsOf(u, [&](NetworKit::node v, NetworKit::edgeweight w) {
+            expected.emplace(v, w);
+            EXPECT_TRUE(S.hasEdge(u, v));
+            EXPECT_EQ(S.weight(u, v), w);
+        });
+        S.forNeighborsOf(u, [&](NetworKit::node v, NetworKit::edgeweight w) {
+            actual.emplace(v, w);
+        });
+        EXPECT_EQ(actual, expected);
+    }
+    NetworKit::count edges = 0;
+    S.forEdges([&](NetworKit::node u, NetworKit::node v) {
+        EXPECT_TRUE(G.hasEdge(u, v));
+        edges++;
+    });
+    EXPECT_EQ(edges, G.numberOfEdges());
+}
+
+TEST(StaticGraphTest, MatchesGraph) {
+    for (bool directed : {false, true}) {
+        auto G = random_graph(100, 600, directed, 3);
+        expect_same_graph(G, Koala::StaticGraph<>(G));
+        expect_same_graph(G, Koala::StaticGraph<uint32_t>(G));
+    }
+}
+
+TEST(StaticGraphTest, Traversal) {
+    auto G = random_graph(200, 300, false, 5);
+    Koala::StaticGraph<uint32_t> S(G);
+    auto always = [](NetworKit::node) { return true; };
+    std::set<NetworKit::node> expected, actual;
+    Koala::Traversal::DFSFrom(G, 0, [&](NetworKit::node v) { expected.insert(v); }, always);
+    Koala::Traversal::DFSFrom(S, 0, [&](NetworKit::node v) { actual.insert(v); }, always);
+    EXPECT_EQ(actual, expected);
+    for (NetworKit::node v = 1; v < 200; v++) {
+        if (G.hasNode(v)) {
+            EXPECT_EQ(Koala::Traversal::BFS(S, 0, v, always), expected.contains(v));
+            EXPECT_EQ(
+                Koala::Traversal::BFSPath(S, 0, v, always).size(),
+                Koala::Traversal::BFSPath(G, 0, v, always).size());
+        }
+    }
+}
+
+TEST(StaticGraphTest, MinimumSpanningForest) {
+    auto G = random_graph(300, 2000, false, 7);
+    auto kruskal = Koala::KruskalMinimumSpanningTree(G);
+    kruskal.run();
+    for (const auto &forest : {
+            Koala::kruskalMinimumSpanningForest(G),
+            Koala::kruskalMinimumSpanningForest(Koala::StaticGraph<uint32_t>(G))}) {
+        NetworKit::edgeweight total = 0;
+        for (const auto &e : forest) {
+            EXPECT_TRUE(G.hasEdge(e.u, e.v));
+            total += e.weight;
+        }
+        EXPECT_EQ(forest.size(), kruskal.getForest().numberOfEdges());
+        EXPECT_DOUBLE_EQ(total, kruskal.getForest().totalEdgeWeight());
+    }
+}
+
+TEST(StaticGraphTest, GreedyColoring) {
+    auto G = random_graph(300, 1500, false, 11);
+    Koala::StaticGraph<uint32_t> S(G);
+    auto ordering = Koala::smallestLastOrdering(S);
+    EXPECT_EQ(ordering.size(), G.numberOfNodes());
+    auto colors = Koala::greedyColoring(S, ordering);
+    NetworKit::count max_degree = 0;
+    G.forNodes([&](NetworKit::node v) {
+        EXPECT_GE(colors[v], 1);
+        max_degree = std::max(max_degree, G.degree(v));
+    });
+    G.forEdges([&](NetworKit::node u, NetworKit::node v) {
+        EXPECT_NE(colors[u], colors[v]);
+    });
+    EXPECT_LE(*std::max_element(colors.begin(), colors.end()), max_degree + 1);
+    EXPECT_EQ(Koala::greedyColoring(G, ordering), colors);
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <list>
 
 #include <coloring/ExactVertexColoring.hpp>
@@ -229,6 +230,20 @@ TEST_P(BrownEnumerationVertexColoringTest, test) {
     check(parameters, algorithm.getColoring());
 }
 
+TEST_P(BrownEnumerationVertexColoringTest, interrupted) {
+    VertexColoringParameters const& parameters = GetParam();
+    NetworKit::Graph G = build_graph(parameters.N, parameters.E, false);
+    auto algorithm = Koala::BrownEnumerationVertexColoring(G);
+    algorithm.setTimeLimit(std::chrono::seconds(0));
+    algorithm.run();
+    EXPECT_TRUE(algorithm.isInterrupted());
+    EXPECT_FALSE(algorithm.isOptimal());
+    auto colors = algorithm.getColoring();
+    for (auto [u, v] : parameters.E) {
+        EXPECT_NE(colors.at(u), colors.at(v));
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(test_example, BrownEnumerationVertexColoringTest, test_set_exact);
 
 TEST_P(ChristofidesEnumerationVertexColoringTest, test) {